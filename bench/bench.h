@@ -0,0 +1,62 @@
+/**
+ * @file bench.h
+ * @brief Shared helpers for the list benchmarks.
+ * @author Mark Jayson Lanuzo
+ * @date 2026-10-17
+ */
+
+#ifndef BENCH_H
+#define BENCH_H
+
+#include <stdio.h>
+#include <time.h>
+
+typedef struct {
+    int MM;             /**< Month of birth */
+    int DD;             /**< Day of birth */
+    int YYYY;           /**< Year of birth */
+} Date;
+
+typedef struct {
+    char *address1;     /**< First line of the address */
+    char *address2;     /**< Second line of the address (optional) */
+} Address;
+
+typedef struct {
+    char *name;         /**< Name of the person */
+    int age;            /**< Age of the person */
+    char gender;        /**< Gender of the person */
+    Date dateOfBirth;   /**< Date of birth of the person */
+    Address homeAddress; /**< Home address of the person */
+} Person;
+
+/**
+ * @brief Returns a monotonic timestamp in seconds.
+ */
+static inline double benchNow(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec / 1e9;
+}
+
+/**
+ * @brief Builds a deterministic Person from a sequence number.
+ */
+static inline Person benchPerson(int i) {
+    Person p = {"John Doe", 18 + (i * 7) % 60, (i & 1) ? 'M' : 'F',
+                {1 + i % 12, 1 + i % 28, 1950 + (i * 13) % 60},
+                {"123 Main St", ""}};
+    return p;
+}
+
+/**
+ * @brief Prints one benchmark result line.
+ */
+static inline void benchReport(const char *name, double seconds, size_t ops) {
+    printf("%-40s %10.3f ms %10.2f ns/op\n", name, seconds * 1e3, seconds * 1e9 / (double)ops);
+}
+
+/** Prevents the compiler from discarding a computed value. */
+static volatile long long benchSink;
+
+#endif /* BENCH_H */
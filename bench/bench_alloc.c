@@ -0,0 +1,58 @@
+/**
+ * @file bench_alloc.c
+ * @brief Short-lived sublist workload from main.c with each allocator backend.
+ * @author Mark Jayson Lanuzo
+ * @date 2026-10-17
+ *
+ * Repeatedly collects the people older than 30 into a new sublist and frees it,
+ * the olderPeople pattern from main.c. The arena is reset every BATCH sublists.
+ */
+
+#include "bench.h"
+#include "../list.h"
+
+#define PEOPLE 64
+#define ITERATIONS 1000000
+#define BATCH 1024
+
+static void runWorkload(const char *name, List *people, const ListAllocator *allocator,
+                        ListArena *arena) {
+    double start = benchNow();
+    long long total = 0;
+
+    for (int i = 0; i < ITERATIONS; i++) {
+        List olderPeople;
+        list_COLLECT_TO_SUBLIST_WITH_ALLOCATOR(people, Person, element->age > 30,
+                                               &olderPeople, allocator);
+        total += listLength(&olderPeople);
+        listFree(&olderPeople);
+        if (arena && (i + 1) % BATCH == 0) {
+            listArenaReset(arena);
+        }
+    }
+    benchSink = total;
+    benchReport(name, benchNow() - start, ITERATIONS);
+}
+
+int main(void) {
+    List people;
+    ListArena arena;
+    ListPool pool;
+
+    list_INIT(&people, Person);
+    for (int i = 0; i < PEOPLE; i++) {
+        list_ADD(&people, Person, benchPerson(i));
+    }
+
+    listArenaInit(&arena, 0);
+    listPoolInit(&pool);
+
+    runWorkload("sublist malloc", &people, NULL, NULL);
+    runWorkload("sublist arena", &people, listArenaAllocator(&arena), &arena);
+    runWorkload("sublist pool", &people, listPoolAllocator(&pool), NULL);
+
+    listArenaDestroy(&arena);
+    listPoolDestroy(&pool);
+    listFree(&people);
+    return 0;
+}
@@ -0,0 +1,103 @@
+/**
+ * @file bench_concurrent.c
+ * @brief Append throughput of ListConcurrent vs a mutex-wrapped List, 1 to N threads.
+ * @author Mark Jayson Lanuzo
+ * @date 2026-10-17
+ *
+ * Every run also checks its result: each thread appends the values
+ * (thread << 32) | sequence, and afterwards every value must be present
+ * exactly once. The stress test with concurrent readers is
+ * tests/test_concurrent.c (make test).
+ */
+
+#include <pthread.h>
+#include <stdint.h>
+#include <unistd.h>
+
+#include "bench.h"
+#include "../list.h"
+
+#define N 8000000
+#define MAX_THREADS 16
+
+static List lockedList;
+static pthread_mutex_t lockedListLock = PTHREAD_MUTEX_INITIALIZER;
+static ListConcurrent concurrentList;
+static int perThread;
+
+static void *appendLocked(void *arg) {
+    int64_t thread = (int64_t)(intptr_t)arg;
+    for (int i = 0; i < perThread; i++) {
+        pthread_mutex_lock(&lockedListLock);
+        list_ADD(&lockedList, int64_t, (thread << 32) | i);
+        pthread_mutex_unlock(&lockedListLock);
+    }
+    return NULL;
+}
+
+static void *appendConcurrent(void *arg) {
+    int64_t thread = (int64_t)(intptr_t)arg;
+    for (int i = 0; i < perThread; i++) {
+        list_CONCURRENT_ADD(&concurrentList, int64_t, (thread << 32) | i);
+    }
+    return NULL;
+}
+
+static void checkValue(unsigned char *seen, int64_t value) {
+    int64_t thread = value >> 32;
+    int64_t i = value & 0xffffffff;
+    if (thread >= MAX_THREADS || i >= perThread || seen[thread * perThread + i]) {
+        fprintf(stderr, "bad or duplicate value %lld\n", (long long)value);
+        exit(EXIT_FAILURE);
+    }
+    seen[thread * perThread + i] = 1;
+}
+
+static void checkConcurrent(unsigned char *seen, int threads) {
+    memset(seen, 0, N);
+    if (listConcurrentLength(&concurrentList) != perThread * threads) {
+        fprintf(stderr, "lost appends\n");
+        exit(EXIT_FAILURE);
+    }
+    list_CONCURRENT_FOR_EACH(&concurrentList, int64_t, checkValue(seen, *element));
+    listConcurrentFree(&concurrentList);
+}
+
+static double run(int threads, void *(*worker)(void *)) {
+    pthread_t ids[MAX_THREADS];
+    double start = benchNow();
+    for (int t = 0; t < threads; t++) {
+        pthread_create(&ids[t], NULL, worker, (void *)(intptr_t)t);
+    }
+    for (int t = 0; t < threads; t++) {
+        pthread_join(ids[t], NULL);
+    }
+    return benchNow() - start;
+}
+
+int main(void) {
+    long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+    int maxThreads = cpus > 4 ? (int)(cpus < MAX_THREADS ? cpus : MAX_THREADS) : 4;
+    unsigned char *seen = malloc(N);
+    char name[64];
+
+    for (int threads = 1; threads <= maxThreads; threads *= 2) {
+        perThread = N / threads;
+
+        list_INIT(&lockedList, int64_t);
+        double seconds = run(threads, appendLocked);
+        snprintf(name, sizeof(name), "mutex List, %d threads", threads);
+        benchReport(name, seconds, (size_t)perThread * threads);
+        memset(seen, 0, N);
+        list_FOR_EACH(&lockedList, int64_t, checkValue(seen, *element));
+        listFree(&lockedList);
+
+        list_CONCURRENT_INIT(&concurrentList, int64_t);
+        seconds = run(threads, appendConcurrent);
+        snprintf(name, sizeof(name), "ListConcurrent, %d threads", threads);
+        benchReport(name, seconds, (size_t)perThread * threads);
+        checkConcurrent(seen, threads);
+    }
+    free(seen);
+    return 0;
+}
@@ -0,0 +1,60 @@
+/**
+ * @file bench_deque.c
+ * @brief FIFO queue workload: list_ADD + list_REMOVE_AT(0) vs list_PUSH_BACK + list_POP_FRONT.
+ * @author Mark Jayson Lanuzo
+ * @date 2026-10-17
+ *
+ * Each run keeps depth elements queued and does OPERATIONS enqueues and
+ * dequeues. The shifting queue is O(depth) per dequeue, so on deep queues it
+ * runs fewer operations; ns/op stays comparable.
+ */
+
+#include "bench.h"
+#include "../list.h"
+
+#define OPERATIONS 10000000
+
+static void runShifting(int depth) {
+    List queue;
+    char name[64];
+    int operations = depth > 256 ? OPERATIONS / (depth / 256) : OPERATIONS;
+    list_INIT(&queue, Person);
+    for (int i = 0; i < depth; i++) {
+        list_ADD(&queue, Person, benchPerson(i));
+    }
+    double start = benchNow();
+    for (int i = 0; i < operations / 2; i++) {
+        list_ADD(&queue, Person, benchPerson(i));
+        benchSink += list_GET(&queue, Person, 0)->age;
+        list_REMOVE_AT(&queue, Person, 0);
+    }
+    snprintf(name, sizeof(name), "REMOVE_AT(0), depth %d", depth);
+    benchReport(name, benchNow() - start, (size_t)operations);
+    listFree(&queue);
+}
+
+static void runRing(int depth) {
+    List queue;
+    char name[64];
+    list_INIT(&queue, Person);
+    for (int i = 0; i < depth; i++) {
+        list_PUSH_BACK(&queue, Person, benchPerson(i));
+    }
+    double start = benchNow();
+    for (int i = 0; i < OPERATIONS / 2; i++) {
+        list_PUSH_BACK(&queue, Person, benchPerson(i));
+        benchSink += list_POP_FRONT(&queue, Person).age;
+    }
+    snprintf(name, sizeof(name), "POP_FRONT, depth %d", depth);
+    benchReport(name, benchNow() - start, OPERATIONS);
+    listFree(&queue);
+}
+
+int main(void) {
+    int depths[] = {16, 1024, 16384};
+    for (size_t i = 0; i < sizeof(depths) / sizeof(depths[0]); i++) {
+        runShifting(depths[i]);
+        runRing(depths[i]);
+    }
+    return 0;
+}
@@ -0,0 +1,101 @@
+/**
+ * @file bench_equals.c
+ * @brief Person lookups: memcmp scan vs the size-specialized default vs field-wise equality.
+ * @author Mark Jayson Lanuzo
+ * @date 2026-10-17
+ *
+ * Searches a list of N Persons for absent keys, so every lookup scans the
+ * whole list. Then looks up copies whose name strings live elsewhere and whose
+ * padding holds garbage: bytewise comparison misses them, the equality from
+ * list_DEFINE_TYPE_OPS finds them.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "bench.h"
+#include "../list.h"
+
+#define N 100000
+#define LOOKUPS 200
+
+list_DEFINE_TYPE_OPS(Person, STRING(name), VALUE(age), VALUE(gender), BYTES(dateOfBirth),
+                     STRING(homeAddress.address1), STRING(homeAddress.address2))
+
+/**
+ * @brief The scan list_GET_INDEX_OF did before: memcmp on every element.
+ */
+static int memcmpIndexOf(List *list, const Person *key) {
+    for (int i = 0; i < list->currentCount; i++) {
+        if (memcmp((Person *)list->data + i, key, sizeof(Person)) == 0) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+/**
+ * @brief Copies a Person into memory full of garbage, with its own name string.
+ */
+static Person garbledCopy(const Person *person, char *nameBuffer) {
+    Person copy;
+    memset(&copy, 0xA5, sizeof(copy));
+    strcpy(nameBuffer, person->name);
+    copy.name = nameBuffer;
+    copy.age = person->age;
+    copy.gender = person->gender;
+    copy.dateOfBirth = person->dateOfBirth;
+    copy.homeAddress = person->homeAddress;
+    return copy;
+}
+
+int main(void) {
+    List people;
+    List typed;
+    Person absent = benchPerson(0);
+    absent.age = -1;
+    double start;
+
+    list_INIT(&people, Person);
+    for (int i = 0; i < N; i++) {
+        list_ADD(&people, Person, benchPerson(i));
+    }
+
+    start = benchNow();
+    for (int i = 0; i < LOOKUPS; i++) {
+        benchSink += memcmpIndexOf(&people, &absent);
+    }
+    benchReport("memcmp scan", benchNow() - start, (size_t)N * LOOKUPS);
+
+    start = benchNow();
+    for (int i = 0; i < LOOKUPS; i++) {
+        benchSink += list_GET_INDEX_OF(&people, Person, absent);
+    }
+    benchReport("list_GET_INDEX_OF, bytewise default", benchNow() - start, (size_t)N * LOOKUPS);
+
+    list_REGISTER_TYPE(Person);
+    list_INIT(&typed, Person);
+    for (int i = 0; i < N; i++) {
+        list_ADD(&typed, Person, benchPerson(i));
+    }
+    start = benchNow();
+    for (int i = 0; i < LOOKUPS; i++) {
+        benchSink += list_GET_INDEX_OF(&typed, Person, absent);
+    }
+    benchReport("list_GET_INDEX_OF, PersonEquals", benchNow() - start, (size_t)N * LOOKUPS);
+
+    int bytewiseFound = 0;
+    int fieldwiseFound = 0;
+    char name[32];
+    for (int i = 0; i < LOOKUPS; i++) {
+        Person key = garbledCopy((Person *)listAt(&people, i * 7), name);
+        bytewiseFound += list_GET_INDEX_OF(&people, Person, key) != -1;
+        fieldwiseFound += list_GET_INDEX_OF(&typed, Person, key) != -1;
+    }
+    printf("copies found: bytewise %d / %d, PersonEquals %d / %d\n",
+           bytewiseFound, LOOKUPS, fieldwiseFound, LOOKUPS);
+
+    listFree(&people);
+    listFree(&typed);
+    return 0;
+}
@@ -0,0 +1,113 @@
+/**
+ * @file bench_insert.c
+ * @brief Scattered inserts: list_ADD_AT per element vs one listInsertBatch, and sorted merges.
+ * @author Mark Jayson Lanuzo
+ * @date 2026-10-17
+ *
+ * Inserts BATCH elements at random positions of a list of N ints. Each
+ * list_ADD_AT moves the tail, so that run does only SINGLE_INSERTS inserts and
+ * reports the time per insert and the time the full batch would take. Then
+ * merges two sorted lists with listMergeSorted and list_MERGE_SORTED against
+ * appending and sorting again.
+ */
+
+#include <stdlib.h>
+#include <stdint.h>
+
+#include "bench.h"
+#include "../list.h"
+
+#define N 10000000
+#define BATCH 100000
+#define SINGLE_INSERTS 200
+
+static uint32_t seed = 2463534242u;
+
+static uint32_t nextRandom(void) {
+    seed ^= seed << 13;
+    seed ^= seed >> 17;
+    seed ^= seed << 5;
+    return seed;
+}
+
+static void fill(List *list, int count) {
+    list_INIT_WITH_CAPACITY(list, int, count);
+    for (int i = 0; i < count; i++) {
+        list_ADD(list, int, 2 * i);
+    }
+}
+
+static void runSingle(void) {
+    List list;
+    fill(&list, N);
+    double start = benchNow();
+    for (int i = 0; i < SINGLE_INSERTS; i++) {
+        int value = -i;
+        list_ADD_AT(&list, int, value, (int)(nextRandom() % (uint32_t)list.currentCount));
+    }
+    double seconds = benchNow() - start;
+    benchReport("ADD_AT, 200 inserts", seconds, SINGLE_INSERTS);
+    printf("%-40s %10.3f ms (estimated)\n", "ADD_AT, 100000 inserts",
+           seconds * 1e3 * BATCH / SINGLE_INSERTS);
+    listFree(&list);
+}
+
+static void runBatch(void) {
+    List list;
+    size_t *indices = malloc(BATCH * sizeof(size_t));
+    int *values = malloc(BATCH * sizeof(int));
+    if (!indices || !values) {
+        fprintf(stderr, "Memory allocation failed\n");
+        exit(EXIT_FAILURE);
+    }
+    fill(&list, N);
+    for (int i = 0; i < BATCH; i++) {
+        indices[i] = nextRandom() % (N + 1);
+        values[i] = -i;
+    }
+    double start = benchNow();
+    listInsertBatch(&list, indices, values, BATCH);
+    benchReport("listInsertBatch, 100000 inserts", benchNow() - start, BATCH);
+    listFree(&list);
+    free(indices);
+    free(values);
+}
+
+static void runMerge(void) {
+    List list;
+    List other;
+    double start;
+
+    fill(&list, N);
+    list_INIT(&other, int);
+    for (int i = 0; i < BATCH; i++) {
+        list_ADD(&other, int, (int)(nextRandom() % (2 * N)));
+    }
+    listSort(&other);
+
+    start = benchNow();
+    listMergeSorted(&list, &other);
+    benchReport("listMergeSorted, 10^7 + 10^5", benchNow() - start, N + BATCH);
+    listFree(&list);
+
+    fill(&list, N);
+    start = benchNow();
+    list_MERGE_SORTED(&list, &other, int, *a < *b);
+    benchReport("list_MERGE_SORTED, 10^7 + 10^5", benchNow() - start, N + BATCH);
+    listFree(&list);
+
+    fill(&list, N);
+    start = benchNow();
+    listAppendRange(&list, other.data, (size_t)other.currentCount);
+    listSort(&list);
+    benchReport("listAppendRange + listSort", benchNow() - start, N + BATCH);
+    listFree(&list);
+    listFree(&other);
+}
+
+int main(void) {
+    runSingle();
+    runBatch();
+    runMerge();
+    return 0;
+}
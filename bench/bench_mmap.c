@@ -0,0 +1,93 @@
+/**
+ * @file bench_mmap.c
+ * @brief Startup time: parsing a CSV file vs list_OPEN_MAPPED on the same records.
+ * @author Mark Jayson Lanuzo
+ * @date 2026-10-17
+ */
+
+#include "bench.h"
+#include "../list.h"
+
+#ifndef BENCH_MMAP_N
+#define BENCH_MMAP_N 5000000
+#endif
+
+#define CSV_PATH "bench_mmap.csv"
+#define LIST_PATH "bench_mmap.clist"
+
+/** Person without pointers, so it can be saved byte for byte. */
+typedef struct {
+    char name[20];      /**< Name of the person */
+    int age;            /**< Age of the person */
+    char gender;        /**< Gender of the person */
+    Date dateOfBirth;   /**< Date of birth of the person */
+} PersonRecord;
+
+static PersonRecord benchRecord(int i) {
+    Person person = benchPerson(i);
+    PersonRecord record;
+    memset(&record, 0, sizeof(record));
+    snprintf(record.name, sizeof(record.name), "%s %d", person.name, i);
+    record.age = person.age;
+    record.gender = person.gender;
+    record.dateOfBirth = person.dateOfBirth;
+    return record;
+}
+
+int main(void) {
+    List people;
+    double start;
+
+    FILE *csv = fopen(CSV_PATH, "w");
+    if (!csv) {
+        perror(CSV_PATH);
+        return 1;
+    }
+    list_INIT_WITH_CAPACITY(&people, PersonRecord, BENCH_MMAP_N);
+    for (int i = 0; i < BENCH_MMAP_N; i++) {
+        PersonRecord record = benchRecord(i);
+        fprintf(csv, "%s,%d,%c,%d,%d,%d\n", record.name, record.age, record.gender,
+                record.dateOfBirth.MM, record.dateOfBirth.DD, record.dateOfBirth.YYYY);
+        list_ADD(&people, PersonRecord, record);
+    }
+    fclose(csv);
+    start = benchNow();
+    listSave(&people, LIST_PATH);
+    benchReport("listSave", benchNow() - start, BENCH_MMAP_N);
+    listFree(&people);
+    printf("%d records, %.1f MiB\n", BENCH_MMAP_N,
+           (double)BENCH_MMAP_N * sizeof(PersonRecord) / (1024.0 * 1024.0));
+
+    start = benchNow();
+    csv = fopen(CSV_PATH, "r");
+    list_INIT(&people, PersonRecord);
+    PersonRecord record;
+    memset(&record, 0, sizeof(record));
+    while (fscanf(csv, "%19[^,],%d,%c,%d,%d,%d\n", record.name, &record.age, &record.gender,
+                  &record.dateOfBirth.MM, &record.dateOfBirth.DD, &record.dateOfBirth.YYYY) == 6) {
+        list_ADD(&people, PersonRecord, record);
+    }
+    fclose(csv);
+    benchReport("startup: parse CSV", benchNow() - start, BENCH_MMAP_N);
+    listFree(&people);
+
+    start = benchNow();
+    list_OPEN_MAPPED(&people, PersonRecord, LIST_PATH);
+    benchReport("startup: list_OPEN_MAPPED", benchNow() - start, BENCH_MMAP_N);
+
+    start = benchNow();
+    long long ages = 0;
+    list_FOR_EACH(&people, PersonRecord, ages += element->age);
+    benchSink += ages;
+    benchReport("first full scan (page faults)", benchNow() - start, BENCH_MMAP_N);
+
+    start = benchNow();
+    bool valid = listVerifyChecksum(&people);
+    benchReport(valid ? "listVerifyChecksum (ok)" : "listVerifyChecksum (FAILED)",
+                benchNow() - start, BENCH_MMAP_N);
+
+    listFree(&people);
+    remove(CSV_PATH);
+    remove(LIST_PATH);
+    return 0;
+}
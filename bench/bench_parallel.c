@@ -0,0 +1,50 @@
+/**
+ * @file bench_parallel.c
+ * @brief list_COLLECT_TO_SUBLIST vs list_PAR_COLLECT on Person records.
+ * @author Mark Jayson Lanuzo
+ * @date 2026-10-17
+ */
+
+#include "bench.h"
+#include "../list.h"
+
+#define N 10000000
+
+list_DEFINE_PREDICATE(isOlder, Person, element->age > 30)
+list_DEFINE_ACTION(addYear, Person, element->age++)
+
+int main(void) {
+    List people;
+    List olderPeople;
+    double start;
+
+    list_INIT_WITH_CAPACITY(&people, Person, N);
+    for (int i = 0; i < N; i++) {
+        list_ADD(&people, Person, benchPerson(i));
+    }
+    printf("threads: %d\n", listParallelThreads());
+
+    start = benchNow();
+    list_COLLECT_TO_SUBLIST(&people, Person, element->age > 30, &olderPeople);
+    benchReport("collect serial", benchNow() - start, N);
+    listFree(&olderPeople);
+
+    start = benchNow();
+    list_PAR_COLLECT(&people, Person, isOlder, NULL, &olderPeople);
+    benchReport("collect parallel", benchNow() - start, N);
+    listFree(&olderPeople);
+
+    start = benchNow();
+    for (int i = 0; i < N; i++) {
+        list_GET(&people, Person, i)->age++;
+    }
+    benchReport("for-each serial", benchNow() - start, N);
+
+    start = benchNow();
+    list_PAR_FOR_EACH(&people, Person, addYear, NULL);
+    benchReport("for-each parallel", benchNow() - start, N);
+
+    listFree(&people);
+    listParallelShutdown();
+    return 0;
+}
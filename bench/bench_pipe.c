@@ -0,0 +1,77 @@
+/**
+ * @file bench_pipe.c
+ * @brief Filter, map and count: one fused list_PIPE_COUNT vs chained sublists.
+ * @author Mark Jayson Lanuzo
+ * @date 2026-10-17
+ *
+ * Runs the same three stages over a list of N ints: keep multiples of 3,
+ * double them as long, keep multiples of 4, count. The chained version builds
+ * a sublist for every step, the pipeline does one pass without allocating.
+ * Then looks for the first match near the start, where the pipeline stops early.
+ */
+
+#include <stdlib.h>
+
+#include "bench.h"
+#include "../list.h"
+
+#define N 10000000
+#define REPS 5
+
+static size_t chained(List *list) {
+    List multiples;
+    List doubled;
+    List result;
+    list_COLLECT_TO_SUBLIST(list, int, *element % 3 == 0, &multiples);
+    list_INIT(&doubled, long);
+    list_FOR_EACH(&multiples, int, list_ADD(&doubled, long, *element * 2L));
+    list_COLLECT_TO_SUBLIST(&doubled, long, *element % 4 == 0, &result);
+    size_t count = (size_t)listLength(&result);
+    listFree(&multiples);
+    listFree(&doubled);
+    listFree(&result);
+    return count;
+}
+
+static size_t fused(List *list) {
+    return list_PIPE_COUNT(list, int, FILTER(*element % 3 == 0), MAP(long, *element * 2L),
+                           FILTER(*element % 4 == 0));
+}
+
+int main(void) {
+    List numbers;
+    double start;
+
+    list_INIT_WITH_CAPACITY(&numbers, int, N);
+    for (int i = 0; i < N; i++) {
+        list_ADD(&numbers, int, i);
+    }
+
+    start = benchNow();
+    for (int r = 0; r < REPS; r++) {
+        benchSink += chained(&numbers);
+    }
+    benchReport("chained sublists, 3 stages", benchNow() - start, (size_t)N * REPS);
+
+    start = benchNow();
+    for (int r = 0; r < REPS; r++) {
+        benchSink += fused(&numbers);
+    }
+    benchReport("list_PIPE_COUNT, 3 stages", benchNow() - start, (size_t)N * REPS);
+
+    if (chained(&numbers) != fused(&numbers)) {
+        fprintf(stderr, "pipeline and chained sublists disagree\n");
+        return EXIT_FAILURE;
+    }
+
+    long first = 0;
+    start = benchNow();
+    for (int r = 0; r < REPS; r++) {
+        benchSink += list_PIPE_FIRST(&numbers, int, &first, FILTER(*element > 1000),
+                                     MAP(long, *element * 2L), FILTER(*element % 7 == 0));
+    }
+    benchReport("list_PIPE_FIRST, early exit", benchNow() - start, REPS);
+
+    listFree(&numbers);
+    return 0;
+}
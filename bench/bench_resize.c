@@ -0,0 +1,114 @@
+/**
+ * @file bench_resize.c
+ * @brief list_ADD latency percentiles with one-shot vs incremental resizing, 1K to 100M elements.
+ * @author Mark Jayson Lanuzo
+ * @date 2026-10-17
+ *
+ * Latencies go into a log-linear histogram per decade of list size, so the
+ * growth steps of a decade show up in its p99.9 and max. Each mode runs with
+ * malloc and with an arena, whose realloc always copies (glibc moves large
+ * malloc blocks with mremap instead of copying).
+ */
+
+#include <stdint.h>
+
+#include "bench.h"
+#include "../list.h"
+
+#define N 100000000
+#define FIRST_DECADE 1000
+#define BUCKETS (64 + 40 * 16)
+
+typedef struct {
+    uint64_t counts[BUCKETS];
+    uint64_t total;
+    uint64_t maxNs;
+} Histogram;
+
+static int bucketOf(uint64_t ns) {
+    if (ns < 64) {
+        return (int)ns;
+    }
+    int exponent = 63 - __builtin_clzll(ns);
+    if (exponent > 45) {
+        return BUCKETS - 1;
+    }
+    return 64 + (exponent - 6) * 16 + (int)((ns >> (exponent - 4)) & 15);
+}
+
+static uint64_t bucketFloor(int bucket) {
+    if (bucket < 64) {
+        return (uint64_t)bucket;
+    }
+    int exponent = (bucket - 64) / 16 + 6;
+    return ((uint64_t)16 + (uint64_t)((bucket - 64) % 16)) << (exponent - 4);
+}
+
+static uint64_t percentile(const Histogram *histogram, double fraction) {
+    uint64_t rank = (uint64_t)(fraction * (double)histogram->total);
+    uint64_t seen = 0;
+    for (int b = 0; b < BUCKETS; b++) {
+        seen += histogram->counts[b];
+        if (seen > rank) {
+            return bucketFloor(b);
+        }
+    }
+    return histogram->maxNs;
+}
+
+static uint64_t nowNs(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000u + (uint64_t)ts.tv_nsec;
+}
+
+static void run(const char *mode, bool incremental, const ListAllocator *allocator) {
+    List numbers;
+    Histogram histogram;
+    int decadeEnd = FIRST_DECADE * 10;
+
+    list_INIT_WITH_ALLOCATOR(&numbers, int, FIRST_DECADE, allocator);
+    listSetIncrementalResize(&numbers, incremental);
+    for (int i = 0; i < FIRST_DECADE; i++) {
+        list_ADD(&numbers, int, i);
+    }
+    memset(&histogram, 0, sizeof(histogram));
+    printf("%s\n", mode);
+    for (int i = FIRST_DECADE; i < N; i++) {
+        uint64_t start = nowNs();
+        list_ADD(&numbers, int, i);
+        uint64_t ns = nowNs() - start;
+        histogram.counts[bucketOf(ns)]++;
+        histogram.total++;
+        if (ns > histogram.maxNs) {
+            histogram.maxNs = ns;
+        }
+        if (i + 1 == decadeEnd) {
+            printf("  up to %9d: p50 %5llu ns  p99 %6llu ns  p99.9 %7llu ns  max %10.3f ms\n",
+                   decadeEnd, (unsigned long long)percentile(&histogram, 0.5),
+                   (unsigned long long)percentile(&histogram, 0.99),
+                   (unsigned long long)percentile(&histogram, 0.999),
+                   (double)histogram.maxNs / 1e6);
+            memset(&histogram, 0, sizeof(histogram));
+            decadeEnd *= 10;
+        }
+    }
+    benchSink += *list_GET(&numbers, int, N - 1);
+    listFree(&numbers);
+}
+
+int main(void) {
+    ListArena arena;
+
+    run("realloc (malloc)", false, NULL);
+    run("incremental (malloc)", true, NULL);
+
+    listArenaInit(&arena, 0);
+    run("realloc (arena)", false, listArenaAllocator(&arena));
+    listArenaDestroy(&arena);
+
+    listArenaInit(&arena, 0);
+    run("incremental (arena)", true, listArenaAllocator(&arena));
+    listArenaDestroy(&arena);
+    return 0;
+}
@@ -0,0 +1,63 @@
+/**
+ * @file bench_sbo.c
+ * @brief Creates and destroys many small lists to measure the inline buffer.
+ * @author Mark Jayson Lanuzo
+ * @date 2026-10-17
+ *
+ * Built twice by the Makefile: once with -DLIST_INLINE_BYTES=64 and once with
+ * the default of 0, which always allocates.
+ * Allocations are counted with a ListAllocator that wraps malloc.
+ */
+
+#include "bench.h"
+#include "../list.h"
+
+#define LISTS 10000000
+#define ELEMENTS 4
+
+static size_t allocationCount;
+
+static void *countingAlloc(void *context, size_t size) {
+    (void)context;
+    allocationCount++;
+    return malloc(size);
+}
+
+static void *countingRealloc(void *context, void *ptr, size_t oldSize, size_t newSize) {
+    (void)context;
+    (void)oldSize;
+    allocationCount++;
+    return realloc(ptr, newSize);
+}
+
+static void countingFree(void *context, void *ptr, size_t size) {
+    (void)context;
+    (void)size;
+    free(ptr);
+}
+
+static const ListAllocator countingAllocator = {
+    countingAlloc, countingRealloc, countingFree, NULL
+};
+
+int main(void) {
+    double start = benchNow();
+    long long total = 0;
+
+    for (int i = 0; i < LISTS; i++) {
+        List grades;
+        list_INIT_WITH_ALLOCATOR(&grades, int, LIST_DEFAULT_CAPACITY, &countingAllocator);
+        for (int k = 0; k < ELEMENTS; k++) {
+            list_ADD(&grades, int, i + k);
+        }
+        total += *list_GET(&grades, int, ELEMENTS - 1);
+        listFree(&grades);
+    }
+    benchSink = total;
+
+    char name[64];
+    snprintf(name, sizeof(name), "small lists (inline %d B)", LIST_INLINE_BYTES);
+    benchReport(name, benchNow() - start, LISTS);
+    printf("%-40s %10zu\n", "allocations", allocationCount);
+    return 0;
+}
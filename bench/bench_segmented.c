@@ -0,0 +1,73 @@
+/**
+ * @file bench_segmented.c
+ * @brief Per-append latency percentiles of List (realloc growth) vs ListSegmented.
+ * @author Mark Jayson Lanuzo
+ * @date 2026-10-17
+ */
+
+#include <stdint.h>
+
+#include "bench.h"
+#include "../list.h"
+
+#define N 10000000
+
+static int compareLatency(const void *a, const void *b) {
+    double left = *(const double *)a;
+    double right = *(const double *)b;
+    return (left > right) - (left < right);
+}
+
+static void reportLatency(const char *name, double *latency, size_t count) {
+    double total = 0;
+    for (size_t i = 0; i < count; i++) {
+        total += latency[i];
+    }
+    qsort(latency, count, sizeof(double), compareLatency);
+    printf("%-28s mean %7.1f ns  p50 %7.1f ns  p99 %7.1f ns  p99.9 %9.1f ns  max %10.3f ms\n",
+           name, total * 1e9 / (double)count, latency[count / 2] * 1e9,
+           latency[count * 99 / 100] * 1e9, latency[count * 999 / 1000] * 1e9,
+           latency[count - 1] * 1e3);
+}
+
+int main(void) {
+    double *latency = malloc(N * sizeof(double));
+    List people;
+    ListSegmented segmented;
+
+    if (!latency) {
+        fprintf(stderr, "Memory allocation failed\n");
+        return EXIT_FAILURE;
+    }
+
+    list_INIT(&people, Person);
+    for (int i = 0; i < N; i++) {
+        Person person = benchPerson(i);
+        double start = benchNow();
+        list_ADD(&people, Person, person);
+        latency[i] = benchNow() - start;
+    }
+    reportLatency("List list_ADD", latency, N);
+    listFree(&people);
+
+    list_SEG_INIT(&segmented, Person);
+    Person *first = NULL;
+    for (int i = 0; i < N; i++) {
+        Person person = benchPerson(i);
+        double start = benchNow();
+        list_SEG_ADD(&segmented, Person, person);
+        latency[i] = benchNow() - start;
+        if (i == 0) {
+            first = list_SEG_GET(&segmented, Person, 0);
+        }
+    }
+    reportLatency("ListSegmented list_SEG_ADD", latency, N);
+    if (first != list_SEG_GET(&segmented, Person, 0)) {
+        fprintf(stderr, "element 0 moved\n");
+        return EXIT_FAILURE;
+    }
+    listSegFree(&segmented);
+
+    free(latency);
+    return 0;
+}
@@ -0,0 +1,118 @@
+/**
+ * @file bench_simd.c
+ * @brief Throughput of the search and reduction kernels per instruction set.
+ * @author Mark Jayson Lanuzo
+ * @date 2026-10-17
+ *
+ * Every kernel scans the whole list (find uses a value that is not present), so
+ * GB/s is list bytes divided by time. "macro" is the per-element memcmp loop
+ * list_GET_INDEX_OF used before the kernels existed.
+ */
+
+#include <stdint.h>
+
+#include "bench.h"
+#include "../list.h"
+
+#define N 10000000
+#define REPEAT 10
+
+static const char *levelNames[] = {"scalar", "sse2", "avx2"};
+
+static int legacyIndexOf(List *list, const void *value) {
+    int foundIndex = -1;
+    for (int i = 0; i < list->currentCount; i++) {
+        if (memcmp((char *)list->data + (i * list->size), value, list->size) == 0) {
+            foundIndex = i;
+            break;
+        }
+    }
+    return foundIndex;
+}
+
+static void reportRate(const char *type, const char *kernel, const char *level, List *list, double seconds) {
+    double bytes = (double)list->dataSize * REPEAT;
+    printf("%-8s %-8s %-8s %8.2f GB/s\n", type, kernel, level, bytes / seconds / 1e9);
+}
+
+static void benchList(const char *type, List *list, const void *missing) {
+    unsigned char out[8];
+    double start;
+
+    start = benchNow();
+    for (int r = 0; r < REPEAT; r++) {
+        benchSink += legacyIndexOf(list, missing);
+    }
+    reportRate(type, "find", "macro", list, benchNow() - start);
+
+    for (int level = LIST_SIMD_SCALAR; level <= (int)LIST_SIMD_AVX2; level++) {
+        listSimdSetLevel((ListSimdLevel)level);
+        if ((int)listSimdLevel() != level) {
+            continue;
+        }
+        start = benchNow();
+        for (int r = 0; r < REPEAT; r++) {
+            benchSink += listFindFirst(list, missing);
+        }
+        reportRate(type, "find", levelNames[level], list, benchNow() - start);
+
+        start = benchNow();
+        for (int r = 0; r < REPEAT; r++) {
+            benchSink += (long long)listCountEqual(list, missing);
+        }
+        reportRate(type, "count", levelNames[level], list, benchNow() - start);
+
+        start = benchNow();
+        for (int r = 0; r < REPEAT; r++) {
+            benchSink += listMin(list, out);
+        }
+        reportRate(type, "min", levelNames[level], list, benchNow() - start);
+
+        start = benchNow();
+        for (int r = 0; r < REPEAT; r++) {
+            benchSink += listMax(list, out);
+        }
+        reportRate(type, "max", levelNames[level], list, benchNow() - start);
+
+        if (list->elementKind == LIST_KIND_PTR) {
+            continue;
+        }
+        start = benchNow();
+        for (int r = 0; r < REPEAT; r++) {
+            benchSink += (long long)listSum(list);
+        }
+        reportRate(type, "sum", levelNames[level], list, benchNow() - start);
+    }
+    listSimdSetLevel(LIST_SIMD_AVX2);
+}
+
+int main(void) {
+    List ints, floats, doubles, pointers;
+
+    list_INIT_WITH_CAPACITY(&ints, int, N);
+    list_INIT_WITH_CAPACITY(&floats, float, N);
+    list_INIT_WITH_CAPACITY(&doubles, double, N);
+    list_INIT_WITH_CAPACITY(&pointers, char*, N);
+    for (int i = 0; i < N; i++) {
+        list_ADD(&ints, int, i % 1000);
+        list_ADD(&floats, float, (float)(i % 1000));
+        list_ADD(&doubles, double, (double)(i % 1000));
+        list_ADD(&pointers, char*, (char *)(uintptr_t)(i % 1000 + 1));
+    }
+
+    int missingInt = -1;
+    float missingFloat = -1.0f;
+    double missingDouble = -1.0;
+    char *missingPointer = NULL;
+
+    benchList("int", &ints, &missingInt);
+    benchList("float", &floats, &missingFloat);
+    benchList("double", &doubles, &missingDouble);
+    benchList("char*", &pointers, &missingPointer);
+
+    listFree(&ints);
+    listFree(&floats);
+    listFree(&doubles);
+    listFree(&pointers);
+    return 0;
+}
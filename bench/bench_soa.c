@@ -0,0 +1,96 @@
+/**
+ * @file bench_soa.c
+ * @brief Row (List) vs columnar (ListSoA) layout for age-filter and date-range queries.
+ * @author Mark Jayson Lanuzo
+ * @date 2026-10-17
+ */
+
+#include "bench.h"
+#include "../list.h"
+
+#define N 10000000
+#define ROUNDS 5
+
+static const ListField personColumns[] = {
+    list_FIELD_STRING(Person, name),
+    list_FIELD(Person, age),
+    list_FIELD(Person, gender),
+    list_FIELD(Person, dateOfBirth.MM),
+    list_FIELD(Person, dateOfBirth.DD),
+    list_FIELD(Person, dateOfBirth.YYYY),
+    list_FIELD_STRING(Person, homeAddress.address1),
+    list_FIELD_STRING(Person, homeAddress.address2),
+};
+static const ListSchema personSchema = list_SCHEMA(Person, personColumns);
+
+int main(void) {
+    List people;
+    ListSoA columns;
+    ListSelection selection;
+    double start;
+
+    list_INIT_WITH_CAPACITY(&people, Person, N);
+    list_SOA_INIT(&columns, Person, personSchema);
+    listSoAReserve(&columns, N);
+    for (int i = 0; i < N; i++) {
+        list_ADD(&people, Person, benchPerson(i));
+        list_SOA_ADD(&columns, Person, benchPerson(i));
+    }
+    listSelectionInit(&selection);
+
+    /* age > 30 */
+    start = benchNow();
+    for (int round = 0; round < ROUNDS; round++) {
+        list_SELECT(&people, Person, element->age > 30, &selection);
+        benchSink += selection.currentCount;
+    }
+    benchReport("age > 30: List list_SELECT", benchNow() - start, (size_t)ROUNDS * N);
+
+    start = benchNow();
+    for (int round = 0; round < ROUNDS; round++) {
+        list_SOA_SELECT(&columns, Person, age, value > 30, &selection);
+        benchSink += selection.currentCount;
+    }
+    benchReport("age > 30: list_SOA_SELECT", benchNow() - start, (size_t)ROUNDS * N);
+
+    ListView ages = list_SOA_COLUMN_VIEW(&columns, Person, age);
+    int minAge = 31, maxAge = 0x7fffffff;
+    start = benchNow();
+    for (int round = 0; round < ROUNDS; round++) {
+        listViewSelectRange(&ages, &minAge, &maxAge, &selection);
+        benchSink += selection.currentCount;
+    }
+    benchReport("age > 30: listViewSelectRange", benchNow() - start, (size_t)ROUNDS * N);
+
+    /* Born in the 1970s */
+    start = benchNow();
+    for (int round = 0; round < ROUNDS; round++) {
+        list_SELECT(&people, Person,
+                    element->dateOfBirth.YYYY >= 1970 && element->dateOfBirth.YYYY <= 1979,
+                    &selection);
+        benchSink += selection.currentCount;
+    }
+    benchReport("1970s: List list_SELECT", benchNow() - start, (size_t)ROUNDS * N);
+
+    start = benchNow();
+    for (int round = 0; round < ROUNDS; round++) {
+        list_SOA_SELECT(&columns, Person, dateOfBirth.YYYY, value >= 1970 && value <= 1979,
+                        &selection);
+        benchSink += selection.currentCount;
+    }
+    benchReport("1970s: list_SOA_SELECT", benchNow() - start, (size_t)ROUNDS * N);
+
+    ListView years = list_SOA_COLUMN_VIEW(&columns, Person, dateOfBirth.YYYY);
+    int firstYear = 1970, lastYear = 1979;
+    start = benchNow();
+    for (int round = 0; round < ROUNDS; round++) {
+        listViewSelectRange(&years, &firstYear, &lastYear, &selection);
+        benchSink += selection.currentCount;
+    }
+    benchReport("1970s: listViewSelectRange", benchNow() - start, (size_t)ROUNDS * N);
+
+    listSelectionFree(&selection);
+    listSoAFree(&columns);
+    listFree(&people);
+    return 0;
+}
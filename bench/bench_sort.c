@@ -0,0 +1,124 @@
+/**
+ * @file bench_sort.c
+ * @brief list_SORT, list_SORT_STABLE and listSort vs qsort on a list_TO_ARRAY copy.
+ * @author Mark Jayson Lanuzo
+ * @date 2026-10-17
+ */
+
+#include "bench.h"
+#include "../list.h"
+
+#define N 2000000
+#define LOOKUPS 1000
+
+static int compareInt(const void *a, const void *b) {
+    int left = *(const int *)a;
+    int right = *(const int *)b;
+    return (left > right) - (left < right);
+}
+
+static int comparePersonAge(const void *a, const void *b) {
+    return ((const Person *)a)->age - ((const Person *)b)->age;
+}
+
+static unsigned int benchRandom(unsigned int *state) {
+    *state = *state * 1103515245u + 12345u;
+    return *state >> 1;
+}
+
+static void fillNumbers(List *numbers) {
+    unsigned int state = 7;
+    listFree(numbers);
+    list_INIT_WITH_CAPACITY(numbers, int, N);
+    for (int i = 0; i < N; i++) {
+        list_ADD(numbers, int, (int)benchRandom(&state));
+    }
+}
+
+static void fillPeople(List *people) {
+    unsigned int state = 11;
+    listFree(people);
+    list_INIT_WITH_CAPACITY(people, Person, N);
+    for (int i = 0; i < N; i++) {
+        list_ADD(people, Person, benchPerson((int)(benchRandom(&state) % N)));
+    }
+}
+
+int main(void) {
+    List numbers;
+    List people;
+    double start;
+
+    list_INIT(&numbers, int);
+    list_INIT(&people, Person);
+
+    fillNumbers(&numbers);
+    start = benchNow();
+    int *numberArray = list_TO_ARRAY(&numbers, int);
+    qsort(numberArray, N, sizeof(int), compareInt);
+    listFree(&numbers);
+    list_INIT_WITH_CAPACITY(&numbers, int, N);
+    list_ARRAY_TO_LIST_N(&numbers, int, numberArray, N);
+    free(numberArray);
+    benchReport("int qsort copy", benchNow() - start, N);
+
+    fillNumbers(&numbers);
+    start = benchNow();
+    list_SORT(&numbers, int, *a < *b);
+    benchReport("int list_SORT", benchNow() - start, N);
+
+    fillNumbers(&numbers);
+    start = benchNow();
+    list_SORT_STABLE(&numbers, int, *a < *b);
+    benchReport("int list_SORT_STABLE", benchNow() - start, N);
+
+    fillNumbers(&numbers);
+    start = benchNow();
+    listSort(&numbers);
+    benchReport("int listSort (radix)", benchNow() - start, N);
+
+    start = benchNow();
+    for (int i = 0; i < LOOKUPS; i++) {
+        benchSink += list_GET_INDEX_OF(&numbers, int, i * 1000003);
+    }
+    benchReport("int lookup sorted", benchNow() - start, LOOKUPS);
+
+    numbers.sorted = false;
+    start = benchNow();
+    for (int i = 0; i < LOOKUPS; i++) {
+        benchSink += list_GET_INDEX_OF(&numbers, int, i * 1000003);
+    }
+    benchReport("int lookup linear", benchNow() - start, LOOKUPS);
+
+    fillPeople(&people);
+    start = benchNow();
+    Person *personArray = list_TO_ARRAY(&people, Person);
+    qsort(personArray, N, sizeof(Person), comparePersonAge);
+    listFree(&people);
+    list_INIT_WITH_CAPACITY(&people, Person, N);
+    list_ARRAY_TO_LIST_N(&people, Person, personArray, N);
+    free(personArray);
+    benchReport("Person qsort copy", benchNow() - start, N);
+
+    fillPeople(&people);
+    start = benchNow();
+    list_SORT(&people, Person, a->age < b->age);
+    benchReport("Person list_SORT", benchNow() - start, N);
+
+    fillPeople(&people);
+    start = benchNow();
+    list_SORT_STABLE(&people, Person, a->age < b->age);
+    benchReport("Person list_SORT_STABLE", benchNow() - start, N);
+
+    Person key = benchPerson(0);
+    start = benchNow();
+    for (int i = 0; i < LOOKUPS; i++) {
+        key.age = i % 80;
+        benchSink += list_LOWER_BOUND(&people, Person, key, a->age < b->age);
+    }
+    benchReport("Person list_LOWER_BOUND", benchNow() - start, LOOKUPS);
+
+    listFree(&numbers);
+    listFree(&people);
+    return 0;
+}
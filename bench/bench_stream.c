@@ -0,0 +1,78 @@
+/**
+ * @file bench_stream.c
+ * @brief listStreamWrite / list_STREAM_READ throughput on Person records.
+ * @author Mark Jayson Lanuzo
+ * @date 2026-10-17
+ */
+
+#include "bench.h"
+#include "../list.h"
+
+#define N 2000000
+#define UNIQUE_NAMES 10000
+#define STREAM_PATH "bench_stream.bin"
+
+static const ListField addressFields[] = {
+    list_FIELD_STRING(Address, address1),
+    list_FIELD_STRING(Address, address2),
+};
+static const ListSchema addressSchema = list_SCHEMA(Address, addressFields);
+
+static const ListField personFields[] = {
+    list_FIELD_STRING(Person, name),
+    list_FIELD(Person, age),
+    list_FIELD(Person, gender),
+    list_FIELD(Person, dateOfBirth),
+    list_FIELD_STRUCT(Person, homeAddress, addressSchema),
+};
+static const ListSchema personSchema = list_SCHEMA(Person, personFields);
+
+static char names[UNIQUE_NAMES][16];
+
+int main(void) {
+    List people;
+    List loaded;
+    ListArena arena;
+    double start;
+
+    listRegisterSchema(&personSchema);
+    for (int i = 0; i < UNIQUE_NAMES; i++) {
+        snprintf(names[i], sizeof(names[i]), "Person %d", i);
+    }
+    list_INIT_WITH_CAPACITY(&people, Person, N);
+    for (int i = 0; i < N; i++) {
+        Person person = benchPerson(i);
+        person.name = names[i % UNIQUE_NAMES];
+        list_ADD(&people, Person, person);
+    }
+
+    FILE *out = fopen(STREAM_PATH, "wb");
+    if (!out) {
+        perror(STREAM_PATH);
+        return 1;
+    }
+    start = benchNow();
+    listStreamWrite(&people, out);
+    long streamSize = ftell(out);
+    fclose(out);
+    benchReport("listStreamWrite", benchNow() - start, N);
+
+    FILE *in = fopen(STREAM_PATH, "rb");
+    listArenaInit(&arena, 1 << 20);
+    start = benchNow();
+    bool valid = list_STREAM_READ(&loaded, Person, in, &arena);
+    fclose(in);
+    benchReport(valid ? "list_STREAM_READ" : "list_STREAM_READ (FAILED)", benchNow() - start, N);
+
+    start = benchNow();
+    listArenaDestroy(&arena);
+    benchReport("listArenaDestroy (whole list)", benchNow() - start, N);
+
+    printf("%d records, list %.1f MiB, stream %.1f MiB\n", N,
+           (double)listSizeOfData(&people) / (1024.0 * 1024.0),
+           (double)streamSize / (1024.0 * 1024.0));
+
+    listFree(&people);
+    remove(STREAM_PATH);
+    return 0;
+}
@@ -0,0 +1,412 @@
+/**
+ * @file bench_suite.c
+ * @brief Reproducible benchmark suite for the core list operations, run by `make bench`.
+ * @author Mark Jayson Lanuzo
+ * @date 2026-10-17
+ *
+ * Every operation runs on elements of 4, 64 (Person-sized) and 256 bytes and
+ * on lists of 10^2 up to --max-n elements, growing by powers of ten. Each case
+ * is warmed up once and then repeated --reps times; the median and p99 of the
+ * per-repetition ns/op are reported with the allocations per operation, counted
+ * through a wrapping ListAllocator, and the resident set size with the list
+ * full. Results print as a table and can be written as CSV or JSON; a CSV run
+ * can be stored as a baseline and later runs compared against it.
+ *
+ * Usage: bench_suite [--reps N] [--max-n N] [--max-bytes N] [--op NAME]
+ *                    [--csv FILE] [--json FILE] [--baseline FILE] [--threshold PCT]
+ *
+ * With --baseline the exit status is 1 if any median is more than --threshold
+ * percent (default 10) slower than in the baseline.
+ */
+
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "bench.h"
+#include "../list.h"
+
+#define MIN_OPS 200000      /* A repetition stops after this many operations... */
+#define MIN_SECONDS 0.02    /* ...or after this much timed work, whichever is first */
+#define MAX_ADD_AT_N 10000  /* list_ADD_AT at the front is quadratic */
+#define MAX_RESULTS 512
+
+typedef struct { int key; } Elem4;
+typedef struct { int key; char pad[60]; } Elem64;
+typedef struct { int key; char pad[252]; } Elem256;
+
+_Static_assert(sizeof(Elem64) == 64 && sizeof(Elem256) == 256, "unexpected padding");
+
+typedef enum {
+    OP_ADD, OP_GET, OP_FOR_EACH, OP_CONTAINS, OP_ADD_AT_FRONT,
+    OP_SWAP_REMOVE_AT, OP_SORT, OP_TO_ARRAY, OP_COUNT
+} BenchOp;
+
+static const char *const opNames[OP_COUNT] = {
+    "add", "get", "for_each", "contains", "add_at_front",
+    "swap_remove_at", "sort", "to_array",
+};
+
+typedef struct {
+    const char *op;
+    size_t elementSize;
+    size_t n;
+    int reps;
+    double medianNs;        /* Median ns/op over the repetitions */
+    double p99Ns;           /* 99th percentile ns/op over the repetitions */
+    double allocsPerOp;     /* Allocations and reallocations per operation */
+    long rssKb;             /* Largest resident set size with the list full */
+} BenchResult;
+
+static struct {
+    int reps;
+    size_t maxN;
+    size_t maxBytes;
+    const char *op;
+    const char *csv;
+    const char *json;
+    const char *baseline;
+    double threshold;
+} options = { 7, 1000000, (size_t)1 << 30, NULL, NULL, NULL, NULL, 10.0 };
+
+static BenchResult results[MAX_RESULTS];
+static int resultCount;
+
+/* Counting allocator: every list in the suite allocates through it */
+static unsigned long long allocCount;
+
+static void *countAlloc(void *context, size_t size) {
+    (void)context;
+    allocCount++;
+    return malloc(size);
+}
+
+static void *countRealloc(void *context, void *ptr, size_t oldSize, size_t newSize) {
+    (void)context;
+    (void)oldSize;
+    allocCount++;
+    return realloc(ptr, newSize);
+}
+
+static void countFree(void *context, void *ptr, size_t size) {
+    (void)context;
+    (void)size;
+    free(ptr);
+}
+
+static const ListAllocator countingAllocator = { countAlloc, countRealloc, countFree, NULL };
+
+/**
+ * @brief Gets the resident set size of the process in KiB, 0 if unknown.
+ */
+static long rssKb(void) {
+    long pages = 0;
+    FILE *statm = fopen("/proc/self/statm", "r");
+    if (statm) {
+        if (fscanf(statm, "%*s %ld", &pages) != 1) {
+            pages = 0;
+        }
+        fclose(statm);
+    }
+    return pages * (sysconf(_SC_PAGESIZE) / 1024);
+}
+
+static uint32_t nextRandom(uint32_t *state) {
+    *state ^= *state << 13;
+    *state ^= *state >> 17;
+    *state ^= *state << 5;
+    return *state;
+}
+
+/* Measurement of one repetition, filled by the per-type run functions */
+typedef struct {
+    double seconds;
+    size_t ops;
+    unsigned long long allocs;
+    long rssKb;
+} BenchSample;
+
+/**
+ * Defines runT(op, n, sample): builds a list of n elements of T untimed
+ * (except for OP_ADD and OP_ADD_AT_FRONT, which time the build), times the
+ * operation and frees the list. Small lists repeat until MIN_OPS operations
+ * or MIN_SECONDS of timed work.
+ */
+#define BENCH_DEFINE_RUN(T)                                                         \
+static void run##T(BenchOp op, size_t n, BenchSample *sample) {                     \
+    uint32_t seed = 2463534242u;                                                    \
+    memset(sample, 0, sizeof(*sample));                                             \
+    for (int iter = 0; sample->ops < MIN_OPS && sample->seconds < MIN_SECONDS; iter++) {\
+        List list;                                                                  \
+        T item;                                                                     \
+        memset(&item, 0, sizeof(item));                                             \
+        list_INIT_WITH_ALLOCATOR(&list, T, LIST_DEFAULT_CAPACITY, &countingAllocator);\
+        if (op != OP_ADD && op != OP_ADD_AT_FRONT) {                                \
+            for (size_t i = 0; i < n; i++) {                                        \
+                item.key = op == OP_SORT ? (int)nextRandom(&seed) : (int)i;         \
+                list_ADD(&list, T, item);                                           \
+            }                                                                       \
+        }                                                                           \
+        bool timesBuild = op == OP_ADD || op == OP_ADD_AT_FRONT;                    \
+        if (iter == 0 && !timesBuild) {                                             \
+            sample->rssKb = rssKb();                                                \
+        }                                                                           \
+        unsigned long long allocsBefore = allocCount;                               \
+        long long sum = 0;                                                          \
+        size_t ops = n;                                                             \
+        double start = benchNow();                                                  \
+        switch (op) {                                                               \
+        case OP_ADD:                                                                \
+            for (size_t i = 0; i < n; i++) {                                        \
+                item.key = (int)i;                                                  \
+                list_ADD(&list, T, item);                                           \
+            }                                                                       \
+            break;                                                                  \
+        case OP_GET:                                                                \
+            for (size_t i = 0; i < n; i++) {                                        \
+                sum += list_GET(&list, T, (int)i)->key;                             \
+            }                                                                       \
+            break;                                                                  \
+        case OP_FOR_EACH:                                                           \
+            list_FOR_EACH(&list, T, { sum += element->key; });                      \
+            break;                                                                  \
+        case OP_CONTAINS:                                                           \
+            ops = n > 10000000 ? 3 : 10000000 / n;                                  \
+            if (ops > 1000) {                                                       \
+                ops = 1000;                                                         \
+            }                                                                       \
+            item.key = -1; /* Absent, so every lookup scans the whole list */       \
+            for (size_t i = 0; i < ops; i++) {                                      \
+                sum += list_CONTAINS(&list, T, item);                               \
+            }                                                                       \
+            break;                                                                  \
+        case OP_ADD_AT_FRONT:                                                       \
+            for (size_t i = 0; i < n; i++) {                                        \
+                item.key = (int)i;                                                  \
+                list_ADD_AT(&list, T, item, 0);                                     \
+            }                                                                       \
+            break;                                                                  \
+        case OP_SWAP_REMOVE_AT:                                                     \
+            for (size_t i = 0; i < n; i++) {                                        \
+                list_SWAP_REMOVE_AT(&list, T, 0);                                   \
+            }                                                                       \
+            break;                                                                  \
+        case OP_SORT:                                                               \
+            list_SORT(&list, T, a->key < b->key);                                   \
+            break;                                                                  \
+        case OP_TO_ARRAY: {                                                         \
+            T *array = list_TO_ARRAY(&list, T);                                     \
+            sum += array[n - 1].key;                                                \
+            free(array);                                                            \
+            break;                                                                  \
+        }                                                                           \
+        default:                                                                    \
+            break;                                                                  \
+        }                                                                           \
+        sample->seconds += benchNow() - start;                                      \
+        sample->ops += ops;                                                         \
+        sample->allocs += allocCount - allocsBefore;                                \
+        if (iter == 0 && timesBuild) {                                              \
+            sample->rssKb = rssKb();                                                \
+        }                                                                           \
+        benchSink += sum;                                                           \
+        listFree(&list);                                                            \
+    }                                                                               \
+}
+
+BENCH_DEFINE_RUN(Elem4)
+BENCH_DEFINE_RUN(Elem64)
+BENCH_DEFINE_RUN(Elem256)
+
+static int compareDouble(const void *left, const void *right) {
+    double a = *(const double *)left;
+    double b = *(const double *)right;
+    return (a > b) - (a < b);
+}
+
+/**
+ * @brief Warms up and repeats one case, then records its result.
+ */
+static void runCase(BenchOp op, size_t elementSize, size_t n) {
+    void (*run)(BenchOp, size_t, BenchSample *) =
+        elementSize == 4 ? runElem4 : elementSize == 64 ? runElem64 : runElem256;
+    double samples[256];
+    int reps = options.reps;
+    BenchSample sample;
+    unsigned long long allocs = 0;
+    size_t ops = 0;
+    long rss = 0;
+
+    run(op, n, &sample); /* Warmup */
+    for (int r = 0; r < reps; r++) {
+        run(op, n, &sample);
+        samples[r] = sample.seconds * 1e9 / (double)sample.ops;
+        allocs += sample.allocs;
+        ops += sample.ops;
+        rss = sample.rssKb > rss ? sample.rssKb : rss;
+    }
+    qsort(samples, (size_t)reps, sizeof(double), compareDouble);
+
+    BenchResult *result = &results[resultCount++];
+    result->op = opNames[op];
+    result->elementSize = elementSize;
+    result->n = n;
+    result->reps = reps;
+    result->medianNs = reps % 2 ? samples[reps / 2]
+                                : (samples[reps / 2 - 1] + samples[reps / 2]) / 2;
+    result->p99Ns = samples[(reps * 99 + 99) / 100 - 1]; /* Nearest rank */
+    result->allocsPerOp = (double)allocs / (double)ops;
+    result->rssKb = rss;
+    printf("%-15s %5zu B %11zu %12.2f %12.2f %12.4f %10ld\n", result->op, elementSize, n,
+           result->medianNs, result->p99Ns, result->allocsPerOp, result->rssKb);
+    fflush(stdout);
+}
+
+static void writeCsv(const char *path) {
+    FILE *out = fopen(path, "w");
+    if (!out) {
+        perror(path);
+        exit(EXIT_FAILURE);
+    }
+    fprintf(out, "op,element_bytes,n,reps,median_ns,p99_ns,allocs_per_op,rss_kb\n");
+    for (int i = 0; i < resultCount; i++) {
+        const BenchResult *r = &results[i];
+        fprintf(out, "%s,%zu,%zu,%d,%.3f,%.3f,%.6f,%ld\n", r->op, r->elementSize, r->n,
+                r->reps, r->medianNs, r->p99Ns, r->allocsPerOp, r->rssKb);
+    }
+    fclose(out);
+}
+
+static void writeJson(const char *path) {
+    FILE *out = fopen(path, "w");
+    if (!out) {
+        perror(path);
+        exit(EXIT_FAILURE);
+    }
+    fprintf(out, "[\n");
+    for (int i = 0; i < resultCount; i++) {
+        const BenchResult *r = &results[i];
+        fprintf(out, "  {\"op\": \"%s\", \"element_bytes\": %zu, \"n\": %zu, \"reps\": %d, "
+                     "\"median_ns\": %.3f, \"p99_ns\": %.3f, \"allocs_per_op\": %.6f, "
+                     "\"rss_kb\": %ld}%s\n",
+                r->op, r->elementSize, r->n, r->reps, r->medianNs, r->p99Ns,
+                r->allocsPerOp, r->rssKb, i + 1 < resultCount ? "," : "");
+    }
+    fprintf(out, "]\n");
+    fclose(out);
+}
+
+/**
+ * @brief Compares the medians with a baseline CSV written by --csv.
+ * @return The number of cases slower than the baseline by more than the threshold.
+ */
+static int compareBaseline(const char *path) {
+    FILE *in = fopen(path, "r");
+    if (!in) {
+        perror(path);
+        exit(EXIT_FAILURE);
+    }
+    char line[256];
+    char op[64];
+    size_t elementSize;
+    size_t n;
+    double medianNs;
+    int regressions = 0;
+    int compared = 0;
+
+    printf("\nCompared with %s (threshold %.1f%%):\n", path, options.threshold);
+    while (fgets(line, sizeof(line), in)) {
+        if (sscanf(line, "%63[^,],%zu,%zu,%*d,%lf", op, &elementSize, &n, &medianNs) != 4) {
+            continue; /* Header or malformed line */
+        }
+        for (int i = 0; i < resultCount; i++) {
+            const BenchResult *r = &results[i];
+            if (strcmp(r->op, op) != 0 || r->elementSize != elementSize || r->n != n) {
+                continue;
+            }
+            double change = (r->medianNs - medianNs) / medianNs * 100.0;
+            compared++;
+            if (change > options.threshold) {
+                regressions++;
+                printf("REGRESSION %-15s %5zu B %11zu %10.2f -> %10.2f ns/op (%+.1f%%)\n",
+                       op, elementSize, n, medianNs, r->medianNs, change);
+            }
+        }
+    }
+    fclose(in);
+    printf("%d of %d cases regressed\n", regressions, compared);
+    return regressions;
+}
+
+static void usage(const char *program) {
+    fprintf(stderr, "Usage: %s [--reps N] [--max-n N] [--max-bytes N] [--op NAME]\n"
+                    "       [--csv FILE] [--json FILE] [--baseline FILE] [--threshold PCT]\n",
+            program);
+    exit(EXIT_FAILURE);
+}
+
+int main(int argc, char **argv) {
+    static const size_t elementSizes[] = { 4, 64, 256 };
+
+    for (int i = 1; i < argc; i++) {
+        if (i + 1 >= argc) {
+            usage(argv[0]);
+        }
+        const char *value = argv[i + 1];
+        if (strcmp(argv[i], "--reps") == 0) {
+            options.reps = atoi(value);
+        } else if (strcmp(argv[i], "--max-n") == 0) {
+            options.maxN = strtoull(value, NULL, 10);
+        } else if (strcmp(argv[i], "--max-bytes") == 0) {
+            options.maxBytes = strtoull(value, NULL, 10);
+        } else if (strcmp(argv[i], "--op") == 0) {
+            options.op = value;
+        } else if (strcmp(argv[i], "--csv") == 0) {
+            options.csv = value;
+        } else if (strcmp(argv[i], "--json") == 0) {
+            options.json = value;
+        } else if (strcmp(argv[i], "--baseline") == 0) {
+            options.baseline = value;
+        } else if (strcmp(argv[i], "--threshold") == 0) {
+            options.threshold = atof(value);
+        } else {
+            usage(argv[0]);
+        }
+        i++;
+    }
+    if (options.reps < 1 || options.reps > 256) {
+        fprintf(stderr, "--reps must be between 1 and 256\n");
+        return EXIT_FAILURE;
+    }
+
+    printf("%-15s %7s %11s %12s %12s %12s %10s\n", "op", "element", "n",
+           "median ns/op", "p99 ns/op", "allocs/op", "rss KiB");
+    for (int op = 0; op < OP_COUNT; op++) {
+        if (options.op && strcmp(options.op, opNames[op]) != 0) {
+            continue;
+        }
+        for (size_t e = 0; e < sizeof(elementSizes) / sizeof(elementSizes[0]); e++) {
+            for (size_t n = 100; n <= options.maxN && n <= 100000000; n *= 10) {
+                /* Growing and list_TO_ARRAY briefly hold two copies of the elements */
+                if (n * elementSizes[e] * 2 > options.maxBytes ||
+                    (op == OP_ADD_AT_FRONT && n > MAX_ADD_AT_N) ||
+                    resultCount == MAX_RESULTS) {
+                    continue;
+                }
+                runCase((BenchOp)op, elementSizes[e], n);
+            }
+        }
+    }
+
+    if (options.csv) {
+        writeCsv(options.csv);
+    }
+    if (options.json) {
+        writeJson(options.json);
+    }
+    if (options.baseline && compareBaseline(options.baseline) > 0) {
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,113 @@
+/**
+ * @file bench_typed.c
+ * @brief Typed list (list_typed.h) vs generic List for int and Person.
+ * @author Mark Jayson Lanuzo
+ * @date 2026-10-17
+ */
+
+#include "bench.h"
+#include "../list.h"
+#include "../list_typed.h"
+
+LIST_DECLARE(IntList, int)
+LIST_DEFINE(IntList, int)
+
+LIST_DECLARE(PersonList, Person)
+LIST_DEFINE(PersonList, Person)
+
+#define N 10000000
+
+static void benchInt(void) {
+    List generic;
+    IntList typed;
+    double start;
+    long long sum;
+
+    start = benchNow();
+    list_INIT(&generic, int);
+    for (int i = 0; i < N; i++) {
+        list_ADD(&generic, int, i);
+    }
+    benchReport("int    List     add", benchNow() - start, N);
+
+    start = benchNow();
+    IntListInit(&typed);
+    for (int i = 0; i < N; i++) {
+        IntListAdd(&typed, i);
+    }
+    benchReport("int    IntList  add", benchNow() - start, N);
+
+    start = benchNow();
+    sum = 0;
+    for (int i = 0; i < N; i++) {
+        sum += *list_GET(&generic, int, i);
+    }
+    benchSink = sum;
+    benchReport("int    List     get+sum", benchNow() - start, N);
+
+    start = benchNow();
+    sum = 0;
+    for (size_t i = 0; i < typed.count; i++) {
+        sum += *IntListGet(&typed, i);
+    }
+    benchSink = sum;
+    benchReport("int    IntList  get+sum", benchNow() - start, N);
+
+    int last = N - 1;
+    start = benchNow();
+    benchSink = list_GET_INDEX_OF(&generic, int, last);
+    benchReport("int    List     index-of (full scan)", benchNow() - start, N);
+
+    start = benchNow();
+    benchSink = IntListIndexOf(&typed, last);
+    benchReport("int    IntList  index-of (full scan)", benchNow() - start, N);
+
+    listFree(&generic);
+    IntListFree(&typed);
+}
+
+static void benchPersons(void) {
+    List generic;
+    PersonList typed;
+    double start;
+    long long sum;
+
+    start = benchNow();
+    list_INIT(&generic, Person);
+    for (int i = 0; i < N; i++) {
+        list_ADD(&generic, Person, benchPerson(i));
+    }
+    benchReport("Person List     add", benchNow() - start, N);
+
+    start = benchNow();
+    PersonListInit(&typed);
+    for (int i = 0; i < N; i++) {
+        PersonListAdd(&typed, benchPerson(i));
+    }
+    benchReport("Person PersonList add", benchNow() - start, N);
+
+    start = benchNow();
+    sum = 0;
+    for (int i = 0; i < N; i++) {
+        sum += list_GET(&generic, Person, i)->age;
+    }
+    benchSink = sum;
+    benchReport("Person List     get+sum(age)", benchNow() - start, N);
+
+    start = benchNow();
+    sum = 0;
+    for (size_t i = 0; i < typed.count; i++) {
+        sum += PersonListGet(&typed, i)->age;
+    }
+    benchSink = sum;
+    benchReport("Person PersonList get+sum(age)", benchNow() - start, N);
+
+    listFree(&generic);
+    PersonListFree(&typed);
+}
+
+int main(void) {
+    benchInt();
+    benchPersons();
+    return 0;
+}
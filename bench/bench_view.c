@@ -0,0 +1,85 @@
+/**
+ * @file bench_view.c
+ * @brief Copies (list_TO_ARRAY, list_COLLECT_TO_SUBLIST) vs views and selections on Person records.
+ * @author Mark Jayson Lanuzo
+ * @date 2026-10-17
+ */
+
+#include "bench.h"
+#include "../list.h"
+
+#define N 2000000
+#define ROUNDS 10
+
+static void reportBytes(const char *name, size_t bytes) {
+    printf("%-40s %10.1f MiB allocated\n", name, (double)bytes / (1024.0 * 1024.0));
+}
+
+int main(void) {
+    List people;
+    double start;
+    long long ages;
+
+    list_INIT_WITH_CAPACITY(&people, Person, N);
+    for (int i = 0; i < N; i++) {
+        list_ADD(&people, Person, benchPerson(i));
+    }
+
+    /* Read the ages of the middle half */
+    start = benchNow();
+    for (int round = 0; round < ROUNDS; round++) {
+        Person *array = list_TO_ARRAY(&people, Person);
+        ages = 0;
+        for (int i = N / 4; i < 3 * N / 4; i++) {
+            ages += array[i].age;
+        }
+        benchSink += ages;
+        free(array);
+    }
+    benchReport("range: list_TO_ARRAY", benchNow() - start, (size_t)ROUNDS * N / 2);
+    reportBytes("range: list_TO_ARRAY (per round)", listSizeOfData(&people));
+
+    start = benchNow();
+    for (int round = 0; round < ROUNDS; round++) {
+        ListView middle = listSlice(&people, N / 4, N / 2);
+        ages = 0;
+        list_FOR_EACH(&middle, Person, ages += element->age);
+        benchSink += ages;
+    }
+    benchReport("range: listSlice", benchNow() - start, (size_t)ROUNDS * N / 2);
+    reportBytes("range: listSlice (per round)", 0);
+
+    /* Filter, then read the selected ages */
+    size_t sublistBytes = 0;
+    start = benchNow();
+    for (int round = 0; round < ROUNDS; round++) {
+        List olderPeople;
+        list_COLLECT_TO_SUBLIST(&people, Person, element->age > 30, &olderPeople);
+        ages = 0;
+        list_FOR_EACH(&olderPeople, Person, ages += element->age);
+        benchSink += ages;
+        sublistBytes = listSizeOf(&olderPeople);
+        listFree(&olderPeople);
+    }
+    benchReport("filter: list_COLLECT_TO_SUBLIST", benchNow() - start, (size_t)ROUNDS * N);
+    reportBytes("filter: list_COLLECT_TO_SUBLIST (per round)", sublistBytes);
+
+    ListSelection selection;
+    listSelectionInit(&selection);
+    start = benchNow();
+    for (int round = 0; round < ROUNDS; round++) {
+        list_SELECT(&people, Person, element->age > 30, &selection);
+        ages = 0;
+        for (int i = 0; i < selection.currentCount; i++) {
+            ages += ((Person *)list_AT(&people, (int)selection.positions[i]))->age;
+        }
+        benchSink += ages;
+    }
+    benchReport("filter: list_SELECT", benchNow() - start, (size_t)ROUNDS * N);
+    reportBytes("filter: list_SELECT (first round)", selection.capacity * sizeof(uint32_t));
+    reportBytes("filter: list_SELECT (later rounds)", 0);
+
+    listSelectionFree(&selection);
+    listFree(&people);
+    return 0;
+}
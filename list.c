@@ -4,6 +4,32 @@
 
 #include "list.h"
 
+/**
+ * @brief Releases a buffer previously used by the list.
+ * @param list A pointer to the List.
+ * @param allocator The allocator the buffer came from, or NULL for malloc.
+ * @param data The buffer to release; the inline buffer is ignored and a file
+ *             mapping is unmapped.
+ * @param size The size of the buffer in bytes.
+ */
+static void listReleaseBuffer(List *list, const ListAllocator *allocator, void *data, size_t size) {
+    if (list->mapping && data == (char *)list->mapping + LIST_FILE_HEADER_SIZE) {
+        listUnmap(list);
+        return;
+    }
+#if LIST_INLINE_BYTES > 0
+    if (data == (void *)list->inlineData) {
+        return;
+    }
+#else
+    (void)list;
+#endif
+    if (allocator) {
+        allocator->free(allocator->context, data, size);
+    } else {
+        free(data);
+    }
+}
 
 
 /**
@@ -52,8 +78,19 @@ char *listGetDataType(List *list) {
  * @note This function sets pointers to NULL after freeing to avoid dangling references.
  */
 void listFree(List *list) {
+    listDisableIndex(list);
+#ifdef LIST_STATS
+    listStatsRelease(list);
+#endif
+    if (list->oldData) {
+        listReleaseBuffer(list, list->allocator, list->oldData, list->oldListSize);
+        list->oldData = NULL;
+        list->migrated = 0;
+        list->migrateEnd = 0;
+    }
     if (list->data) {
-        free(list->data);
+        listReleaseBuffer(list, list->allocator, list->data, list->listSize);
+        list->data = NULL;
     }
     if (list->nameOf) {
         list->nameOf = NULL;
@@ -64,8 +101,11 @@ void listFree(List *list) {
 
     // Reset list properties
     list->currentCount = 0;
+    list->head = 0;
     list->initSize = 0;
     list->size = 0;
+    list->dataSize = 0;
+    list->listSize = 0;
 }
 
 /**
@@ -79,7 +119,8 @@ void *listGetMemoryAddress(List *list, int index) {
         printf("Invalid index: %d\n", index);
         return NULL;
     }
-    return (void *)((char *)(list->data) + (index * list->size));
+    list->sorted = false; /* the element may be edited through the pointer */
+    return listAt(list, index);
 }
 
 /**
@@ -108,3 +149,503 @@ size_t listSizeOf(List *list) {
 size_t listSizeOfData(List *list) {
     return list ? list->dataSize : 0;
 }
+
+/**
+ * @brief Checks if the list stores its elements in its inline buffer.
+ * @param list A pointer to the List.
+ * @return true if no heap block is in use.
+ */
+bool listIsInline(List *list) {
+#if LIST_INLINE_BYTES > 0
+    return list->data == (void *)list->inlineData;
+#else
+    (void)list;
+    return false;
+#endif
+}
+
+/**
+ * @brief Sets up the element buffer of a freshly initialized list.
+ * @param list A pointer to the List, with size and allocator already set.
+ * @param capacity The requested capacity in elements.
+ *
+ * Requests up to LIST_DEFAULT_CAPACITY elements, or that fit in LIST_INLINE_BYTES,
+ * use the inline buffer with as many elements as fit there. Larger requests and
+ * elements bigger than the inline buffer are allocated.
+ */
+void listInitBuffer(List *list, size_t capacity) {
+#if LIST_INLINE_BYTES > 0
+    size_t inlineCapacity = LIST_INLINE_BYTES / list->size;
+    if (inlineCapacity > 0 && (capacity <= LIST_DEFAULT_CAPACITY || capacity <= inlineCapacity)) {
+        list->data = list->inlineData;
+        list->initSize = (int)inlineCapacity;
+        list->listSize = inlineCapacity * list->size;
+        LIST_STAT_PEAK(list);
+        return;
+    }
+#endif
+    list->initSize = (int)capacity;
+    list->listSize = capacity * list->size;
+    list->data = listAllocate(list, list->listSize);
+    LIST_STAT_PEAK(list);
+}
+
+/**
+ * @brief Allocates size bytes for the element buffer of the list.
+ * @param list A pointer to the List, with its allocator already set.
+ * @param size The number of bytes to allocate.
+ * @return The new block. Exits the program if the allocation fails.
+ */
+void *listAllocate(List *list, size_t size) {
+    void *data = list->allocator ? list->allocator->alloc(list->allocator->context, size)
+                                 : malloc(size);
+    if (!data) {
+        fprintf(stderr, "Memory allocation failed\n");
+        exit(EXIT_FAILURE);
+    }
+    return data;
+}
+
+/**
+ * @brief Moves the element buffer of the list to another allocator.
+ * @param list A pointer to the List.
+ * @param allocator The new allocator, or NULL for malloc.
+ */
+void listSetAllocator(List *list, const ListAllocator *allocator) {
+    if (list->allocator == allocator) {
+        return;
+    }
+    if (listIsInline(list)) {
+        list->allocator = allocator;
+        return;
+    }
+    listLinearize(list);
+    const ListAllocator *old = list->allocator;
+    void *oldData = list->data;
+
+    list->allocator = allocator;
+    list->data = listAllocate(list, list->listSize);
+    memcpy(list->data, oldData, list->dataSize);
+    LIST_STAT_COPIED(list, list->dataSize);
+    listReleaseBuffer(list, old, oldData, list->listSize);
+}
+
+/**
+ * @brief Resizes the list buffer to hold exactly capacity elements.
+ * @param list A pointer to the List.
+ * @param capacity The new capacity in elements.
+ */
+static void listResizeTo(List *list, size_t capacity) {
+    listLinearize(list);
+    if (listIsInline(list) || list->mapping) {
+        void *heap = listAllocate(list, capacity * list->size);
+        memcpy(heap, list->data, list->dataSize);
+        listReleaseBuffer(list, list->allocator, list->data, list->listSize);
+        list->data = heap;
+        list->initSize = (int)capacity;
+        list->listSize = capacity * list->size;
+        LIST_STAT_REALLOC(list);
+        LIST_STAT_COPIED(list, list->dataSize);
+        LIST_STAT_PEAK(list);
+        return;
+    }
+    void *temp = list->allocator
+        ? list->allocator->realloc(list->allocator->context, list->data,
+                                   list->listSize, capacity * list->size)
+        : realloc(list->data, capacity * list->size);
+    if (!temp) {
+        fprintf(stderr, "Memory allocation failed\n");
+        exit(EXIT_FAILURE);
+    }
+    list->data = temp;
+    list->initSize = (int)capacity;
+    list->listSize = capacity * list->size;
+    LIST_STAT_REALLOC(list);
+    LIST_STAT_COPIED(list, list->dataSize);
+    LIST_STAT_PEAK(list);
+}
+
+/**
+ * @brief Switches to a new buffer of capacity elements and leaves the elements
+ *        in the old one, to be migrated by listResizeStep.
+ */
+static void listStartResize(List *list, size_t capacity) {
+    listLinearize(list);
+    list->oldData = list->data;
+    list->oldListSize = list->listSize;
+    list->data = listAllocate(list, capacity * list->size);
+    list->initSize = (int)capacity;
+    list->listSize = capacity * list->size;
+    list->migrated = 0;
+    list->migrateEnd = list->currentCount;
+    LIST_STAT_REALLOC(list);
+    LIST_STAT_PEAK(list);
+}
+
+/**
+ * @brief Grows the list so it can hold at least minCapacity elements.
+ * @param list A pointer to the List.
+ * @param minCapacity The number of elements the list must be able to hold.
+ *
+ * The capacity follows the growth policy of the list until it reaches
+ * minCapacity, so a large batch triggers one reallocation.
+ */
+void listGrow(List *list, size_t minCapacity) {
+    if (minCapacity <= (size_t)list->initSize) {
+        return;
+    }
+    size_t capacity = list->initSize > 0 ? (size_t)list->initSize : 1;
+    if (listIsInline(list) && capacity < LIST_DEFAULT_CAPACITY) {
+        capacity = LIST_DEFAULT_CAPACITY;
+    }
+    switch (list->growthPolicy) {
+    case LIST_GROW_LINEAR: {
+        size_t step = list->growthStep > 0 ? list->growthStep : LIST_DEFAULT_CAPACITY;
+        if (capacity < minCapacity) {
+            capacity += ((minCapacity - capacity + step - 1) / step) * step;
+        }
+        break;
+    }
+    case LIST_GROW_HALF:
+        while (capacity < minCapacity) {
+            capacity += capacity / 2 + 1;
+        }
+        break;
+    default:
+        while (capacity < minCapacity) {
+            capacity *= 2;
+        }
+        break;
+    }
+    if (list->incrementalResize && list->currentCount > 0 && !listIsInline(list) &&
+        !list->mapping) {
+        listStartResize(list, capacity);
+        return;
+    }
+    listResizeTo(list, capacity);
+}
+
+/**
+ * @brief Turns incremental resizing on or off.
+ * @param list A pointer to the List.
+ * @param enabled true to grow by moving LIST_RESIZE_STEP elements per add.
+ *
+ * When enabled, growing allocates the new buffer and leaves the elements in
+ * the old one; every list_ADD then copies LIST_RESIZE_STEP of them over, and
+ * list_GET reads the ones not copied yet from the old buffer. No single add
+ * copies the whole list. Turning it off finishes a pending migration.
+ */
+void listSetIncrementalResize(List *list, bool enabled) {
+    list->incrementalResize = enabled;
+    if (!enabled && list->migrateEnd) {
+        listResizeStep(list, list->migrateEnd);
+    }
+}
+
+/**
+ * @brief Migrates up to budget elements of a pending incremental resize.
+ * @param list A pointer to the List.
+ * @param budget The largest number of elements to copy.
+ * @return The number of elements still to migrate, 0 when the resize is done.
+ *
+ * Called by list_ADD; call it from idle time to finish a resize early. The old
+ * buffer is released with the last element.
+ */
+int listResizeStep(List *list, int budget) {
+    int count = list->migrateEnd - list->migrated;
+    if (count > budget) {
+        count = budget;
+    }
+    if (count > 0) {
+        size_t offset = (size_t)list->migrated * list->size;
+        memcpy((char *)list->data + offset, (char *)list->oldData + offset,
+               (size_t)count * list->size);
+        LIST_STAT_COPIED(list, (size_t)count * list->size);
+        list->migrated += count;
+    }
+    if (list->migrateEnd && list->migrated == list->migrateEnd) {
+        listReleaseBuffer(list, list->allocator, list->oldData, list->oldListSize);
+        list->oldData = NULL;
+        list->oldListSize = 0;
+        list->migrated = 0;
+        list->migrateEnd = 0;
+    }
+    return list->migrateEnd - list->migrated;
+}
+
+/**
+ * @brief Sets how the list grows when it runs out of room.
+ * @param list A pointer to the List.
+ * @param policy LIST_GROW_DOUBLE, LIST_GROW_HALF or LIST_GROW_LINEAR.
+ * @param step Elements added per growth with LIST_GROW_LINEAR (0 for
+ *             LIST_DEFAULT_CAPACITY); ignored by the other policies.
+ */
+void listSetGrowthPolicy(List *list, ListGrowthPolicy policy, size_t step) {
+    list->growthPolicy = policy;
+    list->growthStep = step;
+}
+
+/**
+ * @brief Reduces the buffer to the number of elements in the list.
+ * @param list A pointer to the List.
+ *
+ * A list that fits in the inline buffer moves back into it and releases its
+ * heap block. listSizeOf reports the new size.
+ */
+void listShrinkToFit(List *list) {
+    size_t capacity = list->currentCount > 0 ? (size_t)list->currentCount : 1;
+    if (listIsInline(list)) {
+        return;
+    }
+    listLinearize(list);
+#if LIST_INLINE_BYTES > 0
+    if (capacity * list->size <= LIST_INLINE_BYTES) {
+        void *heap = list->data;
+        memcpy(list->inlineData, heap, list->dataSize);
+        LIST_STAT_COPIED(list, list->dataSize);
+        list->data = list->inlineData;
+        listReleaseBuffer(list, list->allocator, heap, list->listSize);
+        list->initSize = (int)(LIST_INLINE_BYTES / list->size);
+        list->listSize = (size_t)list->initSize * list->size;
+        return;
+    }
+#endif
+    if (capacity < (size_t)list->initSize) {
+        listResizeTo(list, capacity);
+    }
+}
+
+/**
+ * @brief Enables or disables shrinking after removals.
+ * @param list A pointer to the List.
+ * @param enabled true to shrink the buffer when it drops below 1/4 full.
+ *
+ * The buffer is shrunk to half full, so the list has to double or halve again
+ * before the next reallocation and alternating adds and removes do not thrash.
+ */
+void listSetAutoShrink(List *list, bool enabled) {
+    list->autoShrink = enabled;
+    if (enabled) {
+        listMaybeShrink(list);
+    }
+}
+
+/**
+ * @brief Shrinks the buffer to half full if it is less than 1/4 full.
+ * @param list A pointer to the List.
+ *
+ * Called by the remove macros when auto shrink is enabled. Buffers of up to
+ * LIST_DEFAULT_CAPACITY elements are left alone.
+ */
+void listMaybeShrink(List *list) {
+    size_t capacity = (size_t)list->initSize;
+    size_t count = (size_t)list->currentCount;
+    if (listIsInline(list) || capacity <= LIST_DEFAULT_CAPACITY || count * 4 >= capacity) {
+        return;
+    }
+    size_t target = count * 2 > LIST_DEFAULT_CAPACITY ? count * 2 : LIST_DEFAULT_CAPACITY;
+#if LIST_INLINE_BYTES > 0
+    if (count * list->size <= LIST_INLINE_BYTES) {
+        listShrinkToFit(list);
+        return;
+    }
+#endif
+    listResizeTo(list, target);
+}
+
+/**
+ * @brief Makes sure the list can hold at least capacity elements without reallocating.
+ * @param list A pointer to the List.
+ * @param capacity The number of elements to reserve room for.
+ */
+void listReserve(List *list, size_t capacity) {
+    if (capacity > (size_t)list->initSize) {
+        listResizeTo(list, capacity);
+    }
+}
+
+/**
+ * @brief Moves the elements of a list used as a deque back to the start of its buffer.
+ * @param list A pointer to the List.
+ *
+ * Also finishes a pending incremental resize. Does nothing unless
+ * list_PUSH_FRONT or list_POP_FRONT moved the head. Called
+ * by every operation that works on the buffer as one contiguous array. A ring
+ * that wraps around the end is rotated through a temporary copy of its
+ * shorter part.
+ */
+void listLinearize(List *list) {
+    if (list->migrateEnd) {
+        listResizeStep(list, list->migrateEnd);
+    }
+    if (list->head == 0) {
+        return;
+    }
+    char *data = list->data;
+    size_t size = list->size;
+    size_t head = (size_t)list->head;
+    size_t count = (size_t)list->currentCount;
+    size_t capacity = (size_t)list->initSize;
+
+    if (head + count <= capacity) {
+        memmove(data, data + head * size, count * size);
+    } else {
+        size_t front = capacity - head;    /* Elements from the head to the buffer end */
+        size_t wrapped = count - front;    /* Elements at the start of the buffer */
+        size_t saved = front < wrapped ? front : wrapped;
+        char *temp = malloc(saved * size);
+        if (!temp) {
+            fprintf(stderr, "Memory allocation failed\n");
+            exit(EXIT_FAILURE);
+        }
+        if (wrapped <= front) {
+            memcpy(temp, data, wrapped * size);
+            memmove(data, data + head * size, front * size);
+            memcpy(data + front * size, temp, wrapped * size);
+        } else {
+            memcpy(temp, data + head * size, front * size);
+            memmove(data + front * size, data, wrapped * size);
+            memcpy(data, temp, front * size);
+        }
+        free(temp);
+    }
+    LIST_STAT_MOVED(list, count * size);
+    list->head = 0;
+}
+
+/**
+ * @brief Appends count elements from src to the end of the list.
+ * @param list A pointer to the List.
+ * @param src A pointer to the first element to append.
+ * @param count The number of elements to append.
+ *
+ * The buffer is sized once and all elements are copied with a single memcpy.
+ */
+void listAppendRange(List *list, const void *src, size_t count) {
+    if (count == 0) {
+        return;
+    }
+    listGrow(list, (size_t)list->currentCount + count);
+    listLinearize(list);
+    memcpy((char *)list->data + ((size_t)list->currentCount * list->size), src, count * list->size);
+    list->currentCount += (int)count;
+    list->dataSize = list->currentCount * list->size;
+    list->sorted = false;
+    if (list->hashIndex) {
+        for (int i = list->currentCount - (int)count; i < list->currentCount; i++) {
+            listIndexLink(list, i);
+        }
+    }
+}
+
+/**
+ * @brief Orders the packed (index, input position) keys of listInsertBatch.
+ */
+static int listCompareKeys(const void *left, const void *right) {
+    uint64_t a = *(const uint64_t *)left;
+    uint64_t b = *(const uint64_t *)right;
+    return (a > b) - (a < b);
+}
+
+/**
+ * @brief Inserts k elements at k positions with one pass over the list.
+ * @param list A pointer to the List.
+ * @param indices The position of each new element, counted in the list before
+ *                the call (0 to listLength); any order, repeats allowed.
+ * @param elems The k new elements, elems[i] going before the element now at indices[i].
+ * @param k The number of elements to insert.
+ *
+ * Calling list_ADD_AT k times moves the tail k times, O(n * k). Here the
+ * positions are sorted, the buffer grows once and is filled from the back, so
+ * every existing element moves at most once: O(n + k log k). New elements with
+ * the same index keep their order in elems. Nothing is inserted if an index is
+ * out of range.
+ */
+void listInsertBatch(List *list, const size_t *indices, const void *elems, size_t k) {
+    if (k == 0) {
+        return;
+    }
+    size_t count = (size_t)list->currentCount;
+    for (size_t i = 0; i < k; i++) {
+        if (indices[i] > count) {
+            printf("Invalid index: %zu\n", indices[i]);
+            return;
+        }
+    }
+
+    /* Index in the high half, input position in the low half: sorting the keys
+     * orders by index and keeps input order among equal indexes. */
+    uint64_t *keys = malloc(k * sizeof(uint64_t));
+    if (!keys) {
+        fprintf(stderr, "Memory allocation failed\n");
+        exit(EXIT_FAILURE);
+    }
+    bool ordered = true;
+    for (size_t i = 0; i < k; i++) {
+        keys[i] = ((uint64_t)indices[i] << 32) | i;
+        ordered = ordered && (i == 0 || indices[i - 1] <= indices[i]);
+    }
+    if (!ordered) {
+        qsort(keys, k, sizeof(uint64_t), listCompareKeys);
+    }
+
+    listGrow(list, count + k);
+    listLinearize(list);
+    char *data = list->data;
+    size_t size = list->size;
+    size_t end = count; /* Existing elements in [0, end) have not moved yet */
+    for (size_t j = k; j-- > 0;) {
+        size_t index = (size_t)(keys[j] >> 32);
+        size_t input = (size_t)(keys[j] & 0xFFFFFFFFu);
+        memmove(data + (index + j + 1) * size, data + index * size, (end - index) * size);
+        LIST_STAT_MOVED(list, (end - index) * size);
+        memcpy(data + (index + j) * size, (const char *)elems + input * size, size);
+        end = index;
+    }
+    free(keys);
+
+    list->currentCount += (int)k;
+    list->dataSize = list->currentCount * list->size;
+    list->sorted = false;
+    if (list->hashIndex) {
+        listIndexRebuild(list);
+    }
+}
+
+/**
+ * @brief Finds the index of the first element equal to value.
+ * @param list A pointer to the List.
+ * @param value A pointer to the element to search for.
+ * @return The index of the element, or -1 if the element is not found.
+ *
+ * Uses the hash index when one is enabled, a binary search when the list was
+ * sorted with listSort, the equality registered for the data type (see
+ * listRegisterType) if any, otherwise scans the list with the search kernels.
+ * Reads a ring or a pending incremental resize in place (see listRun), so a
+ * lookup never pays for finishing a migration.
+ */
+int listIndexOf(List *list, const void *value) {
+    if (list->hashIndex) {
+        return listIndexFind(list, value);
+    }
+    if (list->sorted) {
+        return listSortedIndexOf(list, value);
+    }
+    if (list->equals) {
+        int run;
+        for (int i = 0; i < list->currentCount; i += run) {
+            const char *element = listRun(list, i, &run);
+            for (int j = 0; j < run; j++, element += list->size) {
+                if (list->equals(element, value, list->size)) {
+                    LIST_STAT_COMPARED(list, i + j + 1);
+                    return i + j;
+                }
+            }
+        }
+        LIST_STAT_COMPARED(list, list->currentCount);
+        return -1;
+    }
+    int index = listFindFirst(list, value);
+    LIST_STAT_COMPARED(list, index == -1 ? list->currentCount : index + 1);
+    return index;
+}
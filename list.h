@@ -12,6 +12,177 @@
 #include <stdlib.h>
 #include <string.h>
 #include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * @brief Number of bytes stored inline in every List before spilling to the heap.
+ *
+ * 0 (the default) disables the inline buffer. Define it, for example to 64,
+ * before including list.h (for every translation unit) to let lists whose
+ * elements fit start in this buffer and only allocate when they grow past it.
+ * A List then may point into itself and must not be copied by value.
+ */
+#ifndef LIST_INLINE_BYTES
+#define LIST_INLINE_BYTES 0
+#endif
+
+/**
+ * @brief Hash callback used by the list index.
+ * @param element A pointer to the element to hash.
+ * @param size The size of the element in bytes.
+ */
+typedef size_t (*ListHashFn)(const void *element, size_t size);
+
+/**
+ * @brief Equality callback used by the list index.
+ * @param a A pointer to the first element.
+ * @param b A pointer to the second element.
+ * @param size The size of the elements in bytes.
+ * @return true if the elements are equal.
+ */
+typedef bool (*ListEqualsFn)(const void *a, const void *b, size_t size);
+
+/**
+ * @brief Primitive element kinds recognized from the data type given to list_INIT.
+ */
+typedef enum ListKind {
+    LIST_KIND_OTHER,     /**< Struct or any other non-primitive type */
+    LIST_KIND_I32,       /**< int, int32_t */
+    LIST_KIND_U32,       /**< unsigned int, uint32_t */
+    LIST_KIND_I64,       /**< long long, int64_t (and long on LP64) */
+    LIST_KIND_U64,       /**< unsigned long long, uint64_t, size_t */
+    LIST_KIND_F32,       /**< float */
+    LIST_KIND_F64,       /**< double */
+    LIST_KIND_PTR        /**< Any pointer type */
+} ListKind;
+
+/**
+ * @brief Instruction sets used by the search and reduction kernels.
+ */
+typedef enum ListSimdLevel {
+    LIST_SIMD_SCALAR,    /**< Portable C loops */
+    LIST_SIMD_SSE2,      /**< 128-bit SSE2 */
+    LIST_SIMD_AVX2       /**< 256-bit AVX2 */
+} ListSimdLevel;
+
+/**
+ * @brief How a list computes its new capacity when it runs out of room.
+ */
+typedef enum ListGrowthPolicy {
+    LIST_GROW_DOUBLE,    /**< Double the capacity (default) */
+    LIST_GROW_HALF,      /**< Grow the capacity by 1.5x */
+    LIST_GROW_LINEAR     /**< Add a fixed number of elements */
+} ListGrowthPolicy;
+
+/**
+ * @brief Memory allocator used by a list for its element buffer.
+ *
+ * Every callback receives the context pointer. realloc and free also receive the
+ * size of the block, so simple backends do not need to store it themselves.
+ */
+typedef struct ListAllocator {
+    void *(*alloc)(void *context, size_t size);                           /**< Allocates size bytes */
+    void *(*realloc)(void *context, void *ptr, size_t oldSize, size_t newSize); /**< Resizes a block */
+    void (*free)(void *context, void *ptr, size_t size);                  /**< Releases a block */
+    void *context;                                                        /**< Backend state */
+} ListAllocator;
+
+/**
+ * @brief Bump arena: allocations are carved from large blocks and freed all at once.
+ */
+typedef struct ListArena {
+    struct ListArenaBlock *blocks; /**< Block currently allocated from, linked to older blocks */
+    size_t blockSize;              /**< Default size of a new block in bytes */
+    void *last;                    /**< Most recent allocation, can be grown or released in place */
+    ListAllocator allocator;       /**< Allocator handed to lists */
+} ListArena;
+
+/** Number of size classes in a ListPool (16 bytes up to 64 KiB). */
+#define LIST_POOL_CLASSES 13
+
+/**
+ * @brief Size-class pool: blocks are recycled through per-class free lists.
+ */
+typedef struct ListPool {
+    void *freeLists[LIST_POOL_CLASSES]; /**< Free blocks of each size class */
+    struct ListPoolSlab *slabs;         /**< Memory the blocks are carved from */
+    ListAllocator allocator;            /**< Allocator handed to lists */
+} ListPool;
+
+/**
+ * @brief Predicate used by the parallel list operations.
+ * @param element A pointer to the element to test.
+ * @param context The context pointer given to the operation.
+ * @return true to select the element.
+ */
+typedef bool (*ListPredicate)(const void *element, void *context);
+
+/**
+ * @brief Per-element action used by list_PAR_FOR_EACH.
+ * @param element A pointer to the element, which may be modified in place.
+ * @param context The context pointer given to the operation.
+ */
+typedef void (*ListAction)(void *element, void *context);
+
+/**
+ * @brief Kinds of fields in a ListSchema.
+ */
+typedef enum ListFieldKind {
+    LIST_FIELD_SCALAR,   /**< Bytes copied as is: numbers, chars, arrays, flat structs */
+    LIST_FIELD_STRING,   /**< char * to a NUL-terminated string, or NULL */
+    LIST_FIELD_STRUCT    /**< Nested struct described by its own schema */
+} ListFieldKind;
+
+/**
+ * @brief One field of a ListSchema. Use list_FIELD, list_FIELD_STRING or list_FIELD_STRUCT.
+ */
+typedef struct ListField {
+    ListFieldKind kind;             /**< How the field is encoded */
+    size_t offset;                  /**< Offset of the field in its struct */
+    size_t size;                    /**< Size of the field in bytes */
+    const struct ListSchema *schema; /**< Schema of a LIST_FIELD_STRUCT field */
+} ListField;
+
+/**
+ * @brief Layout of a data type for the streaming encoder. Use list_SCHEMA.
+ */
+typedef struct ListSchema {
+    const char *name;        /**< Data type name, as given to list_INIT */
+    size_t size;             /**< Size of the data type */
+    const ListField *fields; /**< Fields to encode, in order */
+    int fieldCount;          /**< Number of fields */
+} ListSchema;
+
+/**
+ * @brief Operations counted per list when built with -DLIST_STATS.
+ */
+typedef enum ListStatsOp {
+    LIST_OP_INIT, LIST_OP_ADD, LIST_OP_ADD_ALL, LIST_OP_ADD_AT, LIST_OP_REMOVE,
+    LIST_OP_REMOVE_AT, LIST_OP_SWAP_REMOVE_AT, LIST_OP_REMOVE_IF, LIST_OP_GET,
+    LIST_OP_SET, LIST_OP_GET_INDEX_OF, LIST_OP_CONTAINS, LIST_OP_TO_ARRAY,
+    LIST_OP_COLLECT, LIST_OP_SORT, LIST_OP_SORT_STABLE, LIST_OP_BINARY_SEARCH,
+    LIST_OP_PUSH_FRONT, LIST_OP_POP_FRONT, LIST_OP_POP_BACK, LIST_OP_FOR_EACH,
+    LIST_OP_SELECT, LIST_OP_PAR_COLLECT, LIST_OP_PAR_FOR_EACH, LIST_OP_MERGE_SORTED,
+    LIST_OP_PIPE,
+    LIST_OP_COUNT        /**< Number of counted operations */
+} ListStatsOp;
+
+/**
+ * @brief Counters shared by every list with the same name (see listGetName).
+ */
+typedef struct ListStats {
+    char *name;          /**< Name of the lists, as given to list_INIT */
+    char *dataTypeOf;    /**< Data type of the first list registered under the name */
+    unsigned long long calls[LIST_OP_COUNT]; /**< Calls per macro */
+    unsigned long long reallocs;    /**< Buffer reallocations */
+    unsigned long long bytesCopied; /**< Bytes copied into new buffers */
+    unsigned long long bytesMoved;  /**< Bytes shifted inside the buffer */
+    unsigned long long comparisons; /**< Elements compared by list_GET_INDEX_OF / list_CONTAINS */
+    size_t peakListSize; /**< Largest buffer size in bytes */
+    int liveLists;       /**< Lists with this name initialized and not yet freed */
+    struct ListStats *next; /**< Next entry of the registry */
+} ListStats;
 
 typedef struct List {
     void *data;          /**< Pointer to the stored data */
@@ -22,30 +193,641 @@ typedef struct List {
     size_t size;         /**< Size of each element */
     size_t dataSize;     /**< Actual size of stored data in bytes */
     size_t listSize;     /**< Total allocated memory size in bytes */
+    struct ListIndex *hashIndex; /**< Optional hash index, NULL when disabled */
+    ListEqualsFn equals; /**< Equality registered for the data type, NULL to compare bytes */
+    ListHashFn hash;     /**< Hash registered for the data type, NULL to hash bytes */
+    ListKind elementKind; /**< Primitive kind of the elements, used by the kernels */
+    const ListAllocator *allocator; /**< Allocator of the data buffer, NULL for malloc */
+    ListGrowthPolicy growthPolicy; /**< How the capacity grows */
+    size_t growthStep;   /**< Elements added per growth with LIST_GROW_LINEAR */
+    bool autoShrink;     /**< Shrink the buffer when it drops below 1/4 full */
+    bool sorted;         /**< Set by listSort, cleared by any change to the order */
+    int head;            /**< Buffer slot of element 0; nonzero only after front pushes/pops */
+    bool incrementalResize; /**< Grow by migrating a few elements per add */
+    void *oldData;       /**< Buffer being migrated from, NULL when no resize is pending */
+    size_t oldListSize;  /**< Size of oldData in bytes */
+    int migrated;        /**< Elements already copied from oldData */
+    int migrateEnd;      /**< Elements to copy from oldData, 0 when no resize is pending */
+    void *mapping;       /**< File mapping the elements live in, NULL if none */
+    size_t mappingSize;  /**< Size of the file mapping in bytes */
+#ifdef LIST_STATS
+    ListStats *stats;    /**< Counters of the list, shared by lists with the same name */
+#endif
+#if LIST_INLINE_BYTES > 0
+    _Alignas(max_align_t) unsigned char inlineData[LIST_INLINE_BYTES]; /**< Small-buffer storage */
+#endif
 } List;
 
+/**
+ * @brief Borrowed read-only window over elements of a List.
+ *
+ * A view does not own its elements: it points into the buffer of the list it was
+ * taken from and is invalidated when that list grows, shrinks or is freed. The
+ * read-only macros (list_GET, list_GET_INDEX_OF, list_CONTAINS, list_FOR_EACH,
+ * list_SELECT) accept a ListView pointer wherever they accept a List pointer.
+ * Lookups on a view compare with the equality of its list (see listRegisterType).
+ */
+typedef struct ListView {
+    void *data;          /**< Pointer to the first element of the view */
+    int currentCount;    /**< Number of elements in the view */
+    size_t size;         /**< Size of each element */
+    size_t stride;       /**< Distance between two elements in bytes */
+    ListKind elementKind; /**< Primitive kind of the elements, used by the kernels */
+    ListEqualsFn equals;  /**< Equality registered for the data type, NULL for bytewise */
+} ListView;
+
+/**
+ * @brief Positions of the elements selected by list_SELECT.
+ *
+ * The buffer is kept between calls, so filtering the same list again does not
+ * allocate once the selection is large enough.
+ */
+typedef struct ListSelection {
+    uint32_t *positions; /**< Selected positions, in increasing order */
+    int currentCount;    /**< Number of selected positions */
+    int capacity;        /**< Allocated size (number of positions) */
+} ListSelection;
+
+/**
+ * @brief Columnar list: each field of a ListSchema lives in its own array.
+ *
+ * Rows are scattered into the columns on add and gathered back into a struct
+ * on get, so a scan over one field touches only that field's memory.
+ */
+typedef struct ListSoA {
+    unsigned char **columns; /**< One buffer per schema field, in schema order */
+    int currentCount;    /**< Number of rows currently in the list */
+    int initSize;        /**< Allocated size of every column (number of rows) */
+    char *dataTypeOf;    /**< Data type of the rows */
+    char *nameOf;        /**< Name of the list */
+    size_t size;         /**< Size of a row struct */
+    const ListSchema *schema; /**< Fields stored as columns */
+} ListSoA;
+
+/** log2 of the capacity of the first segment of a segmented list. */
+#define LIST_SEGMENT_SHIFT 6
+
+/** Number of segments needed to address every non-negative int index. */
+#define LIST_SEGMENT_COUNT (32 - LIST_SEGMENT_SHIFT)
+
+/**
+ * @brief List that threads can append to and read from without a lock.
+ *
+ * Elements live in segments of 64, 128, 256, ... elements that are allocated
+ * once and never moved or freed before listConcurrentFree, so the address of
+ * an element stays valid while other threads keep appending.
+ */
+typedef struct ListConcurrent {
+    unsigned char *segments[LIST_SEGMENT_COUNT]; /**< Segment directory, set atomically */
+    int reserved;        /**< Slots handed out so far, updated atomically */
+    char *dataTypeOf;    /**< Data type of the elements */
+    char *nameOf;        /**< Name of the list */
+    size_t size;         /**< Size of each element */
+} ListConcurrent;
+
+/**
+ * @brief List whose elements never move: it grows by adding segments, not by realloc.
+ *
+ * Segment s holds 2^(s + LIST_SEGMENT_SHIFT) elements. Adding never copies
+ * existing elements, so a pointer from list_SEG_GET stays valid across adds
+ * (removals still shift the elements after the removed one).
+ */
+typedef struct ListSegmented {
+    unsigned char *segments[LIST_SEGMENT_COUNT]; /**< Segment directory, NULL past the last */
+    int currentCount;    /**< Number of elements currently in the list */
+    int initSize;        /**< Allocated size of all segments (number of elements) */
+    char *dataTypeOf;    /**< Data type of the elements */
+    char *nameOf;        /**< Name of the list */
+    size_t size;         /**< Size of each element */
+} ListSegmented;
+
+/**
+ * @brief Gets the address of an element of a list without bounds checking.
+ *
+ * After list_PUSH_FRONT or list_POP_FRONT the elements may wrap around the end
+ * of the buffer; index is counted from the head either way. During an
+ * incremental resize, elements not migrated yet are read from the old buffer.
+ */
+static inline void *listAt(const List *list, int index) {
+    if ((unsigned int)(index - list->migrated) <
+        (unsigned int)(list->migrateEnd - list->migrated)) {
+        return (char *)list->oldData + ((size_t)index * list->size);
+    }
+    size_t slot = (size_t)list->head + (size_t)index;
+    if (slot >= (size_t)list->initSize) {
+        slot -= (size_t)list->initSize;
+    }
+    return (char *)list->data + (slot * list->size);
+}
+
+/**
+ * @brief Gets the element at index and how many elements follow it contiguously.
+ * @param list A pointer to the List.
+ * @param index The index of the first element, below the element count.
+ * @param run Receives the number of elements stored contiguously from index on.
+ * @return A pointer to the element at index.
+ *
+ * Lets a scan walk a ring that wraps around, or a list in the middle of an
+ * incremental resize, in at most three runs without calling listLinearize.
+ */
+static inline void *listRun(const List *list, int index, int *run) {
+    int count = list->currentCount - index;
+    if ((unsigned int)(index - list->migrated) <
+        (unsigned int)(list->migrateEnd - list->migrated)) {
+        /* list_POP_BACK may have left migrateEnd past the element count */
+        *run = list->migrateEnd - index < count ? list->migrateEnd - index : count;
+        return (char *)list->oldData + ((size_t)index * list->size);
+    }
+    size_t slot = (size_t)list->head + (size_t)index;
+    if (slot >= (size_t)list->initSize) {
+        slot -= (size_t)list->initSize;
+    }
+    size_t end = (size_t)list->initSize - slot;
+    if (index < list->migrated && list->migrated < list->migrateEnd) {
+        count = list->migrated - index;
+    }
+    *run = end < (size_t)count ? (int)end : count;
+    return (char *)list->data + (slot * list->size);
+}
+
+#ifdef LIST_STATS
+/**
+ * @brief Counts one call of a macro on a list; views are not counted.
+ */
+static inline void listStatsCall(const List *list, ListStatsOp op) {
+    if (list && list->stats) {
+        list->stats->calls[op]++;
+    }
+}
+
+#define LIST_STATS_OF(list)                                                         \
+    _Generic((list), ListView *: (const List *)NULL,                                \
+             const ListView *: (const List *)NULL, default: (list))
+#define LIST_STAT_CALL(list, op) listStatsCall(LIST_STATS_OF(list), LIST_OP_##op)
+#define LIST_STAT_MOVED(list, bytes) do {                                           \
+    if ((list)->stats) {                                                            \
+        (list)->stats->bytesMoved += (bytes);                                       \
+    }                                                                               \
+} while (0)
+#define LIST_STAT_COPIED(list, bytes) do {                                          \
+    if ((list)->stats) {                                                            \
+        (list)->stats->bytesCopied += (bytes);                                      \
+    }                                                                               \
+} while (0)
+#define LIST_STAT_REALLOC(list) do {                                                \
+    if ((list)->stats) {                                                            \
+        (list)->stats->reallocs++;                                                  \
+    }                                                                               \
+} while (0)
+#define LIST_STAT_PEAK(list) do {                                                   \
+    if ((list)->stats &&                                                            \
+        (list)->listSize + (list)->oldListSize > (list)->stats->peakListSize) {     \
+        (list)->stats->peakListSize = (list)->listSize + (list)->oldListSize;       \
+    }                                                                               \
+} while (0)
+#define LIST_STAT_COMPARED(list, count) do {                                        \
+    if ((list)->stats) {                                                            \
+        (list)->stats->comparisons += (count);                                      \
+    }                                                                               \
+} while (0)
+#define LIST_STAT_REGISTER(list) ((list)->stats = listStatsRegister(list))
+#else
+/* Without -DLIST_STATS the hooks compile to nothing */
+#define LIST_STAT_CALL(list, op) ((void)0)
+#define LIST_STAT_MOVED(list, bytes) ((void)0)
+#define LIST_STAT_COPIED(list, bytes) ((void)0)
+#define LIST_STAT_REALLOC(list) ((void)0)
+#define LIST_STAT_PEAK(list) ((void)0)
+#define LIST_STAT_COMPARED(list, count) ((void)0)
+#define LIST_STAT_REGISTER(list) ((void)0)
+#endif
+
+/**
+ * @brief Gets the address of an element of a view without bounds checking.
+ */
+static inline void *listViewAt(const ListView *view, int index) {
+    return (char *)view->data + ((size_t)index * view->stride);
+}
+
+/**
+ * @brief Returns a copy of a view, the ListView counterpart of listAsView.
+ */
+static inline ListView listViewCopy(const ListView *view) {
+    return *view;
+}
+
+/**
+ * @brief Locates an index in segmented storage.
+ * @param index A non-negative element index.
+ * @param offset Receives the position of the element inside its segment.
+ * @return The segment holding the element.
+ *
+ * Segment s holds 2^(s + LIST_SEGMENT_SHIFT) elements, so index + 2^SHIFT has
+ * its highest bit at s + SHIFT and the bits below it are the offset.
+ */
+static inline int listSegmentOf(int index, size_t *offset) {
+    unsigned int biased = (unsigned int)index + (1u << LIST_SEGMENT_SHIFT);
+    int high = 31 - __builtin_clz(biased);
+    *offset = biased - (1u << high);
+    return high - LIST_SEGMENT_SHIFT;
+}
+
+/**
+ * @brief Number of elements in a segment of segmented storage.
+ */
+static inline size_t listSegmentCapacity(int segment) {
+    return (size_t)1 << (segment + LIST_SEGMENT_SHIFT);
+}
+
+/**
+ * @brief Gets the address of an element of a segmented list without bounds checking.
+ */
+static inline void *listSegAt(const ListSegmented *list, int index) {
+    size_t offset;
+    int segment = listSegmentOf(index, &offset);
+    return list->segments[segment] + offset * list->size;
+}
+
+/**
+ * @brief Compares two elements byte by byte without an early exit.
+ *
+ * Differences are OR-ed together a word at a time, so the loop has no
+ * data-dependent branch. The default equality when no callback is registered.
+ */
+static inline bool listBytesEqual(const void *a, const void *b, size_t size) {
+    const unsigned char *left = a;
+    const unsigned char *right = b;
+    uint64_t diff = 0;
+    size_t i = 0;
+    for (; i + 8 <= size; i += 8) {
+        uint64_t x, y;
+        memcpy(&x, left + i, 8);
+        memcpy(&y, right + i, 8);
+        diff |= x ^ y;
+    }
+    for (; i < size; i++) {
+        diff |= (uint64_t)(left[i] ^ right[i]);
+    }
+    return diff == 0;
+}
+
+/**
+ * @brief Compares two strings that may be NULL.
+ */
+static inline bool listStringEquals(const char *a, const char *b) {
+    return a == b || (a && b && strcmp(a, b) == 0);
+}
+
+/**
+ * @brief FNV-1a hash of a string, 0 for NULL.
+ */
+static inline size_t listHashString(const char *string) {
+    size_t hash = (size_t)14695981039346656037ULL;
+    if (!string) {
+        return 0;
+    }
+    for (; *string; string++) {
+        hash ^= (unsigned char)*string;
+        hash *= (size_t)1099511628211ULL;
+    }
+    return hash;
+}
+
+/**
+ * @brief Mixes the hash of one more field into a running hash.
+ */
+static inline size_t listHashCombine(size_t hash, size_t value) {
+    return hash ^ (value + (size_t)0x9E3779B97F4A7C15ULL + (hash << 6) + (hash >> 2));
+}
+
+/**
+ * @brief Gets the address of an element of a List or a ListView.
+ * @param list A pointer to a List or to a ListView.
+ * @param index The index of the element, which is not checked.
+ */
+#define list_AT(list, index)                                                        \
+    _Generic((list), ListView *: listViewAt, const ListView *: listViewAt,          \
+             default: listAt)((list), (index))
+
+/**
+ * @brief Clears the sorted flag of a list whose elements may be edited in place.
+ * @param list A pointer to the List, or NULL for a view.
+ *
+ * Called by list_GET, list_FOR_EACH and listGetMemoryAddress, which hand out
+ * mutable element pointers; listSort sets the flag again.
+ */
+static inline void listClearSorted(List *list) {
+    if (list) {
+        list->sorted = false;
+    }
+}
+
+/**
+ * @brief The List behind a List pointer, NULL for views and const lists.
+ */
+#define LIST_MUTABLE_OF(list)                                                       \
+    _Generic((list), ListView *: (List *)NULL, const ListView *: (List *)NULL,      \
+             const List *: (List *)NULL, default: (list))
+
+/**
+ * @brief Gets a ListView over a List (see listAsView) or a copy of a ListView.
+ */
+#define list_AS_VIEW(list)                                                          \
+    _Generic((list), ListView *: listViewCopy, const ListView *: listViewCopy,      \
+             default: listAsView)((list))
+
+/**
+ * @brief Elements migrated by each add while an incremental resize is pending.
+ *
+ * A migration of n elements finishes within n / LIST_RESIZE_STEP adds, long
+ * before the grown buffer is full again. If it is not (LIST_GROW_LINEAR with a
+ * small step), the next growth finishes it at once.
+ */
+#ifndef LIST_RESIZE_STEP
+#define LIST_RESIZE_STEP 16
+#endif
+
+/**
+ * @brief Default initial capacity (number of elements) used by list_INIT.
+ */
+#define LIST_DEFAULT_CAPACITY 8
+
+/** Size of the header written by listSave before the elements. */
+#define LIST_FILE_HEADER_SIZE 128
+
 /**
  * @brief Initializes a list with a specific data type.
  * @param list A pointer to the list to initialize.
  * @param dataType The data type of the list's elements.
  *
- * Initializes the list with the specified data type, setting the initial size to 8.
- * It also allocates memory for the list's data and sets up the necessary metadata.
+ * Initializes the list with the specified data type, setting the initial size to
+ * LIST_DEFAULT_CAPACITY. It also allocates memory for the list's data and sets up
+ * the necessary metadata.
+ */
+#define list_INIT(list, dataType)                                                   \
+    list_INIT_WITH_CAPACITY(list, dataType, LIST_DEFAULT_CAPACITY)
+
+
+/**
+ * @brief Initializes a list with room for a given number of elements.
+ * @param list A pointer to the list to initialize.
+ * @param dataType The data type of the list's elements.
+ * @param capacity The number of elements to allocate room for up front.
+ *
+ * Use this when the final size is known in advance so that no reallocation
+ * happens while the list is filled.
+ */
+#define list_INIT_WITH_CAPACITY(list, dataType, capacity)                           \
+    list_INIT_WITH_ALLOCATOR(list, dataType, capacity, NULL)
+
+
+/**
+ * @brief Initializes a list whose element buffer comes from a custom allocator.
+ * @param list A pointer to the list to initialize.
+ * @param dataType The data type of the list's elements.
+ * @param capacity The number of elements to allocate room for up front.
+ * @param listAllocator The allocator to use, or NULL for malloc.
+ *
+ * The name and data type strings point to string literals. Small lists start in
+ * the inline buffer of the List, when LIST_INLINE_BYTES enables one, and make
+ * no allocation at all.
+ *
+ * @warning With LIST_INLINE_BYTES > 0, a List must not be copied by value while
+ *          it uses its inline buffer.
  */
-#define list_INIT(list, dataType) do {                                              \
-    (list)->dataTypeOf = strdup(#dataType);                                         \
-    (list)->nameOf = strdup(#list);                                                 \
-    (list)->initSize = 8;                                                           \
+#define list_INIT_WITH_ALLOCATOR(list, dataType, capacity, listAllocator) do {      \
+    size_t initCapacity = (capacity) > 0 ? (size_t)(capacity) : 1;                  \
+    (list)->dataTypeOf = (char *)#dataType;                                         \
+    (list)->nameOf = (char *)#list;                                                 \
     (list)->currentCount = 0;                                                       \
     (list)->size = sizeof(dataType);                                                \
+    (list)->elementKind = listKindOf(#dataType, sizeof(dataType));                  \
     (list)->dataSize = 0;                                                           \
-    (list)->listSize = (list)->initSize * (list)->size;                             \
-    (list)->data = calloc((list)->initSize, (list)->size);                          \
-    if (!(list)->data) {                                                            \
-        fprintf(stderr, "Memory allocation failed\n");                              \
-        exit(EXIT_FAILURE);                                                         \
-    }                                                                               \
+    (list)->hashIndex = NULL;                                                       \
+    listBindType(list);                                                             \
+    (list)->allocator = (listAllocator);                                            \
+    (list)->growthPolicy = LIST_GROW_DOUBLE;                                        \
+    (list)->growthStep = 0;                                                         \
+    (list)->autoShrink = false;                                                     \
+    (list)->sorted = false;                                                         \
+    (list)->head = 0;                                                               \
+    (list)->incrementalResize = false;                                              \
+    (list)->oldData = NULL;                                                         \
+    (list)->oldListSize = 0;                                                        \
+    (list)->migrated = 0;                                                           \
+    (list)->migrateEnd = 0;                                                         \
+    (list)->mapping = NULL;                                                         \
+    (list)->mappingSize = 0;                                                        \
+    LIST_STAT_REGISTER(list);                                                       \
+    LIST_STAT_CALL(list, INIT);                                                     \
+    listInitBuffer(list, initCapacity);                                             \
+} while (0)
+
+
+/**
+ * @brief Initializes a list from a file written by listSave, without parsing it.
+ * @param list A pointer to the list to initialize.
+ * @param dataType The data type of the list's elements, as saved.
+ * @param path The file to load.
+ * @return true if the file was loaded; false if it is missing, truncated,
+ *         corrupted or was saved with another data type or element size.
+ *
+ * The elements are served directly from a private memory mapping of the file,
+ * so opening is O(1) whatever the size. Changes are never written back; call
+ * listSave to persist them. The list must be freed with listFree in both cases.
+ */
+#define list_OPEN_MAPPED(list, dataType, path) ({                                   \
+    (list)->dataTypeOf = (char *)#dataType;                                         \
+    (list)->nameOf = (char *)#list;                                                 \
+    listOpenMapped(list, path, sizeof(dataType));                                   \
+})
+
+
+/**
+ * @brief Describes a field that is copied byte for byte.
+ * @param structType The struct that holds the field.
+ * @param member The name of the field.
+ */
+#define list_FIELD(structType, member)                                              \
+    { LIST_FIELD_SCALAR, offsetof(structType, member),                              \
+      sizeof(((structType *)0)->member), NULL }
+
+
+/**
+ * @brief Describes a char * field that is written as a string.
+ * @param structType The struct that holds the field.
+ * @param member The name of the field.
+ */
+#define list_FIELD_STRING(structType, member)                                       \
+    { LIST_FIELD_STRING, offsetof(structType, member), sizeof(char *), NULL }
+
+
+/**
+ * @brief Describes a nested struct field with its own schema.
+ * @param structType The struct that holds the field.
+ * @param member The name of the field.
+ * @param memberSchema The ListSchema of the nested struct.
+ */
+#define list_FIELD_STRUCT(structType, member, memberSchema)                         \
+    { LIST_FIELD_STRUCT, offsetof(structType, member),                              \
+      sizeof(((structType *)0)->member), &(memberSchema) }
+
+
+/**
+ * @brief Builds a ListSchema from an array of fields.
+ * @param dataType The data type, spelled as in list_INIT.
+ * @param fieldArray A static array of list_FIELD* entries.
+ *
+ * @code
+ * static const ListField personFields[] = {
+ *     list_FIELD_STRING(Person, name),
+ *     list_FIELD(Person, age),
+ * };
+ * static const ListSchema personSchema = list_SCHEMA(Person, personFields);
+ * listRegisterSchema(&personSchema);
+ * @endcode
+ */
+#define list_SCHEMA(dataType, fieldArray)                                           \
+    { #dataType, sizeof(dataType), (fieldArray),                                    \
+      (int)(sizeof(fieldArray) / sizeof((fieldArray)[0])) }
+
+
+/*
+ * Applies a macro to each of up to 16 arguments, for list_DEFINE_EQUALS and
+ * list_DEFINE_HASH.
+ */
+#define list_COUNT_FIELDS(...)                                                      \
+    list_COUNT_FIELDS_(__VA_ARGS__, 16, 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4,  \
+                       3, 2, 1)
+#define list_COUNT_FIELDS_(f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13,  \
+                           f14, f15, f16, count, ...) count
+#define list_CONCAT(a, b) list_CONCAT_(a, b)
+#define list_CONCAT_(a, b) a##b
+#define list_EACH_FIELD(macro, ...)                                                 \
+    list_CONCAT(list_EACH_FIELD_, list_COUNT_FIELDS(__VA_ARGS__))(macro, __VA_ARGS__)
+#define list_EACH_FIELD_1(m, f) m(f)
+#define list_EACH_FIELD_2(m, f, ...) m(f) list_EACH_FIELD_1(m, __VA_ARGS__)
+#define list_EACH_FIELD_3(m, f, ...) m(f) list_EACH_FIELD_2(m, __VA_ARGS__)
+#define list_EACH_FIELD_4(m, f, ...) m(f) list_EACH_FIELD_3(m, __VA_ARGS__)
+#define list_EACH_FIELD_5(m, f, ...) m(f) list_EACH_FIELD_4(m, __VA_ARGS__)
+#define list_EACH_FIELD_6(m, f, ...) m(f) list_EACH_FIELD_5(m, __VA_ARGS__)
+#define list_EACH_FIELD_7(m, f, ...) m(f) list_EACH_FIELD_6(m, __VA_ARGS__)
+#define list_EACH_FIELD_8(m, f, ...) m(f) list_EACH_FIELD_7(m, __VA_ARGS__)
+#define list_EACH_FIELD_9(m, f, ...) m(f) list_EACH_FIELD_8(m, __VA_ARGS__)
+#define list_EACH_FIELD_10(m, f, ...) m(f) list_EACH_FIELD_9(m, __VA_ARGS__)
+#define list_EACH_FIELD_11(m, f, ...) m(f) list_EACH_FIELD_10(m, __VA_ARGS__)
+#define list_EACH_FIELD_12(m, f, ...) m(f) list_EACH_FIELD_11(m, __VA_ARGS__)
+#define list_EACH_FIELD_13(m, f, ...) m(f) list_EACH_FIELD_12(m, __VA_ARGS__)
+#define list_EACH_FIELD_14(m, f, ...) m(f) list_EACH_FIELD_13(m, __VA_ARGS__)
+#define list_EACH_FIELD_15(m, f, ...) m(f) list_EACH_FIELD_14(m, __VA_ARGS__)
+#define list_EACH_FIELD_16(m, f, ...) m(f) list_EACH_FIELD_15(m, __VA_ARGS__)
+
+/*
+ * Field kinds of list_DEFINE_EQUALS and list_DEFINE_HASH. A field written as
+ * STRING(name) pastes into list_EQUALS_STRING(name) and list_HASH_STRING(name).
+ *   VALUE(member)  compared with ==; numbers, pointers compared by address, enums
+ *   STRING(member) a char * compared with strcmp; NULL equals only NULL
+ *   BYTES(member)  an array or padding-free struct compared with memcmp
+ */
+#define list_EQUALS_FIELD(field) && list_EQUALS_##field
+#define list_EQUALS_VALUE(member) (a->member == b->member)
+#define list_EQUALS_STRING(member) listStringEquals(a->member, b->member)
+#define list_EQUALS_BYTES(member) (memcmp(&a->member, &b->member, sizeof(a->member)) == 0)
+#define list_HASH_FIELD(field) list_HASH_##field;
+/* Adding 0 turns -0.0 into 0.0, so equal floating point values hash the same */
+#define list_HASH_VALUE(member) do {                                                \
+    __typeof__(a->member + 0) value = a->member + 0;                                \
+    hash = listHashCombine(hash, listHashBytes(&value, sizeof(value)));             \
 } while (0)
+#define list_HASH_STRING(member) hash = listHashCombine(hash, listHashString(a->member))
+#define list_HASH_BYTES(member)                                                     \
+    hash = listHashCombine(hash, listHashBytes(&a->member, sizeof(a->member)))
+
+
+/**
+ * @brief Defines a ListEqualsFn that compares the listed fields of a struct.
+ * @param name The name of the function to define.
+ * @param dataType The struct type.
+ * @param ... Up to 16 fields, each VALUE(member), STRING(member) or BYTES(member).
+ *
+ * The comparisons are written out inline, so padding and fields not listed
+ * are ignored and char * fields compare by content.
+ *
+ * @code
+ * list_DEFINE_EQUALS(personEquals, Person, STRING(name), VALUE(age),
+ *                    VALUE(dateOfBirth.YYYY), VALUE(dateOfBirth.MM), VALUE(dateOfBirth.DD));
+ * @endcode
+ */
+#define list_DEFINE_EQUALS(name, dataType, ...)                                     \
+static inline bool name(const void *left, const void *right, size_t size) {         \
+    const dataType *a = left;                                                       \
+    const dataType *b = right;                                                      \
+    (void)size;                                                                     \
+    return true list_EACH_FIELD(list_EQUALS_FIELD, __VA_ARGS__);                    \
+}
+
+
+/**
+ * @brief Defines a ListHashFn over the listed fields of a struct.
+ * @param name The name of the function to define.
+ * @param dataType The struct type.
+ * @param ... The fields given to list_DEFINE_EQUALS, or a subset of them.
+ */
+#define list_DEFINE_HASH(name, dataType, ...)                                       \
+static inline size_t name(const void *element, size_t size) {                       \
+    const dataType *a = element;                                                    \
+    size_t hash = 0;                                                                \
+    (void)size;                                                                     \
+    list_EACH_FIELD(list_HASH_FIELD, __VA_ARGS__)                                   \
+    return hash;                                                                    \
+}
+
+
+/**
+ * @brief Defines dataTypeEquals and dataTypeHash over the same fields.
+ * @param dataType The struct type, a single identifier such as Person.
+ * @param ... Up to 16 fields, each VALUE(member), STRING(member) or BYTES(member).
+ */
+#define list_DEFINE_TYPE_OPS(dataType, ...)                                         \
+    list_DEFINE_EQUALS(dataType##Equals, dataType, __VA_ARGS__)                     \
+    list_DEFINE_HASH(dataType##Hash, dataType, __VA_ARGS__)
+
+
+/**
+ * @brief Registers the functions of list_DEFINE_TYPE_OPS for a data type.
+ *
+ * Lists of the type initialized afterwards search with them (see listRegisterType).
+ */
+#define list_REGISTER_TYPE(dataType)                                                \
+    listRegisterType(#dataType, dataType##Equals, dataType##Hash)
+
+
+/**
+ * @brief Initializes a list from a stream written by listStreamWrite.
+ * @param list A pointer to the list to initialize.
+ * @param dataType The data type of the list's elements, with a registered schema.
+ * @param file The FILE * to read from.
+ * @param arena The ListArena that receives the elements and their strings.
+ * @return true if the whole stream was read.
+ *
+ * Everything decoded lives in the arena, so listArenaDestroy frees the list and
+ * all of its strings at once.
+ */
+#define list_STREAM_READ(list, dataType, file, arena) ({                            \
+    (list)->dataTypeOf = (char *)#dataType;                                         \
+    (list)->nameOf = (char *)#list;                                                 \
+    listStreamRead(list, file, arena, sizeof(dataType));                            \
+})
+
+
+/**
+ * @brief Same as list_STREAM_READ, from a file descriptor.
+ */
+#define list_STREAM_READ_FD(list, dataType, fd, arena) ({                           \
+    (list)->dataTypeOf = (char *)#dataType;                                         \
+    (list)->nameOf = (char *)#list;                                                 \
+    listStreamReadFd(list, fd, arena, sizeof(dataType));                            \
+})
 
 
 /**
@@ -59,20 +841,20 @@ typedef struct List {
  */
 #define list_ADD(list, dataType, inputData) do {                                    \
     dataType temp = (inputData); /* Create a temporary variable */                  \
+    LIST_STAT_CALL(list, ADD);                                                      \
     if ((list)->currentCount >= (list)->initSize) {                                 \
-        (list)->initSize *= 2;                                                      \
-        (list)->listSize = (list)->initSize * (list)->size;                         \
-        void *tempPtr = realloc((list)->data, (list)->listSize);                    \
-        if (!tempPtr) {                                                             \
-            fprintf(stderr, "Memory allocation failed\n");                          \
-            exit(EXIT_FAILURE);                                                     \
-        }                                                                           \
-        (list)->data = tempPtr;                                                     \
+        listGrow(list, (size_t)(list)->currentCount + 1);                           \
     }                                                                               \
-    memcpy((char*)(list)->data + ((list)->currentCount * (list)->size),             \
-           &temp, (list)->size);                                                    \
+    memcpy(listAt(list, (list)->currentCount), &temp, (list)->size);                \
     (list)->currentCount++;                                                         \
     (list)->dataSize = (list)->currentCount * (list)->size;                         \
+    (list)->sorted = false;                                                         \
+    if ((list)->hashIndex) {                                                        \
+        listIndexLink(list, (list)->currentCount - 1);                              \
+    }                                                                               \
+    if ((list)->migrateEnd) {                                                       \
+        listResizeStep(list, LIST_RESIZE_STEP);                                     \
+    }                                                                               \
 } while (0)
 
 
@@ -83,13 +865,13 @@ typedef struct List {
  * @param count The number of elements to add.
  * @param ... The elements to add to the list.
  *
- * This macro takes a variable number of arguments and adds each one to the list.
+ * This macro takes a variable number of arguments and appends them to the list
+ * with a single growth and a single copy.
  */
 #define list_ADD_ALL(list, dataType, count, ...) do {                              \
     dataType values[] = {__VA_ARGS__};                                             \
-    for (int i = 0; i < (count); i++) {                                            \
-        list_ADD(list, dataType, values[i]);                                            \
-    }                                                                              \
+    LIST_STAT_CALL(list, ADD_ALL);                                                 \
+    listAppendRange(list, values, (size_t)(count));                                \
 } while (0)
 
 
@@ -109,15 +891,11 @@ typedef struct List {
         break;                                                                      \
     }                                                                               \
     if ((list)->currentCount >= (list)->initSize) {                                 \
-        (list)->initSize *= 2;                                                      \
-        (list)->listSize = (list)->initSize * (list)->size;                         \
-        void *temp = realloc((list)->data, (list)->listSize);                       \
-        if (!temp) {                                                                \
-            fprintf(stderr, "Memory allocation failed\n");                          \
-            exit(EXIT_FAILURE);                                                     \
-        }                                                                           \
-        (list)->data = temp;                                                        \
+        listGrow(list, (size_t)(list)->currentCount + 1);                           \
     }                                                                               \
+    listLinearize(list);                                                            \
+    LIST_STAT_CALL(list, ADD_AT);                                                   \
+    LIST_STAT_MOVED(list, ((list)->currentCount - (index)) * (list)->size);         \
     memmove((char *)(list)->data + ((index) + 1) * (list)->size,                    \
             (char *)(list)->data + (index) * (list)->size,                          \
             ((list)->currentCount - (index)) * (list)->size);                       \
@@ -125,6 +903,10 @@ typedef struct List {
            &(inputData), (list)->size);                                             \
     (list)->currentCount++;                                                         \
     (list)->dataSize = (list)->currentCount * (list)->size;                         \
+    (list)->sorted = false;                                                         \
+    if ((list)->hashIndex) {                                                        \
+        listIndexAfterInsert(list, (index));                                        \
+    }                                                                               \
 } while (0)
 
 
@@ -139,22 +921,22 @@ typedef struct List {
  */
 #define list_REMOVE(list, dataType, inputData) do {                                 \
     dataType temp = (inputData); /* Store inputData in a temporary variable */      \
-    int foundIndex = -1;                                                            \
-    for (int i = 0; i < (list)->currentCount; i++) {                                \
-        dataType *element = (dataType *)((char *)(list)->data + (i * (list)->size));\
-        if (memcmp(element, &temp, sizeof(dataType)) == 0) {                        \
-            foundIndex = i;                                                         \
-            break;                                                                  \
-        }                                                                           \
-    }                                                                               \
+    LIST_STAT_CALL(list, REMOVE);                                                   \
+    int foundIndex = listIndexOf(list, &temp);                                      \
     if (foundIndex != -1) {                                                         \
-        for (int i = foundIndex; i < (list)->currentCount - 1; i++) {               \
-            memcpy((char *)(list)->data + (i * (list)->size),                       \
-                   (char *)(list)->data + ((i + 1) * (list)->size),                 \
-                   (list)->size);                                                   \
+        listLinearize(list);                                                        \
+        LIST_STAT_MOVED(list, ((list)->currentCount - foundIndex - 1) * (list)->size);\
+        if ((list)->hashIndex) {                                                    \
+            listIndexBeforeRemove(list, foundIndex);                                \
         }                                                                           \
+        memmove((char *)(list)->data + (foundIndex * (list)->size),                 \
+                (char *)(list)->data + ((foundIndex + 1) * (list)->size),           \
+                ((list)->currentCount - foundIndex - 1) * (list)->size);            \
         (list)->currentCount--;                                                     \
         (list)->dataSize = (list)->currentCount * (list)->size;                     \
+        if ((list)->autoShrink) {                                                   \
+            listMaybeShrink(list);                                                  \
+        }                                                                           \
     } else {                                                                        \
         printf("Value not found in the list.\n");                                   \
     }                                                                               \
@@ -168,42 +950,229 @@ typedef struct List {
  * @param index The index of the element to remove.
  *
  * This macro removes the element at the specified index, shifting the remaining
- * elements accordingly.
+ * elements down with a single memmove.
  */
 #define list_REMOVE_AT(list, dataType, index) do {                                  \
     if ((index) < 0 || (index) >= (list)->currentCount) {                           \
         printf("Invalid index: %d\n", (index));                                     \
         break;                                                                      \
     }                                                                               \
-    for (int i = (index); i < (list)->currentCount - 1; i++) {                      \
-        memcpy((char *)(list)->data + (i * (list)->size),                           \
-               (char *)(list)->data + ((i + 1) * (list)->size),                     \
-               (list)->size);                                                       \
+    listLinearize(list);                                                            \
+    LIST_STAT_CALL(list, REMOVE_AT);                                                \
+    LIST_STAT_MOVED(list, ((list)->currentCount - (index) - 1) * (list)->size);     \
+    if ((list)->hashIndex) {                                                        \
+        listIndexBeforeRemove(list, (index));                                       \
     }                                                                               \
+    memmove((char *)(list)->data + ((index) * (list)->size),                        \
+            (char *)(list)->data + (((index) + 1) * (list)->size),                  \
+            ((list)->currentCount - (index) - 1) * (list)->size);                   \
     (list)->currentCount--;                                                         \
     (list)->dataSize = (list)->currentCount * (list)->size;                         \
+    if ((list)->autoShrink) {                                                       \
+        listMaybeShrink(list);                                                      \
+    }                                                                               \
 } while (0)
 
 
 /**
- * @brief Gets the index of an element in the list.
- * @param list A pointer to the list.
- * @param dataType The data type of the element.
- * @param inputData The element to search for.
- * @return The index of the element, or -1 if the element is not found.
+ * @brief Removes an element at a specific index by moving the last element into its place.
+ * @param list A pointer to the list from which to remove an element.
+ * @param dataType The data type of the element to remove.
+ * @param index The index of the element to remove.
  *
- * This macro returns the index of the first occurrence of the specified element.
+ * This macro removes the element in O(1) but does not keep the order of the list.
  */
-#define list_GET_INDEX_OF(list, dataType, inputData) ({                             \
-    int foundIndex = -1;                                                            \
-    for (int i = 0; i < (list)->currentCount; i++) {                                \
-        if (memcmp((char *)(list)->data + (i * (list)->size),                       \
-                   &(inputData), (list)->size) == 0) {                              \
-            foundIndex = i;                                                         \
-            break;                                                                  \
+#define list_SWAP_REMOVE_AT(list, dataType, index) do {                             \
+    if ((index) < 0 || (index) >= (list)->currentCount) {                           \
+        printf("Invalid index: %d\n", (index));                                     \
+        break;                                                                      \
+    }                                                                               \
+    int lastIndex = (list)->currentCount - 1;                                       \
+    LIST_STAT_CALL(list, SWAP_REMOVE_AT);                                           \
+    if ((list)->hashIndex) {                                                        \
+        listIndexUnlink(list, (index));                                             \
+        if ((index) != lastIndex) {                                                 \
+            listIndexUnlink(list, lastIndex);                                       \
+        }                                                                           \
+    }                                                                               \
+    if ((index) != lastIndex) {                                                     \
+        memcpy(listAt(list, (index)), listAt(list, lastIndex), sizeof(dataType));   \
+        (list)->sorted = false;                                                     \
+    }                                                                               \
+    (list)->currentCount--;                                                         \
+    (list)->dataSize = (list)->currentCount * (list)->size;                         \
+    if ((list)->hashIndex && (index) != lastIndex) {                                \
+        listIndexLink(list, (index));                                               \
+    }                                                                               \
+    if ((list)->autoShrink) {                                                       \
+        listMaybeShrink(list);                                                      \
+    }                                                                               \
+} while (0)
+
+
+/**
+ * @brief Removes every element that satisfies an expression.
+ * @param list A pointer to the list.
+ * @param dataType The data type of the elements in the list.
+ * @param expression The expression to evaluate for each element.
+ * @return The number of removed elements.
+ *
+ * The kept elements are compacted in a single stable pass, so removing k elements
+ * costs O(n) instead of O(n * k).
+ *
+ * @warning Use "element" to compare and treat it as a pointer, as in list_COLLECT_TO_SUBLIST.
+ */
+#define list_REMOVE_IF(list, dataType, expression) ({                               \
+    int writeIndex = 0;                                                             \
+    listLinearize(list);                                                            \
+    LIST_STAT_CALL(list, REMOVE_IF);                                                \
+    for (int i = 0; i < (list)->currentCount; i++) {                                \
+        dataType *element = (dataType *)((char *)(list)->data + (i * (list)->size));\
+        if (!(expression)) {                                                        \
+            if (writeIndex != i) {                                                  \
+                LIST_STAT_MOVED(list, sizeof(dataType));                            \
+                memcpy((char *)(list)->data + (writeIndex * (list)->size),          \
+                       element, sizeof(dataType));                                  \
+            }                                                                       \
+            writeIndex++;                                                           \
+        }                                                                           \
+    }                                                                               \
+    int removedCount = (list)->currentCount - writeIndex;                           \
+    (list)->currentCount = writeIndex;                                              \
+    (list)->dataSize = (list)->currentCount * (list)->size;                         \
+    if ((list)->hashIndex && removedCount > 0) {                                    \
+        listIndexRebuild(list);                                                     \
+    }                                                                               \
+    if ((list)->autoShrink) {                                                       \
+        listMaybeShrink(list);                                                      \
+    }                                                                               \
+    removedCount;                                                                   \
+})
+
+
+/**
+ * @brief Adds an element at the end of the list; same as list_ADD.
+ * @param list A pointer to the list.
+ * @param dataType The data type of the element to add.
+ * @param inputData The element to add.
+ */
+#define list_PUSH_BACK(list, dataType, inputData) list_ADD(list, dataType, inputData)
+
+
+/**
+ * @brief Adds an element at the front of the list in amortized O(1).
+ * @param list A pointer to the list.
+ * @param dataType The data type of the element to add.
+ * @param inputData The element to add.
+ *
+ * The buffer is used as a ring: the head moves back one slot, wrapping to the
+ * end of the buffer, and no element is shifted. list_GET, list_SET, list_AT
+ * and list_FOR_EACH follow the wraparound; operations that need the elements
+ * in one piece (list_ADD_AT, list_REMOVE_AT, list_TO_ARRAY, sorting, the
+ * kernels, views, saving) first move them back to the start of the buffer.
+ */
+#define list_PUSH_FRONT(list, dataType, inputData) do {                             \
+    dataType temp = (inputData);                                                    \
+    LIST_STAT_CALL(list, PUSH_FRONT);                                               \
+    if ((list)->currentCount >= (list)->initSize) {                                 \
+        listGrow(list, (size_t)(list)->currentCount + 1);                           \
+    }                                                                               \
+    if ((list)->migrateEnd) { /* listAt ignores the head until the resize ends */   \
+        listResizeStep(list, (list)->migrateEnd);                                   \
+    }                                                                               \
+    (list)->head = ((list)->head > 0 ? (list)->head : (list)->initSize) - 1;        \
+    memcpy(listAt(list, 0), &temp, (list)->size);                                   \
+    (list)->currentCount++;                                                         \
+    (list)->dataSize = (list)->currentCount * (list)->size;                         \
+    (list)->sorted = false;                                                         \
+    if ((list)->hashIndex) {                                                        \
+        listIndexAfterInsert(list, 0);                                              \
+    }                                                                               \
+} while (0)
+
+
+/**
+ * @brief Removes and returns the first element of the list in O(1).
+ * @param list A pointer to the list.
+ * @param dataType The data type of the elements.
+ * @return The removed element; all zero if the list is empty.
+ */
+#define list_POP_FRONT(list, dataType) ({                                           \
+    dataType popped;                                                                \
+    LIST_STAT_CALL(list, POP_FRONT);                                                \
+    memset(&popped, 0, sizeof(dataType));                                           \
+    if ((list)->migrateEnd) {                                                       \
+        listResizeStep(list, (list)->migrateEnd);                                   \
+    }                                                                               \
+    if ((list)->currentCount > 0) {                                                 \
+        if ((list)->hashIndex) {                                                    \
+            listIndexBeforeRemove(list, 0);                                         \
+        }                                                                           \
+        memcpy(&popped, listAt(list, 0), sizeof(dataType));                         \
+        (list)->head = (list)->head + 1 < (list)->initSize ? (list)->head + 1 : 0;  \
+        (list)->currentCount--;                                                     \
+        if ((list)->currentCount == 0) {                                            \
+            (list)->head = 0;                                                       \
+        }                                                                           \
+        (list)->dataSize = (list)->currentCount * (list)->size;                     \
+        if ((list)->autoShrink) {                                                   \
+            listMaybeShrink(list);                                                  \
+        }                                                                           \
+    } else {                                                                        \
+        printf("No value\n");                                                       \
+    }                                                                               \
+    popped;                                                                         \
+})
+
+
+/**
+ * @brief Removes and returns the last element of the list in O(1).
+ * @param list A pointer to the list.
+ * @param dataType The data type of the elements.
+ * @return The removed element; all zero if the list is empty.
+ */
+#define list_POP_BACK(list, dataType) ({                                            \
+    dataType popped;                                                                \
+    LIST_STAT_CALL(list, POP_BACK);                                                 \
+    memset(&popped, 0, sizeof(dataType));                                           \
+    if ((list)->currentCount > 0) {                                                 \
+        int lastIndex = (list)->currentCount - 1;                                   \
+        if ((list)->hashIndex) {                                                    \
+            listIndexBeforeRemove(list, lastIndex);                                 \
+        }                                                                           \
+        memcpy(&popped, listAt(list, lastIndex), sizeof(dataType));                 \
+        (list)->currentCount--;                                                     \
+        if ((list)->currentCount == 0) {                                            \
+            (list)->head = 0;                                                       \
+        }                                                                           \
+        (list)->dataSize = (list)->currentCount * (list)->size;                     \
+        if ((list)->autoShrink) {                                                   \
+            listMaybeShrink(list);                                                  \
         }                                                                           \
+    } else {                                                                        \
+        printf("No value\n");                                                       \
     }                                                                               \
-    foundIndex;                                                                     \
+    popped;                                                                         \
+})
+
+
+/**
+ * @brief Gets the index of an element in the list.
+ * @param list A pointer to the list.
+ * @param dataType The data type of the element.
+ * @param inputData The element to search for.
+ * @return The index of the element, or -1 if the element is not found.
+ *
+ * This macro returns the index of the first occurrence of the specified element.
+ * It uses the hash index when enabled, a binary search after listSort, and a
+ * linear scan otherwise.
+ */
+#define list_GET_INDEX_OF(list, dataType, inputData) ({                             \
+    dataType temp = (inputData);                                                    \
+    LIST_STAT_CALL(list, GET_INDEX_OF);                                             \
+    _Generic((list), ListView *: listViewFindFirst,                                 \
+             const ListView *: listViewFindFirst,                                   \
+             default: listIndexOf)((list), &temp);                                  \
 })
 
 
@@ -215,19 +1184,334 @@ typedef struct List {
  * @return true if the element is found in the list, false otherwise.
  */
 #define list_CONTAINS(list, dataType, inputData) ({                \
-    int found = 0;                                                 \
     dataType temp = (inputData);                                   \
-    for (int i = 0; i < (list)->currentCount; i++) {               \
-        if (memcmp((char *)(list)->data + (i * (list)->size),      \
-                   &temp, (list)->size) == 0) {                    \
-            found = 1;                                             \
-            break;                                                 \
-        }                                                          \
-    }                                                              \
-    found;                                                         \
+    LIST_STAT_CALL(list, CONTAINS);                                \
+    _Generic((list), ListView *: listViewFindFirst,                \
+             const ListView *: listViewFindFirst,                  \
+             default: listIndexOf)((list), &temp) != -1;           \
+})
+
+
+/**
+ * @brief Evaluates a comparison expression for two elements.
+ * @param dataType The data type of the elements.
+ * @param left A pointer to the element bound to "a".
+ * @param right A pointer to the element bound to "b".
+ * @param lessExpression The expression, true when "a" comes before "b".
+ *
+ * Helper for the sort and search macros below.
+ */
+#define list_LESS(dataType, left, right, lessExpression) ({                         \
+    dataType *a = (left);                                                           \
+    dataType *b = (right);                                                          \
+    (void)a;                                                                        \
+    (void)b;                                                                        \
+    (bool)(lessExpression);                                                         \
+})
+
+
+/**
+ * @brief Sorts the list in place with an introsort.
+ * @param list A pointer to the list to sort.
+ * @param dataType The data type of the elements in the list.
+ * @param lessExpression The expression that is true when "a" comes before "b".
+ *
+ * The comparison is expanded inline, so it costs no function call per compare
+ * as with qsort. Uses quicksort with a median-of-three pivot, switches to
+ * heapsort for ranges that recurse too deep and finishes small ranges with an
+ * insertion sort, so the worst case is O(n log n). The sort is not stable; use
+ * list_SORT_STABLE to keep the order of equal elements.
+ *
+ * @warning Use "a" and "b" as pointers to the two elements, e.g. a->age < b->age.
+ */
+#define list_SORT(list, dataType, lessExpression) do {                              \
+    listLinearize(list);                                                            \
+    LIST_STAT_CALL(list, SORT);                                                     \
+    dataType *sortBase = (dataType *)(list)->data;                                  \
+    int sortCount = (list)->currentCount;                                           \
+    int sortLow[64], sortHigh[64], sortDepth[64];                                   \
+    int sortTop = 0;                                                                \
+    int sortLimit = 0;                                                              \
+    for (int sortSpan = sortCount; sortSpan > 1; sortSpan >>= 1) {                  \
+        sortLimit += 2;                                                             \
+    }                                                                               \
+    if (sortCount > 1) {                                                            \
+        sortLow[0] = 0;                                                             \
+        sortHigh[0] = sortCount - 1;                                                \
+        sortDepth[0] = sortLimit;                                                   \
+        sortTop = 1;                                                                \
+    }                                                                               \
+    while (sortTop > 0) {                                                           \
+        sortTop--;                                                                  \
+        int low = sortLow[sortTop], high = sortHigh[sortTop];                       \
+        int depth = sortDepth[sortTop];                                             \
+        while (high - low > 16) {                                                   \
+            if (depth-- == 0) {                                                     \
+                list_HEAP_SORT_RANGE(sortBase, dataType, low, high, lessExpression);\
+                break;                                                              \
+            }                                                                       \
+            int mid = low + (high - low) / 2;                                       \
+            dataType swapTemp;                                                      \
+            if (list_LESS(dataType, &sortBase[mid], &sortBase[low],                 \
+                          lessExpression)) {                                        \
+                swapTemp = sortBase[mid]; sortBase[mid] = sortBase[low];            \
+                sortBase[low] = swapTemp;                                           \
+            }                                                                       \
+            if (list_LESS(dataType, &sortBase[high], &sortBase[mid],                \
+                          lessExpression)) {                                        \
+                swapTemp = sortBase[high]; sortBase[high] = sortBase[mid];          \
+                sortBase[mid] = swapTemp;                                           \
+                if (list_LESS(dataType, &sortBase[mid], &sortBase[low],             \
+                              lessExpression)) {                                    \
+                    swapTemp = sortBase[mid]; sortBase[mid] = sortBase[low];        \
+                    sortBase[low] = swapTemp;                                       \
+                }                                                                   \
+            }                                                                       \
+            dataType pivot = sortBase[mid];                                         \
+            int left = low, right = high;                                           \
+            while (left <= right) {                                                 \
+                while (list_LESS(dataType, &sortBase[left], &pivot,                 \
+                                 lessExpression)) {                                 \
+                    left++;                                                         \
+                }                                                                   \
+                while (list_LESS(dataType, &pivot, &sortBase[right],                \
+                                 lessExpression)) {                                 \
+                    right--;                                                        \
+                }                                                                   \
+                if (left <= right) {                                                \
+                    swapTemp = sortBase[left]; sortBase[left] = sortBase[right];    \
+                    sortBase[right] = swapTemp;                                     \
+                    left++;                                                         \
+                    right--;                                                        \
+                }                                                                   \
+            }                                                                       \
+            /* Push the larger side and keep working on the smaller one */          \
+            if (right - low > high - left) {                                        \
+                sortLow[sortTop] = low; sortHigh[sortTop] = right;                  \
+                sortDepth[sortTop++] = depth;                                       \
+                low = left;                                                         \
+            } else {                                                                \
+                sortLow[sortTop] = left; sortHigh[sortTop] = high;                  \
+                sortDepth[sortTop++] = depth;                                       \
+                high = right;                                                       \
+            }                                                                       \
+        }                                                                           \
+    }                                                                               \
+    list_INSERTION_SORT_RANGE(sortBase, dataType, 0, sortCount - 1, lessExpression);\
+    (list)->sorted = false;                                                         \
+    if ((list)->hashIndex) {                                                        \
+        listIndexRebuild(list);                                                     \
+    }                                                                               \
+} while (0)
+
+
+/**
+ * @brief Sorts the elements base[low..high] with an insertion sort.
+ *
+ * Helper for list_SORT and list_SORT_STABLE. Stable.
+ */
+#define list_INSERTION_SORT_RANGE(base, dataType, low, high, lessExpression) do {   \
+    for (int sortedEnd = (low) + 1; sortedEnd <= (high); sortedEnd++) {             \
+        dataType moving = (base)[sortedEnd];                                        \
+        int hole = sortedEnd;                                                       \
+        while (hole > (low) &&                                                      \
+               list_LESS(dataType, &moving, &(base)[hole - 1], lessExpression)) {   \
+            (base)[hole] = (base)[hole - 1];                                        \
+            hole--;                                                                 \
+        }                                                                           \
+        (base)[hole] = moving;                                                      \
+    }                                                                               \
+} while (0)
+
+
+/**
+ * @brief Sorts the elements base[low..high] with a heapsort.
+ *
+ * Helper for list_SORT, used when quicksort recurses too deep.
+ */
+#define list_HEAP_SORT_RANGE(base, dataType, low, high, lessExpression) do {        \
+    dataType *heap = (base) + (low);                                                \
+    int heapCount = (high) - (low) + 1;                                             \
+    for (int heapStart = heapCount / 2 - 1, heapEnd = heapCount;                    \
+         heapEnd > 1; ) {                                                           \
+        int parent;                                                                 \
+        if (heapStart >= 0) {                                                       \
+            parent = heapStart--;                                                   \
+        } else {                                                                    \
+            heapEnd--;                                                              \
+            dataType heapTemp = heap[0]; heap[0] = heap[heapEnd];                   \
+            heap[heapEnd] = heapTemp;                                               \
+            parent = 0;                                                             \
+        }                                                                           \
+        for (int child = 2 * parent + 1; child < heapEnd; child = 2 * parent + 1) { \
+            if (child + 1 < heapEnd &&                                              \
+                list_LESS(dataType, &heap[child], &heap[child + 1],                 \
+                          lessExpression)) {                                        \
+                child++;                                                            \
+            }                                                                       \
+            if (!list_LESS(dataType, &heap[parent], &heap[child], lessExpression)) {\
+                break;                                                              \
+            }                                                                       \
+            dataType heapTemp = heap[parent]; heap[parent] = heap[child];           \
+            heap[child] = heapTemp;                                                 \
+            parent = child;                                                         \
+        }                                                                           \
+    }                                                                               \
+} while (0)
+
+
+/**
+ * @brief Sorts the list in place, keeping the order of equal elements.
+ * @param list A pointer to the list to sort.
+ * @param dataType The data type of the elements in the list.
+ * @param lessExpression The expression that is true when "a" comes before "b".
+ *
+ * Bottom-up merge sort over runs of 32 elements sorted by insertion sort. Needs
+ * a temporary buffer the size of the list.
+ *
+ * @warning Use "a" and "b" as pointers to the two elements, as in list_SORT.
+ */
+#define list_SORT_STABLE(list, dataType, lessExpression) do {                       \
+    listLinearize(list);                                                            \
+    LIST_STAT_CALL(list, SORT_STABLE);                                              \
+    int sortCount = (list)->currentCount;                                           \
+    dataType *sortSource = (dataType *)(list)->data;                                \
+    dataType *sortTarget = malloc((sortCount > 0 ? sortCount : 1) *                 \
+                                  sizeof(dataType));                                \
+    if (!sortTarget) {                                                              \
+        fprintf(stderr, "Memory allocation failed\n");                              \
+        exit(EXIT_FAILURE);                                                         \
+    }                                                                               \
+    for (int run = 0; run < sortCount; run += 32) {                                 \
+        int runEnd = run + 32 < sortCount ? run + 32 : sortCount;                   \
+        list_INSERTION_SORT_RANGE(sortSource, dataType, run, runEnd - 1,            \
+                                  lessExpression);                                  \
+    }                                                                               \
+    for (int width = 32; width < sortCount; width *= 2) {                           \
+        for (int low = 0; low < sortCount; low += 2 * width) {                      \
+            int mid = low + width < sortCount ? low + width : sortCount;            \
+            int high = mid + width < sortCount ? mid + width : sortCount;           \
+            int left = low, right = mid, out = low;                                 \
+            while (left < mid && right < high) {                                    \
+                if (list_LESS(dataType, &sortSource[right], &sortSource[left],      \
+                              lessExpression)) {                                    \
+                    sortTarget[out++] = sortSource[right++];                        \
+                } else {                                                            \
+                    sortTarget[out++] = sortSource[left++];                         \
+                }                                                                   \
+            }                                                                       \
+            while (left < mid) {                                                    \
+                sortTarget[out++] = sortSource[left++];                             \
+            }                                                                       \
+            while (right < high) {                                                  \
+                sortTarget[out++] = sortSource[right++];                            \
+            }                                                                       \
+        }                                                                           \
+        dataType *sortSwap = sortSource;                                            \
+        sortSource = sortTarget;                                                    \
+        sortTarget = sortSwap;                                                      \
+    }                                                                               \
+    if (sortSource != (dataType *)(list)->data) {                                   \
+        memcpy((list)->data, sortSource, sortCount * sizeof(dataType));             \
+        sortTarget = sortSource;                                                    \
+    }                                                                               \
+    free(sortTarget);                                                               \
+    (list)->sorted = false;                                                         \
+    if ((list)->hashIndex) {                                                        \
+        listIndexRebuild(list);                                                     \
+    }                                                                               \
+} while (0)
+
+
+/**
+ * @brief Finds the first position whose element does not come before a key.
+ * @param list A pointer to a list sorted by the same expression.
+ * @param dataType The data type of the elements in the list.
+ * @param key The value to search for.
+ * @param lessExpression The expression that is true when "a" comes before "b".
+ * @return The position where key would be inserted to keep the list sorted.
+ */
+#define list_LOWER_BOUND(list, dataType, key, lessExpression) ({                    \
+    dataType searchKey = (key);                                                     \
+    int low = 0, high = (list)->currentCount;                                       \
+    while (low < high) {                                                            \
+        int mid = low + (high - low) / 2;                                           \
+        if (list_LESS(dataType, (dataType *)listAt(list, mid), &searchKey,          \
+                      lessExpression)) {                                            \
+            low = mid + 1;                                                          \
+        } else {                                                                    \
+            high = mid;                                                             \
+        }                                                                           \
+    }                                                                               \
+    low;                                                                            \
+})
+
+
+/**
+ * @brief Searches a sorted list for a key in O(log n).
+ * @param list A pointer to a list sorted by the same expression.
+ * @param dataType The data type of the elements in the list.
+ * @param key The value to search for.
+ * @param lessExpression The expression that is true when "a" comes before "b".
+ * @return The index of the first element equal to key, or -1 if there is none.
+ *
+ * Two elements are equal when neither comes before the other.
+ */
+#define list_BINARY_SEARCH(list, dataType, key, lessExpression) ({                  \
+    dataType foundKey = (key);                                                      \
+    LIST_STAT_CALL(list, BINARY_SEARCH);                                            \
+    int foundIndex = list_LOWER_BOUND(list, dataType, foundKey, lessExpression);    \
+    (foundIndex < (list)->currentCount &&                                           \
+     !list_LESS(dataType, &foundKey, (dataType *)listAt(list, foundIndex),          \
+                lessExpression)) ? foundIndex : -1;                                 \
 })
 
 
+/**
+ * @brief Merges a sorted list into another sorted list, keeping both orders.
+ * @param list A pointer to the sorted list that receives the elements.
+ * @param other A pointer to a different sorted list of the same type; left unchanged.
+ * @param dataType The data type of the elements in the lists.
+ * @param lessExpression The expression that is true when "a" comes before "b".
+ *
+ * The list grows once and is filled from the back, so each of its elements
+ * moves at most once: O(n + m) instead of m list_ADD_AT calls. Equal elements
+ * of list come before those of other. listMergeSorted does the same for
+ * primitive types in their natural order.
+ *
+ * @warning Use "a" and "b" as pointers to the two elements, as in list_SORT.
+ */
+#define list_MERGE_SORTED(list, other, dataType, lessExpression) do {               \
+    LIST_STAT_CALL(list, MERGE_SORTED);                                             \
+    int mergeOld = (list)->currentCount;                                            \
+    int mergeCount = (other)->currentCount;                                         \
+    listGrow(list, (size_t)mergeOld + mergeCount);                                  \
+    listLinearize(list);                                                            \
+    listLinearize(other);                                                           \
+    dataType *mergeData = (dataType *)(list)->data;                                 \
+    const dataType *mergeOther = (const dataType *)(other)->data;                   \
+    int mergeLeft = mergeOld - 1;                                                   \
+    int mergeRight = mergeCount - 1;                                                \
+    int mergeOut = mergeOld + mergeCount - 1;                                       \
+    while (mergeRight >= 0) {                                                       \
+        if (mergeLeft >= 0 &&                                                       \
+            list_LESS(dataType, (dataType *)&mergeOther[mergeRight],                \
+                      &mergeData[mergeLeft], lessExpression)) {                     \
+            mergeData[mergeOut--] = mergeData[mergeLeft--];                         \
+        } else {                                                                    \
+            mergeData[mergeOut--] = mergeOther[mergeRight--];                       \
+        }                                                                           \
+    }                                                                               \
+    LIST_STAT_MOVED(list, (size_t)(mergeOld - mergeLeft - 1) * sizeof(dataType));   \
+    (list)->currentCount = mergeOld + mergeCount;                                   \
+    (list)->dataSize = (list)->currentCount * (list)->size;                         \
+    (list)->sorted = false;                                                         \
+    if ((list)->hashIndex) {                                                        \
+        listIndexRebuild(list);                                                     \
+    }                                                                               \
+} while (0)
+
+
 /**
  * @brief Converts the list to an array.
  * @param list A pointer to the list.
@@ -238,6 +1522,8 @@ typedef struct List {
  * the array, and returns the array.
  */
 #define list_TO_ARRAY(list, dataType) ({                              \
+    listLinearize(list);                                       \
+    LIST_STAT_CALL(list, TO_ARRAY);                            \
     dataType *array = malloc((list)->currentCount * (list)->size); \
     if (!array) {                                              \
         fprintf(stderr, "Memory allocation failed\n");         \
@@ -262,79 +1548,992 @@ typedef struct List {
  * 
  */
 #define list_COLLECT_TO_SUBLIST(list, dataType, expression, subList) do {           \
-    list_INIT(subList, dataType);                                                    \
+    list_COLLECT_TO_SUBLIST_WITH_ALLOCATOR(list, dataType, expression, subList,     \
+                                           (list)->allocator);                      \
+} while (0)
+
+
+/**
+ * @brief Collects elements into a sublist whose buffer comes from a given allocator.
+ * @param list A pointer to the list.
+ * @param dataType The data type of the elements in the list.
+ * @param expression The expression to evaluate for each element.
+ * @param subList A pointer to the sublist to collect the elements into.
+ * @param listAllocator The allocator of the sublist, or NULL for malloc.
+ *
+ * list_COLLECT_TO_SUBLIST uses the allocator of the source list.
+ */
+#define list_COLLECT_TO_SUBLIST_WITH_ALLOCATOR(list, dataType, expression, subList, \
+                                               listAllocator) do {                  \
+    list_INIT_WITH_ALLOCATOR(subList, dataType, LIST_DEFAULT_CAPACITY, listAllocator);\
+    LIST_STAT_CALL(list, COLLECT);                                                  \
     for (int i = 0; i < (list)->currentCount; i++) {                                \
-        dataType *element = (dataType *)((char *)(list)->data + (i * (list)->size));\
+        dataType *element = (dataType *)list_AT(list, i);                           \
         if (expression) {                                                           \
-            list_ADD(subList, dataType, *element);                                       \
+            list_ADD(subList, dataType, *element);                                  \
         }                                                                           \
     }                                                                               \
 } while (0)
 
 
 /**
- * @brief Retrieves an element from the list at a specific index.
+ * @brief Defines a ListPredicate function from an expression.
+ * @param name The name of the function to define.
+ * @param dataType The data type of the elements in the list.
+ * @param expression The expression to evaluate for each element.
+ *
+ * Use at file scope. As in list_COLLECT_TO_SUBLIST, use "element" as a pointer to
+ * the element; "context" is the pointer passed to the parallel operation.
+ */
+#define list_DEFINE_PREDICATE(name, dataType, expression)                           \
+static bool name(const void *listElement, void *context) {                          \
+    dataType *element = (dataType *)listElement;                                    \
+    (void)context;                                                                  \
+    return (expression);                                                            \
+}
+
+
+/**
+ * @brief Defines a ListAction function from a statement.
+ * @param name The name of the function to define.
+ * @param dataType The data type of the elements in the list.
+ * @param statement The statement to run for each element, using "element".
+ */
+#define list_DEFINE_ACTION(name, dataType, statement)                               \
+static void name(void *listElement, void *context) {                                \
+    dataType *element = (dataType *)listElement;                                    \
+    (void)context;                                                                  \
+    statement;                                                                      \
+}
+
+
+/**
+ * @brief Collects the elements that satisfy a predicate into a sublist using all CPUs.
  * @param list A pointer to the list.
- * @param dataType The data type of the element.
- * @param index The index of the element to retrieve.
- * @return A pointer to the element at the specified index, or NULL if the index is invalid.
+ * @param dataType The data type of the elements in the list.
+ * @param predicate A ListPredicate, usually from list_DEFINE_PREDICATE.
+ * @param context A pointer passed to every predicate call, or NULL.
+ * @param subList A pointer to the sublist to collect the elements into.
+ *
+ * The result is the same as list_COLLECT_TO_SUBLIST, in the same order. The
+ * predicate is called from several threads at once.
  */
-#define list_GET(list, dataType, index)                                             \
-    ((index) < (list)->currentCount ?                                               \
-        (dataType *)((char *)(list)->data + (index) * (list)->size) :               \
-(printf("No value\n"), (dataType*)NULL))
+#define list_PAR_COLLECT(list, dataType, predicate, context, subList) do {          \
+    list_INIT_WITH_ALLOCATOR(subList, dataType, LIST_DEFAULT_CAPACITY,              \
+                             (list)->allocator);                                    \
+    LIST_STAT_CALL(list, PAR_COLLECT);                                              \
+    listParallelCollect(list, predicate, context, subList);                         \
+} while (0)
 
 
 /**
- * @brief Sets an element at a specific index in the list.
+ * @brief Runs an action on every element of the list using all CPUs.
  * @param list A pointer to the list.
- * @param dataType The data type of the element.
- * @param index The index at which to set the element.
- * @param inputData The new element to set at the specified index.
+ * @param dataType The data type of the elements in the list.
+ * @param action A ListAction, usually from list_DEFINE_ACTION.
+ * @param context A pointer passed to every action call, or NULL.
+ */
+#define list_PAR_FOR_EACH(list, dataType, action, context)                          \
+    (LIST_STAT_CALL(list, PAR_FOR_EACH), listParallelForEach(list, action, context))
+
+
+/**
+ * @brief Runs a statement for every element of a list or a view.
+ * @param list A pointer to a List or to a ListView.
+ * @param dataType The data type of the elements.
+ * @param statement The statement to run, using "element" as a pointer to the element.
  *
- * This macro replaces the element at the specified index with the new element.
+ * The statement may edit the elements, so a List is no longer marked as sorted.
  */
-#define list_SET(list, dataType, index, inputData) do {                             \
-    dataType temp = (inputData);                                                    \
-    if ((index) < 0 || (index) >= (list)->currentCount) {                           \
-        printf("Invalid index: %d\n", (index));                                     \
-        break;                                                                      \
+#define list_FOR_EACH(list, dataType, statement) do {                               \
+    LIST_STAT_CALL(list, FOR_EACH);                                                 \
+    listClearSorted(LIST_MUTABLE_OF(list));                                         \
+    for (int i = 0; i < (list)->currentCount; i++) {                                \
+        dataType *element = (dataType *)list_AT(list, i);                           \
+        statement;                                                                  \
     }                                                                               \
-    memcpy((char *)(list)->data + ((index) * (list)->size), &temp, (list)->size);   \
-    (list)->dataSize = (list)->currentCount * (list)->size;                         \
-    (list)->listSize = (list)->initSize * (list)->size;                             \
 } while (0)
 
 
 /**
- * @brief Converts an array to a list.
- * @param list A pointer to the list to which to add the array elements.
- * @param dataType The data type of the elements in the array.
- * @param array The array to convert to a list.
+ * @brief Selects the positions of the elements that satisfy an expression.
+ * @param list A pointer to a List or to a ListView.
+ * @param dataType The data type of the elements.
+ * @param expression The expression to evaluate for each element.
+ * @param selection A pointer to an initialized ListSelection that receives the positions.
  *
- * This macro iterates over the elements of the array and adds each one to the list.
+ * Unlike list_COLLECT_TO_SUBLIST no element is copied: the selection holds one
+ * 32-bit position per match, and its buffer is reused by the next call. Read the
+ * elements back with list_AT(list, selection->positions[i]).
+ *
+ * @warning Use "element" to compare and treat it as a pointer, as in list_COLLECT_TO_SUBLIST.
  */
-#define list_ARRAY_TO_LIST(list, dataType, array) do {                      \
-    size_t arraySize = sizeof(array) / sizeof((array)[0]);           \
-    for (size_t i = 0; i < arraySize; i++) {                         \
-        list_ADD(list, dataType, array[i]);                               \
-    }                                                                \
+#define list_SELECT(list, dataType, expression, selection) do {                     \
+    LIST_STAT_CALL(list, SELECT);                                                   \
+    (selection)->currentCount = 0;                                                  \
+    for (int i = 0; i < (list)->currentCount; i++) {                                \
+        dataType *element = (dataType *)list_AT(list, i);                           \
+        if (expression) {                                                           \
+            if ((selection)->currentCount == (selection)->capacity) {               \
+                listSelectionGrow(selection);                                       \
+            }                                                                       \
+            (selection)->positions[(selection)->currentCount++] = (uint32_t)i;      \
+        }                                                                           \
+    }                                                                               \
 } while (0)
 
-int listLength(List *list);
 
-char *listGetName(List *list);
+/*
+ * Pipeline stages of the list_PIPE_* macros, fused into one loop. A stage
+ * written as FILTER(expression) pastes into list_PIPE_FILTER(expression).
+ *   FILTER(expression)          skips the elements for which expression is false
+ *   MAP(dataType, expression)   continues with "element" pointing to the dataType result
+ *   TAKE(limit)                 passes at most limit elements, then ends the loop
+ * Each stage opens a block that the terminal closes, so MAP can declare a new
+ * element, and knows its position so TAKE has a counter of its own.
+ */
+#define list_PIPE_EACH(macro, ...)                                                  \
+    list_CONCAT(list_PIPE_EACH_, list_COUNT_FIELDS(__VA_ARGS__))(macro, __VA_ARGS__)
+#define list_PIPE_EACH_1(m, s) m(1, s)
+#define list_PIPE_EACH_2(m, s, ...) m(2, s) list_PIPE_EACH_1(m, __VA_ARGS__)
+#define list_PIPE_EACH_3(m, s, ...) m(3, s) list_PIPE_EACH_2(m, __VA_ARGS__)
+#define list_PIPE_EACH_4(m, s, ...) m(4, s) list_PIPE_EACH_3(m, __VA_ARGS__)
+#define list_PIPE_EACH_5(m, s, ...) m(5, s) list_PIPE_EACH_4(m, __VA_ARGS__)
+#define list_PIPE_EACH_6(m, s, ...) m(6, s) list_PIPE_EACH_5(m, __VA_ARGS__)
+#define list_PIPE_EACH_7(m, s, ...) m(7, s) list_PIPE_EACH_6(m, __VA_ARGS__)
+#define list_PIPE_EACH_8(m, s, ...) m(8, s) list_PIPE_EACH_7(m, __VA_ARGS__)
+#define list_PIPE_EACH_9(m, s, ...) m(9, s) list_PIPE_EACH_8(m, __VA_ARGS__)
+#define list_PIPE_EACH_10(m, s, ...) m(10, s) list_PIPE_EACH_9(m, __VA_ARGS__)
+#define list_PIPE_EACH_11(m, s, ...) m(11, s) list_PIPE_EACH_10(m, __VA_ARGS__)
+#define list_PIPE_EACH_12(m, s, ...) m(12, s) list_PIPE_EACH_11(m, __VA_ARGS__)
+#define list_PIPE_EACH_13(m, s, ...) m(13, s) list_PIPE_EACH_12(m, __VA_ARGS__)
+#define list_PIPE_EACH_14(m, s, ...) m(14, s) list_PIPE_EACH_13(m, __VA_ARGS__)
+#define list_PIPE_EACH_15(m, s, ...) m(15, s) list_PIPE_EACH_14(m, __VA_ARGS__)
+#define list_PIPE_EACH_16(m, s, ...) m(16, s) list_PIPE_EACH_15(m, __VA_ARGS__)
+#define list_PIPE_STAGE(index, stage) { enum { listPipeStage = index }; list_PIPE_##stage;
+#define list_PIPE_CLOSE(stage) }
+#define list_PIPE_FILTER(expression) if (!(expression)) continue
+#define list_PIPE_MAP(dataType, expression)                                         \
+    dataType listPipeValue = (expression);                                          \
+    dataType *element = &listPipeValue
+#define list_PIPE_TAKE(limit)                                                       \
+    if (listPipeTaken[listPipeStage] == (size_t)(limit)) break;                     \
+    if (++listPipeTaken[listPipeStage] == (size_t)(limit)) listPipeDone = true
 
-char *listGetDataType(List *list);
 
-void listFree(List *list);
+/**
+ * @brief Runs the stages of a pipeline and a terminal statement in one pass.
+ * @param list A pointer to a List or to a ListView.
+ * @param dataType The data type of the elements.
+ * @param terminal The statement run for each element that passes every stage.
+ * @param ... One to 16 stages: FILTER, MAP and TAKE.
+ *
+ * Used by the list_PIPE_* terminals; the terminal may set listPipeDone to stop
+ * early. Nothing is allocated and no intermediate list is built. A List is
+ * linearized first and then walked as a view, so the loop is a plain strided scan.
+ */
+#define list_PIPE_RUN(list, dataType, terminal, ...) do {                           \
+    size_t listPipeTaken[list_COUNT_FIELDS(__VA_ARGS__) + 1] = {0};                 \
+    bool listPipeDone = false;                                                      \
+    (void)listPipeTaken;                                                            \
+    LIST_STAT_CALL(list, PIPE);                                                     \
+    ListView listPipeView = list_AS_VIEW(list);                                     \
+    for (int i = 0; !listPipeDone && i < listPipeView.currentCount; i++) {          \
+        dataType *element = (dataType *)listViewAt(&listPipeView, i);               \
+        list_PIPE_EACH(list_PIPE_STAGE, __VA_ARGS__)                                \
+        (void)element;                                                              \
+        terminal;                                                                   \
+        list_EACH_FIELD(list_PIPE_CLOSE, __VA_ARGS__)                               \
+    }                                                                               \
+} while (0)
 
-void *listGetMemoryAddress(List *list, int index);
 
-bool listIsEmpty(List *list);    
+/**
+ * @brief Counts the elements that come out of a pipeline.
+ * @param list A pointer to a List or to a ListView.
+ * @param dataType The data type of the elements.
+ * @param ... One to 16 stages: FILTER(expression), MAP(dataType, expression), TAKE(limit).
+ * @return The number of elements, as a size_t.
+ *
+ * @code
+ * size_t count = list_PIPE_COUNT(&people, Person, FILTER(element->age > 30),
+ *                                MAP(int, element->dateOfBirth.YYYY),
+ *                                FILTER(*element < 1990), TAKE(100));
+ * @endcode
+ *
+ * @warning Use "element" as a pointer in the stages, as in list_COLLECT_TO_SUBLIST.
+ */
+#define list_PIPE_COUNT(list, dataType, ...) ({                                     \
+    size_t listPipeCount = 0;                                                       \
+    list_PIPE_RUN(list, dataType, listPipeCount++, __VA_ARGS__);                    \
+    listPipeCount;                                                                  \
+})
 
-size_t listSizeOf(List *list);
 
-size_t listSizeOfData(List *list);
+/**
+ * @brief Adds up the elements that come out of a pipeline.
+ * @param list A pointer to a List or to a ListView.
+ * @param dataType The data type of the elements.
+ * @param sumType The type of the sum, such as long long or double.
+ * @param ... One to 16 stages, the last element type convertible to sumType.
+ * @return The sum, 0 if no element comes out.
+ */
+#define list_PIPE_SUM(list, dataType, sumType, ...) ({                              \
+    sumType listPipeSum = 0;                                                        \
+    list_PIPE_RUN(list, dataType, listPipeSum += *element, __VA_ARGS__);            \
+    listPipeSum;                                                                    \
+})
+
+
+/**
+ * @brief Finds the smallest element that comes out of a pipeline.
+ * @param list A pointer to a List or to a ListView.
+ * @param dataType The data type of the elements.
+ * @param result A pointer that receives the smallest element, compared with <.
+ * @param ... One to 16 stages.
+ * @return true if an element came out, false if result was left unchanged.
+ */
+#define list_PIPE_MIN(list, dataType, result, ...) ({                               \
+    bool listPipeFound = false;                                                     \
+    list_PIPE_RUN(list, dataType,                                                   \
+                  if (!listPipeFound || *element < *(result)) {                     \
+                      *(result) = *element;                                         \
+                      listPipeFound = true;                                         \
+                  }, __VA_ARGS__);                                                  \
+    listPipeFound;                                                                  \
+})
+
+
+/**
+ * @brief Finds the largest element that comes out of a pipeline.
+ * @param list A pointer to a List or to a ListView.
+ * @param dataType The data type of the elements.
+ * @param result A pointer that receives the largest element, compared with >.
+ * @param ... One to 16 stages.
+ * @return true if an element came out, false if result was left unchanged.
+ */
+#define list_PIPE_MAX(list, dataType, result, ...) ({                               \
+    bool listPipeFound = false;                                                     \
+    list_PIPE_RUN(list, dataType,                                                   \
+                  if (!listPipeFound || *element > *(result)) {                     \
+                      *(result) = *element;                                         \
+                      listPipeFound = true;                                         \
+                  }, __VA_ARGS__);                                                  \
+    listPipeFound;                                                                  \
+})
+
+
+/**
+ * @brief Gets the first element that comes out of a pipeline and stops there.
+ * @param list A pointer to a List or to a ListView.
+ * @param dataType The data type of the elements.
+ * @param result A pointer that receives the element.
+ * @param ... One to 16 stages.
+ * @return true if an element came out, false if result was left unchanged.
+ */
+#define list_PIPE_FIRST(list, dataType, result, ...) ({                             \
+    bool listPipeFound = false;                                                     \
+    list_PIPE_RUN(list, dataType,                                                   \
+                  *(result) = *element; listPipeFound = listPipeDone = true,        \
+                  __VA_ARGS__);                                                     \
+    listPipeFound;                                                                  \
+})
+
+
+/**
+ * @brief Appends the elements that come out of a pipeline to a list.
+ * @param list A pointer to a List or to a ListView.
+ * @param dataType The data type of the elements.
+ * @param subList A pointer to an initialized List of the last element type.
+ * @param ... One to 16 stages.
+ *
+ * The only pipeline step that allocates. Initialize subList with
+ * list_INIT_WITH_CAPACITY, for example with the TAKE limit, so it does not grow.
+ */
+#define list_PIPE_COLLECT(list, dataType, subList, ...)                             \
+    list_PIPE_RUN(list, dataType, list_ADD(subList, __typeof__(*element), *element),\
+                  __VA_ARGS__)
+
+
+/**
+ * @brief Retrieves an element from the list at a specific index.
+ * @param list A pointer to the list.
+ * @param dataType The data type of the element.
+ * @param index The index of the element to retrieve.
+ * @return A pointer to the element at the specified index, or NULL if the index is invalid.
+ *
+ * The element may be edited through the pointer, so a List is no longer marked
+ * as sorted; call listSort again to restore binary-search lookups.
+ */
+#define list_GET(list, dataType, index)                                             \
+    (LIST_STAT_CALL(list, GET), listClearSorted(LIST_MUTABLE_OF(list)),             \
+     (index) < (list)->currentCount ?                                               \
+        (dataType *)list_AT(list, index) :                                          \
+(printf("No value\n"), (dataType*)NULL))
+
+
+/**
+ * @brief Sets an element at a specific index in the list.
+ * @param list A pointer to the list.
+ * @param dataType The data type of the element.
+ * @param index The index at which to set the element.
+ * @param inputData The new element to set at the specified index.
+ *
+ * This macro replaces the element at the specified index with the new element.
+ */
+#define list_SET(list, dataType, index, inputData) do {                             \
+    dataType temp = (inputData);                                                    \
+    LIST_STAT_CALL(list, SET);                                                      \
+    if ((index) < 0 || (index) >= (list)->currentCount) {                           \
+        printf("Invalid index: %d\n", (index));                                     \
+        break;                                                                      \
+    }                                                                               \
+    if ((list)->hashIndex) {                                                        \
+        listIndexUnlink(list, (index));                                             \
+    }                                                                               \
+    memcpy(listAt(list, (index)), &temp, (list)->size);                             \
+    (list)->sorted = false;                                                         \
+    if ((list)->hashIndex) {                                                        \
+        listIndexLink(list, (index));                                               \
+    }                                                                               \
+    (list)->dataSize = (list)->currentCount * (list)->size;                         \
+    (list)->listSize = (list)->initSize * (list)->size;                             \
+} while (0)
+
+
+/**
+ * @brief Converts an array to a list.
+ * @param list A pointer to the list to which to add the array elements.
+ * @param dataType The data type of the elements in the array.
+ * @param array The array to convert to a list.
+ *
+ * This macro appends every element of a static array to the list with a single
+ * growth and a single copy. Use list_ARRAY_TO_LIST_N for a runtime pointer.
+ */
+#define list_ARRAY_TO_LIST(list, dataType, array) do {                      \
+    size_t arraySize = sizeof(array) / sizeof((array)[0]);                   \
+    list_ARRAY_TO_LIST_N(list, dataType, array, arraySize);                  \
+} while (0)
+
+
+/**
+ * @brief Appends count elements read from a pointer to the list.
+ * @param list A pointer to the list to which to add the elements.
+ * @param dataType The data type of the elements.
+ * @param array A pointer to the first element to add.
+ * @param count The number of elements to add.
+ */
+#define list_ARRAY_TO_LIST_N(list, dataType, array, count) do {             \
+    _Static_assert(sizeof(*(array)) == sizeof(dataType),                     \
+                   "array element size does not match list data type");      \
+    listAppendRange(list, (array), (size_t)(count));                         \
+} while (0)
+
+int listLength(List *list);
+
+char *listGetName(List *list);
+
+char *listGetDataType(List *list);
+
+void listFree(List *list);
+
+void *listGetMemoryAddress(List *list, int index);
+
+bool listIsEmpty(List *list);    
+
+size_t listSizeOf(List *list);
+
+size_t listSizeOfData(List *list);
+
+void *listAllocate(List *list, size_t size);
+
+void listInitBuffer(List *list, size_t capacity);
+
+bool listIsInline(List *list);
+
+void listSetAllocator(List *list, const ListAllocator *allocator);
+
+void listArenaInit(ListArena *arena, size_t blockSize);
+
+const ListAllocator *listArenaAllocator(ListArena *arena);
+
+void listArenaReset(ListArena *arena);
+
+void listArenaDestroy(ListArena *arena);
+
+void listPoolInit(ListPool *pool);
+
+const ListAllocator *listPoolAllocator(ListPool *pool);
+
+void listPoolDestroy(ListPool *pool);
+
+void listGrow(List *list, size_t minCapacity);
+
+void listReserve(List *list, size_t capacity);
+
+void listSetGrowthPolicy(List *list, ListGrowthPolicy policy, size_t step);
+
+void listShrinkToFit(List *list);
+
+void listSetAutoShrink(List *list, bool enabled);
+
+void listMaybeShrink(List *list);
+
+void listLinearize(List *list);
+
+void listSetIncrementalResize(List *list, bool enabled);
+
+#ifdef LIST_STATS
+ListStats *listStatsRegister(List *list);
+
+void listStatsRelease(List *list);
+#endif
+
+void listStatsDump(List *list, FILE *out);
+
+void listStatsDumpAll(FILE *out);
+
+int listResizeStep(List *list, int budget);
+
+void listAppendRange(List *list, const void *src, size_t count);
+
+void listInsertBatch(List *list, const size_t *indices, const void *elems, size_t k);
+
+int listIndexOf(List *list, const void *value);
+
+size_t listHashBytes(const void *element, size_t size);
+
+bool listEqualsBytes(const void *a, const void *b, size_t size);
+
+void listRegisterType(const char *dataType, ListEqualsFn equals, ListHashFn hash);
+
+void listBindType(List *list);
+
+void listSetTypeOps(List *list, ListEqualsFn equals, ListHashFn hash);
+
+void listEnableIndex(List *list, ListHashFn hash, ListEqualsFn equals);
+
+void listDisableIndex(List *list);
+
+void listIndexRebuild(List *list);
+
+int listIndexFind(List *list, const void *value);
+
+void listIndexLink(List *list, int position);
+
+void listIndexUnlink(List *list, int position);
+
+/**
+ * @brief Primitive kind of an expression, as listKindOf reports for its type name.
+ */
+#define list_KIND_OF(expression) _Generic((expression),                             \
+    int: LIST_KIND_I32,                                                             \
+    unsigned int: LIST_KIND_U32,                                                    \
+    long: (sizeof(long) == 8 ? LIST_KIND_I64 : LIST_KIND_I32),                      \
+    unsigned long: (sizeof(long) == 8 ? LIST_KIND_U64 : LIST_KIND_U32),             \
+    long long: LIST_KIND_I64,                                                       \
+    unsigned long long: LIST_KIND_U64,                                              \
+    float: LIST_KIND_F32,                                                           \
+    double: LIST_KIND_F64,                                                          \
+    default: LIST_KIND_OTHER)
+
+
+/**
+ * @brief Initializes a columnar list with one column per schema field.
+ * @param soa A pointer to the ListSoA to initialize.
+ * @param dataType The row data type described by the schema.
+ * @param schema The ListSchema naming the fields to store.
+ *
+ * Fields left out of the schema are not stored and read back as zero. Nested
+ * members are allowed, e.g. list_FIELD(Person, dateOfBirth.YYYY).
+ */
+#define list_SOA_INIT(soa, dataType, schema) do {                                   \
+    (soa)->dataTypeOf = (char *)#dataType;                                          \
+    (soa)->nameOf = (char *)#soa;                                                   \
+    listSoAInit(soa, &(schema), sizeof(dataType));                                  \
+} while (0)
+
+
+/**
+ * @brief Adds a row to a columnar list, writing each field to its column.
+ * @param soa A pointer to the ListSoA.
+ * @param dataType The row data type.
+ * @param inputData The row to add.
+ */
+#define list_SOA_ADD(soa, dataType, inputData) do {                                 \
+    dataType temp = (inputData);                                                    \
+    listSoAAdd(soa, &temp);                                                         \
+} while (0)
+
+
+/**
+ * @brief Gathers a row of a columnar list back into a struct.
+ * @param soa A pointer to the ListSoA.
+ * @param dataType The row data type.
+ * @param index The index of the row.
+ * @return The row by value; all zero if the index is invalid.
+ */
+#define list_SOA_GET(soa, dataType, index) ({                                       \
+    dataType row;                                                                   \
+    listSoAGather(soa, index, &row);                                                \
+    row;                                                                            \
+})
+
+
+/**
+ * @brief Replaces the row at an index of a columnar list.
+ * @param soa A pointer to the ListSoA.
+ * @param dataType The row data type.
+ * @param index The index of the row to replace.
+ * @param inputData The new row.
+ */
+#define list_SOA_SET(soa, dataType, index, inputData) do {                          \
+    dataType temp = (inputData);                                                    \
+    listSoASet(soa, index, &temp);                                                  \
+} while (0)
+
+
+/**
+ * @brief Removes the row at an index of a columnar list.
+ */
+#define list_SOA_REMOVE_AT(soa, index) listSoARemoveAt(soa, index)
+
+
+/**
+ * @brief Removes the first row whose stored fields equal those of inputData.
+ * @param soa A pointer to the ListSoA.
+ * @param dataType The row data type.
+ * @param inputData The row to remove.
+ */
+#define list_SOA_REMOVE(soa, dataType, inputData) do {                              \
+    dataType temp = (inputData);                                                    \
+    int foundIndex = listSoAIndexOf(soa, &temp);                                    \
+    if (foundIndex != -1) {                                                         \
+        listSoARemoveAt(soa, foundIndex);                                           \
+    } else {                                                                        \
+        printf("Value not found in the list.\n");                                   \
+    }                                                                               \
+} while (0)
+
+
+/**
+ * @brief Gets the column of one field as a typed array.
+ * @param soa A pointer to the ListSoA.
+ * @param dataType The row data type.
+ * @param member The field, which must be in the schema.
+ * @return A pointer to currentCount values of the field's type, or NULL.
+ */
+#define list_SOA_COLUMN(soa, dataType, member)                                      \
+    ((__typeof__(((dataType *)0)->member) *)listSoAColumn(soa,                      \
+                                                          offsetof(dataType, member)))
+
+
+/**
+ * @brief Gets the column of one field as a ListView for the view kernels.
+ * @param soa A pointer to the ListSoA.
+ * @param dataType The row data type.
+ * @param member The field, which must be in the schema.
+ */
+#define list_SOA_COLUMN_VIEW(soa, dataType, member)                                 \
+    listSoAColumnView(soa, offsetof(dataType, member),                              \
+                      list_KIND_OF(((dataType *)0)->member))
+
+
+/**
+ * @brief Selects the rows whose field satisfies an expression, scanning only that column.
+ * @param soa A pointer to the ListSoA.
+ * @param dataType The row data type.
+ * @param member The field to test, which must be in the schema.
+ * @param expression The expression to evaluate for each row.
+ * @param selection A pointer to an initialized ListSelection that receives the positions.
+ *
+ * The loop has no branch on the expression, so simple comparisons vectorize.
+ * Gather the matches with list_SOA_GET or listSoACopySelection.
+ *
+ * @warning Use "value" in the expression; it is the field's value, not a pointer.
+ */
+#define list_SOA_SELECT(soa, dataType, member, expression, selection) do {          \
+    const __typeof__(((dataType *)0)->member) *column =                             \
+        list_SOA_COLUMN(soa, dataType, member);                                     \
+    int selected = 0;                                                               \
+    listSelectionReserve(selection, (soa)->currentCount);                           \
+    for (int i = 0; i < (soa)->currentCount; i++) {                                 \
+        __typeof__(((dataType *)0)->member) value = column[i];                      \
+        (selection)->positions[selected] = (uint32_t)i;                             \
+        selected += (expression) ? 1 : 0;                                           \
+    }                                                                               \
+    (selection)->currentCount = selected;                                           \
+} while (0)
+
+
+/**
+ * @brief Collects the rows that satisfy an expression into another columnar list.
+ * @param soa A pointer to the ListSoA.
+ * @param dataType The row data type.
+ * @param expression The expression to evaluate for each row.
+ * @param subSoA A pointer to the ListSoA to collect into; it is initialized here.
+ *
+ * Every row is gathered to evaluate the expression. When the test reads one
+ * field, list_SOA_SELECT followed by listSoACopySelection is faster.
+ *
+ * @warning Use "element" to compare and treat it as a pointer, as in list_COLLECT_TO_SUBLIST.
+ */
+#define list_SOA_COLLECT(soa, dataType, expression, subSoA) do {                    \
+    listSoAInit(subSoA, (soa)->schema, (soa)->size);                                \
+    (subSoA)->dataTypeOf = (soa)->dataTypeOf;                                       \
+    (subSoA)->nameOf = (char *)#subSoA;                                             \
+    for (int i = 0; i < (soa)->currentCount; i++) {                                 \
+        dataType row;                                                               \
+        listSoAGather(soa, i, &row);                                                \
+        dataType *element = &row;                                                   \
+        if (expression) {                                                           \
+            listSoAAdd(subSoA, element);                                            \
+        }                                                                           \
+    }                                                                               \
+} while (0)
+
+
+/**
+ * @brief Initializes a list for lock-free concurrent appends.
+ * @param list A pointer to the ListConcurrent to initialize.
+ * @param dataType The data type of the elements.
+ *
+ * Initialization and listConcurrentFree must not overlap with other calls.
+ */
+#define list_CONCURRENT_INIT(list, dataType) do {                                   \
+    (list)->dataTypeOf = (char *)#dataType;                                         \
+    (list)->nameOf = (char *)#list;                                                 \
+    listConcurrentInit(list, sizeof(dataType));                                     \
+} while (0)
+
+
+/**
+ * @brief Appends an element; safe to call from many threads at once.
+ * @param list A pointer to the ListConcurrent.
+ * @param dataType The data type of the element to add.
+ * @param inputData The element to add.
+ * @return The index the element was stored at.
+ */
+#define list_CONCURRENT_ADD(list, dataType, inputData) ({                           \
+    dataType temp = (inputData);                                                    \
+    listConcurrentAdd(list, &temp);                                                 \
+})
+
+
+/**
+ * @brief Gets an element of a concurrent list.
+ * @param list A pointer to the ListConcurrent.
+ * @param dataType The data type of the element.
+ * @param index The index of the element.
+ * @return A pointer that stays valid until listConcurrentFree, or NULL if the
+ *         element has not been published yet.
+ */
+#define list_CONCURRENT_GET(list, dataType, index)                                  \
+    ((dataType *)listConcurrentGet(list, index))
+
+
+/**
+ * @brief Runs a statement for every published element of a concurrent list.
+ * @param list A pointer to the ListConcurrent.
+ * @param dataType The data type of the elements.
+ * @param statement The statement to run, with "element" pointing to the element.
+ *
+ * Elements whose append is still in progress are skipped.
+ */
+#define list_CONCURRENT_FOR_EACH(list, dataType, statement) do {                    \
+    int count = listConcurrentLength(list);                                         \
+    for (int i = 0; i < count; i++) {                                               \
+        dataType *element = (dataType *)listConcurrentGet(list, i);                 \
+        if (element) {                                                              \
+            statement;                                                              \
+        }                                                                           \
+    }                                                                               \
+} while (0)
+
+
+/**
+ * @brief Initializes a segmented list.
+ * @param list A pointer to the ListSegmented to initialize.
+ * @param dataType The data type of the elements.
+ */
+#define list_SEG_INIT(list, dataType) do {                                          \
+    (list)->dataTypeOf = (char *)#dataType;                                         \
+    (list)->nameOf = (char *)#list;                                                 \
+    listSegInit(list, sizeof(dataType));                                            \
+} while (0)
+
+
+/**
+ * @brief Adds an element to a segmented list without moving existing elements.
+ * @param list A pointer to the ListSegmented.
+ * @param dataType The data type of the element to add.
+ * @param inputData The element to add.
+ */
+#define list_SEG_ADD(list, dataType, inputData) do {                                \
+    dataType temp = (inputData);                                                    \
+    memcpy(listSegAppend(list), &temp, (list)->size);                               \
+} while (0)
+
+
+/**
+ * @brief Retrieves an element of a segmented list.
+ * @param list A pointer to the ListSegmented.
+ * @param dataType The data type of the element.
+ * @param index The index of the element to retrieve.
+ * @return A pointer that stays valid across adds, or NULL if the index is invalid.
+ */
+#define list_SEG_GET(list, dataType, index)                                         \
+    ((index) >= 0 && (index) < (list)->currentCount ?                               \
+        (dataType *)listSegAt(list, index) :                                        \
+        (printf("No value\n"), (dataType *)NULL))
+
+
+/**
+ * @brief Sets an element at a specific index of a segmented list.
+ * @param list A pointer to the ListSegmented.
+ * @param dataType The data type of the element.
+ * @param index The index at which to set the element.
+ * @param inputData The new element.
+ */
+#define list_SEG_SET(list, dataType, index, inputData) do {                         \
+    if ((index) >= 0 && (index) < (list)->currentCount) {                           \
+        dataType temp = (inputData);                                                \
+        memcpy(listSegAt(list, index), &temp, (list)->size);                        \
+    } else {                                                                        \
+        printf("Invalid index: %d\n", (int)(index));                                \
+    }                                                                               \
+} while (0)
+
+
+/**
+ * @brief Removes the element at an index of a segmented list.
+ */
+#define list_SEG_REMOVE_AT(list, index) listSegRemoveAt(list, index)
+
+
+/**
+ * @brief Removes the first occurrence of an element from a segmented list.
+ * @param list A pointer to the ListSegmented.
+ * @param dataType The data type of the element.
+ * @param inputData The element to remove.
+ */
+#define list_SEG_REMOVE(list, dataType, inputData) do {                             \
+    dataType temp = (inputData);                                                    \
+    int foundIndex = listSegIndexOf(list, &temp);                                   \
+    if (foundIndex != -1) {                                                         \
+        listSegRemoveAt(list, foundIndex);                                          \
+    } else {                                                                        \
+        printf("Value not found in the list.\n");                                   \
+    }                                                                               \
+} while (0)
+
+
+/**
+ * @brief Gets the index of the first occurrence of an element in a segmented list.
+ * @return The index, or -1 if the element is not found.
+ */
+#define list_SEG_GET_INDEX_OF(list, dataType, inputData) ({                         \
+    dataType temp = (inputData);                                                    \
+    listSegIndexOf(list, &temp);                                                    \
+})
+
+
+/**
+ * @brief Checks whether a segmented list contains an element.
+ */
+#define list_SEG_CONTAINS(list, dataType, inputData)                                \
+    (list_SEG_GET_INDEX_OF(list, dataType, inputData) != -1)
+
+
+/**
+ * @brief Runs a statement for every element of a segmented list, segment by segment.
+ * @param list A pointer to the ListSegmented.
+ * @param dataType The data type of the elements.
+ * @param statement The statement to run, with "element" pointing to the element.
+ */
+#define list_SEG_FOR_EACH(list, dataType, statement) do {                           \
+    int remaining = (list)->currentCount;                                           \
+    for (int segment = 0; remaining > 0; segment++) {                               \
+        int count = listSegmentCapacity(segment) < (size_t)remaining ?              \
+                    (int)listSegmentCapacity(segment) : remaining;                  \
+        dataType *base = (dataType *)(list)->segments[segment];                     \
+        for (int i = 0; i < count; i++) {                                           \
+            dataType *element = base + i;                                           \
+            statement;                                                              \
+        }                                                                           \
+        remaining -= count;                                                         \
+    }                                                                               \
+} while (0)
+
+
+/**
+ * @brief Converts a segmented list to a new contiguous array.
+ * @return A malloc'd array of currentCount elements; free it when done.
+ */
+#define list_SEG_TO_ARRAY(list, dataType) ((dataType *)listSegToArray(list))
+
+
+/**
+ * @brief Collects the elements of a segmented list that satisfy an expression.
+ * @param list A pointer to the ListSegmented.
+ * @param dataType The data type of the elements.
+ * @param expression The expression to evaluate for each element.
+ * @param subList A pointer to the ListSegmented to collect into; it is initialized here.
+ *
+ * @warning Use "element" to compare and treat it as a pointer, as in list_COLLECT_TO_SUBLIST.
+ */
+#define list_SEG_COLLECT_TO_SUBLIST(list, dataType, expression, subList) do {       \
+    list_SEG_INIT(subList, dataType);                                               \
+    list_SEG_FOR_EACH(list, dataType,                                               \
+        if (expression) {                                                           \
+            memcpy(listSegAppend(subList), element, sizeof(dataType));              \
+        });                                                                         \
+} while (0)
+
+
+void listIndexAfterInsert(List *list, int position);
+
+void listIndexBeforeRemove(List *list, int position);
+
+ListKind listKindOf(const char *dataType, size_t size);
+
+ListSimdLevel listSimdLevel(void);
+
+void listSimdSetLevel(ListSimdLevel level);
+
+int listFindFirst(List *list, const void *value);
+
+size_t listCountEqual(List *list, const void *value);
+
+bool listMin(List *list, void *out);
+
+bool listMax(List *list, void *out);
+
+double listSum(List *list);
+
+bool listSumI64(List *list, int64_t *out);
+
+bool listSumU64(List *list, uint64_t *out);
+
+bool listSort(List *list);
+
+bool listSave(List *list, const char *path);
+
+bool listOpenMapped(List *list, const char *path, size_t elementSize);
+
+bool listVerifyChecksum(List *list);
+
+void listUnmap(List *list);
+
+void listRegisterSchema(const ListSchema *schema);
+
+const ListSchema *listFindSchema(const char *dataType);
+
+bool listStreamWrite(List *list, FILE *out);
+
+bool listStreamWriteFd(List *list, int fd);
+
+bool listStreamRead(List *list, FILE *in, ListArena *arena, size_t elementSize);
+
+bool listStreamReadFd(List *list, int fd, ListArena *arena, size_t elementSize);
+
+ListView listAsView(List *list);
+
+ListView listSlice(List *list, int start, int length);
+
+ListView listSliceStep(List *list, int start, int length, int step);
+
+ListView listViewSlice(const ListView *view, int start, int length);
+
+void *listViewGet(const ListView *view, int index);
+
+int listViewFindFirst(const ListView *view, const void *value);
+
+size_t listViewCountEqual(const ListView *view, const void *value);
+
+bool listViewMin(const ListView *view, void *out);
+
+bool listViewMax(const ListView *view, void *out);
+
+double listViewSum(const ListView *view);
+
+bool listViewSumI64(const ListView *view, int64_t *out);
+
+bool listViewSumU64(const ListView *view, uint64_t *out);
+
+void listSelectionInit(ListSelection *selection);
+
+void listSelectionGrow(ListSelection *selection);
+
+void listSelectionReserve(ListSelection *selection, int capacity);
+
+bool listViewSelectRange(const ListView *view, const void *low, const void *high,
+                         ListSelection *selection);
+
+bool listSoAInit(ListSoA *soa, const ListSchema *schema, size_t size);
+
+void listSoAReserve(ListSoA *soa, int capacity);
+
+void listSoAAdd(ListSoA *soa, const void *row);
+
+bool listSoAGather(const ListSoA *soa, int index, void *row);
+
+void listSoASet(ListSoA *soa, int index, const void *row);
+
+void listSoARemoveAt(ListSoA *soa, int index);
+
+int listSoAIndexOf(const ListSoA *soa, const void *row);
+
+void *listSoAColumn(const ListSoA *soa, size_t offset);
+
+ListView listSoAColumnView(const ListSoA *soa, size_t offset, ListKind kind);
+
+void listSoACopySelection(const ListSoA *soa, const ListSelection *selection, ListSoA *subSoA);
+
+int listSoALength(const ListSoA *soa);
+
+void listSoAFree(ListSoA *soa);
+
+void listConcurrentInit(ListConcurrent *list, size_t size);
+
+int listConcurrentAdd(ListConcurrent *list, const void *element);
+
+void *listConcurrentGet(ListConcurrent *list, int index);
+
+int listConcurrentLength(ListConcurrent *list);
+
+void listConcurrentFree(ListConcurrent *list);
+
+void listSegInit(ListSegmented *list, size_t size);
+
+void *listSegAppend(ListSegmented *list);
+
+void listSegRemoveAt(ListSegmented *list, int index);
+
+int listSegIndexOf(ListSegmented *list, const void *value);
+
+void *listSegToArray(ListSegmented *list);
+
+int listSegLength(ListSegmented *list);
+
+void listSegFree(ListSegmented *list);
+
+void listSelectionFree(ListSelection *selection);
+
+int listSortedIndexOf(List *list, const void *value);
+
+bool listMergeSorted(List *list, List *other);
+
+int listParallelThreads(void);
+
+void listParallelSetThreads(int threads);
+
+void listParallelShutdown(void);
+
+void listParallelFor(size_t taskCount, void (*task)(void *job, size_t taskIndex), void *job);
+
+void listParallelCollect(List *list, ListPredicate predicate, void *context, List *subList);
+
+void listParallelForEach(List *list, ListAction action, void *context);
 
 #endif /* LIST_H */
\ No newline at end of file
@@ -0,0 +1,286 @@
+/**
+ * @file list_alloc.c
+ * @brief Arena and pool backends for the ListAllocator interface.
+ * @author Mark Jayson Lanuzo
+ * @date 2026-10-17
+ *
+ * ListArena hands out memory by bumping a pointer inside large blocks and
+ * releases everything at once, which suits lists that share one lifetime.
+ * ListPool recycles blocks of 13 power-of-two size classes through free lists,
+ * which suits many short-lived lists that are freed one by one.
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <string.h>
+
+#include "list.h"
+
+/** Alignment of every block handed out by the arena and the pool. */
+#define LIST_ALLOC_ALIGN 16
+
+#define LIST_ALIGN_UP(n) (((n) + (LIST_ALLOC_ALIGN - 1)) & ~(size_t)(LIST_ALLOC_ALIGN - 1))
+
+/** Default arena block size when 0 is passed to listArenaInit. */
+#define LIST_ARENA_DEFAULT_BLOCK (64 * 1024)
+
+/** Smallest pool size class in bytes. */
+#define LIST_POOL_MIN_CLASS 16
+
+/** Size of the slabs the pool carves blocks from. */
+#define LIST_POOL_SLAB_SIZE (256 * 1024)
+
+struct ListArenaBlock {
+    struct ListArenaBlock *next; /**< Previous (older) block */
+    size_t size;                 /**< Usable bytes in data */
+    size_t used;                 /**< Bytes handed out so far */
+    _Alignas(LIST_ALLOC_ALIGN) unsigned char data[]; /**< Block memory */
+};
+
+struct ListPoolSlab {
+    struct ListPoolSlab *next;   /**< Next slab */
+    _Alignas(LIST_ALLOC_ALIGN) unsigned char data[]; /**< Slab memory */
+};
+
+/* ---------------------------------------------------------------------------
+ * Arena
+ * ------------------------------------------------------------------------- */
+
+static struct ListArenaBlock *listArenaNewBlock(ListArena *arena, size_t minSize) {
+    size_t size = arena->blockSize > minSize ? arena->blockSize : minSize;
+    struct ListArenaBlock *block = malloc(sizeof(struct ListArenaBlock) + size);
+    if (!block) {
+        return NULL;
+    }
+    block->size = size;
+    block->used = 0;
+    block->next = arena->blocks;
+    arena->blocks = block;
+    return block;
+}
+
+static void *listArenaAlloc(void *context, size_t size) {
+    ListArena *arena = context;
+    struct ListArenaBlock *block = arena->blocks;
+    size = LIST_ALIGN_UP(size ? size : 1);
+
+    if (!block || block->size - block->used < size) {
+        block = listArenaNewBlock(arena, size);
+        if (!block) {
+            return NULL;
+        }
+    }
+    void *ptr = block->data + block->used;
+    block->used += size;
+    arena->last = ptr;
+    return ptr;
+}
+
+static void *listArenaRealloc(void *context, void *ptr, size_t oldSize, size_t newSize) {
+    ListArena *arena = context;
+    struct ListArenaBlock *block = arena->blocks;
+
+    if (ptr && ptr == arena->last) {
+        size_t offset = (size_t)((unsigned char *)ptr - block->data);
+        size_t size = LIST_ALIGN_UP(newSize ? newSize : 1);
+        if (block->size - offset >= size) {
+            block->used = offset + size;
+            return ptr;
+        }
+    }
+    void *data = listArenaAlloc(context, newSize);
+    if (data && ptr) {
+        memcpy(data, ptr, oldSize < newSize ? oldSize : newSize);
+    }
+    return data;
+}
+
+static void listArenaFree(void *context, void *ptr, size_t size) {
+    ListArena *arena = context;
+    (void)size;
+    if (ptr && ptr == arena->last) {
+        arena->blocks->used = (size_t)((unsigned char *)ptr - arena->blocks->data);
+        arena->last = NULL;
+    }
+}
+
+/**
+ * @brief Initializes an empty arena.
+ * @param arena A pointer to the arena.
+ * @param blockSize The size of each block in bytes, or 0 for 64 KiB.
+ */
+void listArenaInit(ListArena *arena, size_t blockSize) {
+    arena->blocks = NULL;
+    arena->blockSize = blockSize ? blockSize : LIST_ARENA_DEFAULT_BLOCK;
+    arena->last = NULL;
+    arena->allocator.alloc = listArenaAlloc;
+    arena->allocator.realloc = listArenaRealloc;
+    arena->allocator.free = listArenaFree;
+    arena->allocator.context = arena;
+}
+
+/**
+ * @brief Returns the allocator to pass to list_INIT_WITH_ALLOCATOR.
+ * @param arena A pointer to the arena.
+ */
+const ListAllocator *listArenaAllocator(ListArena *arena) {
+    return &arena->allocator;
+}
+
+/**
+ * @brief Releases every allocation at once, keeping the newest block for reuse.
+ * @param arena A pointer to the arena.
+ *
+ * Lists allocated from the arena must not be used afterwards.
+ */
+void listArenaReset(ListArena *arena) {
+    struct ListArenaBlock *block = arena->blocks;
+    if (!block) {
+        return;
+    }
+    struct ListArenaBlock *older = block->next;
+    while (older) {
+        struct ListArenaBlock *next = older->next;
+        free(older);
+        older = next;
+    }
+    block->next = NULL;
+    block->used = 0;
+    arena->last = NULL;
+}
+
+/**
+ * @brief Frees all memory owned by the arena.
+ * @param arena A pointer to the arena.
+ */
+void listArenaDestroy(ListArena *arena) {
+    struct ListArenaBlock *block = arena->blocks;
+    while (block) {
+        struct ListArenaBlock *next = block->next;
+        free(block);
+        block = next;
+    }
+    arena->blocks = NULL;
+    arena->last = NULL;
+}
+
+/* ---------------------------------------------------------------------------
+ * Pool
+ * ------------------------------------------------------------------------- */
+
+/**
+ * @brief Returns the size class of a request, or -1 if it is served by malloc.
+ */
+static int listPoolClassOf(size_t size) {
+    size_t classSize = LIST_POOL_MIN_CLASS;
+    for (int sizeClass = 0; sizeClass < LIST_POOL_CLASSES; sizeClass++) {
+        if (size <= classSize) {
+            return sizeClass;
+        }
+        classSize *= 2;
+    }
+    return -1;
+}
+
+static void *listPoolAlloc(void *context, size_t size) {
+    ListPool *pool = context;
+    int sizeClass = listPoolClassOf(size);
+    if (sizeClass < 0) {
+        return malloc(size);
+    }
+
+    void *block = pool->freeLists[sizeClass];
+    if (block) {
+        pool->freeLists[sizeClass] = *(void **)block;
+        return block;
+    }
+
+    size_t classSize = (size_t)LIST_POOL_MIN_CLASS << sizeClass;
+    size_t slabSize = classSize > LIST_POOL_SLAB_SIZE ? classSize : LIST_POOL_SLAB_SIZE;
+    struct ListPoolSlab *slab = malloc(sizeof(struct ListPoolSlab) + slabSize);
+    if (!slab) {
+        return NULL;
+    }
+    slab->next = pool->slabs;
+    pool->slabs = slab;
+
+    /* Hand out the first block and thread the rest onto the free list. */
+    for (size_t offset = slabSize - classSize; offset > 0; offset -= classSize) {
+        void *spare = slab->data + offset;
+        *(void **)spare = pool->freeLists[sizeClass];
+        pool->freeLists[sizeClass] = spare;
+    }
+    return slab->data;
+}
+
+static void listPoolFree(void *context, void *ptr, size_t size) {
+    ListPool *pool = context;
+    if (!ptr) {
+        return;
+    }
+    int sizeClass = listPoolClassOf(size);
+    if (sizeClass < 0) {
+        free(ptr);
+        return;
+    }
+    *(void **)ptr = pool->freeLists[sizeClass];
+    pool->freeLists[sizeClass] = ptr;
+}
+
+static void *listPoolRealloc(void *context, void *ptr, size_t oldSize, size_t newSize) {
+    int oldClass = listPoolClassOf(oldSize);
+    int newClass = listPoolClassOf(newSize);
+
+    if (ptr && oldClass >= 0 && oldClass == newClass) {
+        return ptr;
+    }
+    if (ptr && oldClass < 0 && newClass < 0) {
+        return realloc(ptr, newSize);
+    }
+    void *data = listPoolAlloc(context, newSize);
+    if (data && ptr) {
+        memcpy(data, ptr, oldSize < newSize ? oldSize : newSize);
+        listPoolFree(context, ptr, oldSize);
+    }
+    return data;
+}
+
+/**
+ * @brief Initializes an empty pool.
+ * @param pool A pointer to the pool.
+ */
+void listPoolInit(ListPool *pool) {
+    memset(pool->freeLists, 0, sizeof(pool->freeLists));
+    pool->slabs = NULL;
+    pool->allocator.alloc = listPoolAlloc;
+    pool->allocator.realloc = listPoolRealloc;
+    pool->allocator.free = listPoolFree;
+    pool->allocator.context = pool;
+}
+
+/**
+ * @brief Returns the allocator to pass to list_INIT_WITH_ALLOCATOR.
+ * @param pool A pointer to the pool.
+ */
+const ListAllocator *listPoolAllocator(ListPool *pool) {
+    return &pool->allocator;
+}
+
+/**
+ * @brief Frees all slabs owned by the pool.
+ * @param pool A pointer to the pool.
+ *
+ * Blocks larger than the biggest size class come from malloc and must have been
+ * freed through their lists before.
+ */
+void listPoolDestroy(ListPool *pool) {
+    struct ListPoolSlab *slab = pool->slabs;
+    while (slab) {
+        struct ListPoolSlab *next = slab->next;
+        free(slab);
+        slab = next;
+    }
+    listPoolInit(pool);
+}
@@ -0,0 +1,133 @@
+/**
+ * @file list_concurrent.c
+ * @brief Lock-free concurrent append into segmented storage.
+ * @author Mark Jayson Lanuzo
+ * @date 2026-10-17
+ *
+ * An append claims a slot with one atomic fetch-and-add on the reserved count,
+ * copies the element into it and then sets the slot's ready flag with release
+ * ordering. Readers load the flag with acquire ordering before touching the
+ * element, so they never see a partly written one.
+ *
+ * Slots live in segments whose sizes double (see listSegmentOf). A segment is
+ * allocated by the first thread that needs it and installed with a single
+ * compare-and-swap; a thread that loses the race frees its copy and uses the
+ * winner's. Segments are never moved, shrunk or freed while the list is in
+ * use, so element addresses stay valid and readers need no reclamation scheme.
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "list.h"
+
+/**
+ * @brief Initializes an empty concurrent list; no segment is allocated yet.
+ * @param list A pointer to the ListConcurrent.
+ * @param size The size of each element.
+ */
+void listConcurrentInit(ListConcurrent *list, size_t size) {
+    memset(list->segments, 0, sizeof(list->segments));
+    list->reserved = 0;
+    list->size = size;
+}
+
+/**
+ * @brief Gets a segment, allocating and installing it if no thread has yet.
+ *
+ * A segment holds its elements followed by one ready flag per element.
+ */
+static unsigned char *listConcurrentSegment(ListConcurrent *list, int segment) {
+    unsigned char *block = __atomic_load_n(&list->segments[segment], __ATOMIC_ACQUIRE);
+    if (block) {
+        return block;
+    }
+    size_t capacity = listSegmentCapacity(segment);
+    unsigned char *fresh = calloc(1, capacity * list->size + capacity);
+    if (!fresh) {
+        fprintf(stderr, "Memory allocation failed\n");
+        exit(EXIT_FAILURE);
+    }
+    if (__atomic_compare_exchange_n(&list->segments[segment], &block, fresh, false,
+                                    __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE)) {
+        return fresh;
+    }
+    free(fresh);
+    return block;
+}
+
+/**
+ * @brief Appends a copy of an element; safe to call from any number of threads.
+ * @param list A pointer to the ListConcurrent.
+ * @param element A pointer to the element to copy.
+ * @return The index of the new element, or -1 if the list holds INT_MAX elements.
+ *
+ * The element is visible to listConcurrentGet once this returns. Elements
+ * appended at the same time by different threads get indexes in no set order.
+ */
+int listConcurrentAdd(ListConcurrent *list, const void *element) {
+    int index = __atomic_fetch_add(&list->reserved, 1, __ATOMIC_RELAXED);
+    if (index < 0) {
+        printf("List is full\n");
+        return -1;
+    }
+    size_t offset;
+    int segment = listSegmentOf(index, &offset);
+    unsigned char *block = listConcurrentSegment(list, segment);
+    unsigned char *ready = block + listSegmentCapacity(segment) * list->size;
+
+    memcpy(block + offset * list->size, element, list->size);
+    __atomic_store_n(&ready[offset], 1, __ATOMIC_RELEASE);
+    return index;
+}
+
+/**
+ * @brief Gets the address of an element of a concurrent list.
+ * @param list A pointer to the ListConcurrent.
+ * @param index The index of the element.
+ * @return The address, which stays valid until listConcurrentFree, or NULL if
+ *         the index is invalid or its append has not finished yet.
+ */
+void *listConcurrentGet(ListConcurrent *list, int index) {
+    if (index < 0 || index >= listConcurrentLength(list)) {
+        printf("No value\n");
+        return NULL;
+    }
+    size_t offset;
+    int segment = listSegmentOf(index, &offset);
+    unsigned char *block = __atomic_load_n(&list->segments[segment], __ATOMIC_ACQUIRE);
+    if (!block) {
+        return NULL;
+    }
+    unsigned char *ready = block + listSegmentCapacity(segment) * list->size;
+    if (!__atomic_load_n(&ready[offset], __ATOMIC_ACQUIRE)) {
+        return NULL;
+    }
+    return block + offset * list->size;
+}
+
+/**
+ * @brief Gets the number of slots claimed so far.
+ * @return The count, including appends that are still copying their element.
+ */
+int listConcurrentLength(ListConcurrent *list) {
+    int reserved = __atomic_load_n(&list->reserved, __ATOMIC_ACQUIRE);
+    return reserved < 0 ? INT32_MAX : reserved;
+}
+
+/**
+ * @brief Frees every segment of a concurrent list.
+ * @param list A pointer to the ListConcurrent.
+ *
+ * No other thread may use the list during or after this call.
+ */
+void listConcurrentFree(ListConcurrent *list) {
+    for (int segment = 0; segment < LIST_SEGMENT_COUNT; segment++) {
+        free(list->segments[segment]);
+        list->segments[segment] = NULL;
+    }
+    list->reserved = 0;
+}
@@ -0,0 +1,398 @@
+/**
+ * @file list_index.c
+ * @brief Opt-in hash index for O(1) membership and index lookups on a List.
+ * @author Mark Jayson Lanuzo
+ * @date 2026-10-17
+ *
+ * The index is an open addressing table with linear probing that maps element
+ * contents to their positions in the list. It is kept in sync by the list
+ * macros, so list_GET_INDEX_OF, list_CONTAINS and list_REMOVE no longer scan
+ * the whole list.
+ *
+ * There is one slot per distinct value, holding its lowest position and its
+ * number of copies, so duplicates do not pile up in one probe cluster. When
+ * the lowest copy is removed, the list is scanned forward to the next one.
+ *
+ * Slots store position + base instead of the position itself. Pushing or
+ * popping at the front renumbers every element, which only moves base.
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "list.h"
+
+#define LIST_INDEX_EMPTY INT64_MIN
+#define LIST_INDEX_MIN_SLOTS 16
+
+typedef struct {
+    int64_t position;    /**< Lowest position of the value plus base, or LIST_INDEX_EMPTY */
+    size_t hash;         /**< Cached hash of the value */
+    int count;           /**< Number of elements equal to the value */
+} ListIndexSlot;
+
+struct ListIndex {
+    ListHashFn hash;     /**< Hash callback */
+    ListEqualsFn equals; /**< Equality callback */
+    ListIndexSlot *slots;/**< Slot table, length is mask + 1 */
+    size_t mask;         /**< Number of slots minus one (power of two) */
+    size_t used;         /**< Number of occupied slots (distinct values) */
+    int64_t base;        /**< Added to every position stored in the slots */
+};
+
+/**
+ * @brief Default hash callback: FNV-1a over the element bytes.
+ */
+size_t listHashBytes(const void *element, size_t size) {
+    const unsigned char *bytes = element;
+    size_t hash = (size_t)14695981039346656037ULL;
+    for (size_t i = 0; i < size; i++) {
+        hash ^= bytes[i];
+        hash *= (size_t)1099511628211ULL;
+    }
+    return hash;
+}
+
+/**
+ * @brief Default equality callback: bytewise comparison of the elements.
+ */
+bool listEqualsBytes(const void *a, const void *b, size_t size) {
+    return listBytesEqual(a, b, size);
+}
+
+typedef struct {
+    const char *dataType; /**< Data type name, as given to list_INIT */
+    ListEqualsFn equals;  /**< Equality of the type */
+    ListHashFn hash;      /**< Hash consistent with equals */
+} ListTypeOps;
+
+static ListTypeOps *listTypes;
+static int listTypeCount;
+
+/**
+ * @brief Registers the equality and hash callbacks of a data type.
+ * @param dataType The data type name, spelled as in list_INIT. It must outlive its use.
+ * @param equals The equality callback, for example from list_DEFINE_EQUALS.
+ * @param hash A hash callback that agrees with equals, for example from list_DEFINE_HASH.
+ *
+ * Lists of the type initialized afterwards use the callbacks in
+ * list_GET_INDEX_OF, list_CONTAINS, list_REMOVE and listEnableIndex instead of
+ * comparing element bytes. Registering a name again replaces the callbacks.
+ */
+void listRegisterType(const char *dataType, ListEqualsFn equals, ListHashFn hash) {
+    if (!equals || !hash) {
+        printf("Equality and hash callbacks are both required\n");
+        return;
+    }
+    for (int i = 0; i < listTypeCount; i++) {
+        if (strcmp(listTypes[i].dataType, dataType) == 0) {
+            listTypes[i].equals = equals;
+            listTypes[i].hash = hash;
+            return;
+        }
+    }
+    ListTypeOps *temp = realloc(listTypes, (size_t)(listTypeCount + 1) * sizeof(*temp));
+    if (!temp) {
+        fprintf(stderr, "Memory allocation failed\n");
+        exit(EXIT_FAILURE);
+    }
+    listTypes = temp;
+    listTypes[listTypeCount].dataType = dataType;
+    listTypes[listTypeCount].equals = equals;
+    listTypes[listTypeCount].hash = hash;
+    listTypeCount++;
+}
+
+/**
+ * @brief Sets the callbacks of a list from those registered for its data type.
+ * @param list A pointer to the List, with dataTypeOf already set.
+ *
+ * Called by list_INIT; lists of unregistered types get NULL and compare bytes.
+ */
+void listBindType(List *list) {
+    list->equals = NULL;
+    list->hash = NULL;
+    for (int i = 0; list->dataTypeOf && i < listTypeCount; i++) {
+        if (strcmp(listTypes[i].dataType, list->dataTypeOf) == 0) {
+            list->equals = listTypes[i].equals;
+            list->hash = listTypes[i].hash;
+            return;
+        }
+    }
+}
+
+/**
+ * @brief Sets the equality and hash callbacks of one list.
+ * @param list A pointer to the List.
+ * @param equals The equality callback, or NULL with hash NULL to compare bytes.
+ * @param hash A hash callback that agrees with equals.
+ *
+ * An enabled index is rebuilt with the new callbacks.
+ */
+void listSetTypeOps(List *list, ListEqualsFn equals, ListHashFn hash) {
+    if (!equals != !hash) {
+        printf("Equality and hash callbacks are both required\n");
+        return;
+    }
+    list->equals = equals;
+    list->hash = hash;
+    if (list->hashIndex) {
+        listEnableIndex(list, NULL, NULL);
+    }
+}
+
+static void *listIndexElement(List *list, int position) {
+    return listAt(list, position);
+}
+
+static ListIndexSlot *listIndexAllocSlots(size_t count) {
+    ListIndexSlot *slots = malloc(count * sizeof(ListIndexSlot));
+    if (!slots) {
+        fprintf(stderr, "Memory allocation failed\n");
+        exit(EXIT_FAILURE);
+    }
+    for (size_t i = 0; i < count; i++) {
+        slots[i].position = LIST_INDEX_EMPTY;
+    }
+    return slots;
+}
+
+/**
+ * @brief Stores a slot in the first free place of its probe sequence.
+ */
+static void listIndexPlace(struct ListIndex *index, const ListIndexSlot *slot) {
+    size_t i = slot->hash & index->mask;
+    while (index->slots[i].position != LIST_INDEX_EMPTY) {
+        i = (i + 1) & index->mask;
+    }
+    index->slots[i] = *slot;
+    index->used++;
+}
+
+/**
+ * @brief Resizes the slot table so it holds at least count entries at half load.
+ */
+static void listIndexResize(struct ListIndex *index, size_t count) {
+    size_t slotCount = LIST_INDEX_MIN_SLOTS;
+    while (slotCount < count * 2) {
+        slotCount *= 2;
+    }
+    ListIndexSlot *old = index->slots;
+    size_t oldCount = old ? index->mask + 1 : 0;
+
+    index->slots = listIndexAllocSlots(slotCount);
+    index->mask = slotCount - 1;
+    index->used = 0;
+    for (size_t i = 0; i < oldCount; i++) {
+        if (old[i].position != LIST_INDEX_EMPTY) {
+            listIndexPlace(index, &old[i]);
+        }
+    }
+    free(old);
+}
+
+/**
+ * @brief Enables a hash index on the list.
+ * @param list A pointer to the List.
+ * @param hash The hash callback, or NULL for the one of the list's data type.
+ * @param equals The equality callback, or NULL for the one of the list's data type.
+ *
+ * The index is built from the current contents and then updated incrementally by
+ * every list macro. Calling it again replaces the callbacks and rebuilds the index.
+ */
+void listEnableIndex(List *list, ListHashFn hash, ListEqualsFn equals) {
+    listDisableIndex(list);
+    struct ListIndex *index = calloc(1, sizeof(struct ListIndex));
+    if (!index) {
+        fprintf(stderr, "Memory allocation failed\n");
+        exit(EXIT_FAILURE);
+    }
+    index->hash = hash ? hash : list->hash ? list->hash : listHashBytes;
+    index->equals = equals ? equals : list->equals ? list->equals : listEqualsBytes;
+    list->hashIndex = index;
+    listIndexRebuild(list);
+}
+
+/**
+ * @brief Disables the hash index and frees its memory.
+ * @param list A pointer to the List.
+ */
+void listDisableIndex(List *list) {
+    if (list->hashIndex) {
+        free(list->hashIndex->slots);
+        free(list->hashIndex);
+        list->hashIndex = NULL;
+    }
+}
+
+/**
+ * @brief Rebuilds the hash index from the current list contents.
+ * @param list A pointer to the List.
+ *
+ * Used after operations that move many elements at once.
+ */
+void listIndexRebuild(List *list) {
+    struct ListIndex *index = list->hashIndex;
+    if (!index) {
+        return;
+    }
+    free(index->slots);
+    index->slots = NULL;
+    index->base = 0;
+    listIndexResize(index, 0);
+    for (int i = 0; i < list->currentCount; i++) {
+        listIndexLink(list, i);
+    }
+}
+
+/**
+ * @brief Finds the slot of the value equal to element.
+ * @return The slot, or NULL if no element equal to it is indexed.
+ */
+static ListIndexSlot *listIndexSlotOf(List *list, const void *element, size_t hash) {
+    struct ListIndex *index = list->hashIndex;
+    for (size_t i = hash & index->mask; index->slots[i].position != LIST_INDEX_EMPTY;
+         i = (i + 1) & index->mask) {
+        ListIndexSlot *slot = &index->slots[i];
+        if (slot->hash == hash &&
+            index->equals(listIndexElement(list, (int)(slot->position - index->base)),
+                          element, list->size)) {
+            return slot;
+        }
+    }
+    return NULL;
+}
+
+/**
+ * @brief Finds the first position holding an element equal to value.
+ * @param list A pointer to the List, which must have an index enabled.
+ * @param value A pointer to the element to look for.
+ * @return The lowest matching position, or -1 if the element is not in the list.
+ */
+int listIndexFind(List *list, const void *value) {
+    struct ListIndex *index = list->hashIndex;
+    ListIndexSlot *slot = listIndexSlotOf(list, value, index->hash(value, list->size));
+    return slot ? (int)(slot->position - index->base) : -1;
+}
+
+/**
+ * @brief Adds the element currently stored at position to the index.
+ * @param list A pointer to the List.
+ * @param position The position of the element.
+ */
+void listIndexLink(List *list, int position) {
+    struct ListIndex *index = list->hashIndex;
+    const void *element = listIndexElement(list, position);
+    size_t hash = index->hash(element, list->size);
+    ListIndexSlot *slot = listIndexSlotOf(list, element, hash);
+    if (slot) {
+        if (position + index->base < slot->position) {
+            slot->position = position + index->base;
+        }
+        slot->count++;
+        return;
+    }
+    if ((index->used + 1) * 2 > index->mask + 1) {
+        listIndexResize(index, index->used + 1);
+    }
+    ListIndexSlot added = {position + index->base, hash, 1};
+    listIndexPlace(index, &added);
+}
+
+/**
+ * @brief Removes the element currently stored at position from the index.
+ * @param list A pointer to the List.
+ * @param position The position of the element.
+ *
+ * If other copies remain and this one was the lowest, the list is scanned
+ * forward from position to the next copy. The last copy frees its slot with
+ * backward shift deletion, so no tombstones are left in the table.
+ */
+void listIndexUnlink(List *list, int position) {
+    struct ListIndex *index = list->hashIndex;
+    const void *element = listIndexElement(list, position);
+    ListIndexSlot *slot = listIndexSlotOf(list, element, index->hash(element, list->size));
+    if (!slot) {
+        return;
+    }
+    if (--slot->count > 0) {
+        if (slot->position == position + index->base) {
+            int next = position + 1;
+            while (next < list->currentCount &&
+                   !index->equals(listIndexElement(list, next), element, list->size)) {
+                next++;
+            }
+            slot->position = next + index->base;
+        }
+        return;
+    }
+
+    size_t i = (size_t)(slot - index->slots);
+    size_t j = i;
+    for (;;) {
+        j = (j + 1) & index->mask;
+        if (index->slots[j].position == LIST_INDEX_EMPTY) {
+            break;
+        }
+        size_t home = index->slots[j].hash & index->mask;
+        if (((j - home) & index->mask) >= ((j - i) & index->mask)) {
+            index->slots[i] = index->slots[j];
+            i = j;
+        }
+    }
+    index->slots[i].position = LIST_INDEX_EMPTY;
+    index->used--;
+}
+
+/**
+ * @brief Adds delta to every indexed position greater than or equal to from.
+ *
+ * O(1) when from is 0, as for list_PUSH_FRONT and list_POP_FRONT: only base
+ * changes. Otherwise every slot is visited, like the memmove of the elements;
+ * empty slots hold INT64_MIN and are never shifted.
+ */
+static void listIndexShift(List *list, int from, int delta) {
+    struct ListIndex *index = list->hashIndex;
+    if (from == 0) {
+        index->base -= delta;
+        return;
+    }
+    int64_t first = from + index->base;
+    for (size_t i = 0; i <= index->mask; i++) {
+        if (index->slots[i].position >= first) {
+            index->slots[i].position += delta;
+        }
+    }
+}
+
+/**
+ * @brief Updates the index after an element was inserted at position.
+ * @param list A pointer to the List, with currentCount already incremented.
+ * @param position The position of the inserted element.
+ *
+ * Elements after position have moved up by one and are renumbered.
+ */
+void listIndexAfterInsert(List *list, int position) {
+    if (position < list->currentCount - 1) {
+        listIndexShift(list, position, 1);
+    }
+    listIndexLink(list, position);
+}
+
+/**
+ * @brief Updates the index before the element at position is removed.
+ * @param list A pointer to the List, with the element still in place.
+ * @param position The position of the element about to be removed.
+ *
+ * Elements after position will move down by one and are renumbered. Nothing
+ * is left at position once it is unlinked, so the shift can start there.
+ */
+void listIndexBeforeRemove(List *list, int position) {
+    listIndexUnlink(list, position);
+    if (position < list->currentCount - 1) {
+        listIndexShift(list, position, -1);
+    }
+}
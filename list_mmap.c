@@ -0,0 +1,327 @@
+/**
+ * @file list_mmap.c
+ * @brief Binary persistence for lists, loaded with mmap.
+ * @author Mark Jayson Lanuzo
+ * @date 2026-10-17
+ *
+ * File layout (native byte order):
+ *
+ *   offset 0    ListFileHeader, LIST_FILE_HEADER_SIZE bytes
+ *   offset 128  count * elementSize bytes of raw elements
+ *
+ * listOpenMapped maps the file privately and points the list straight at the
+ * element bytes, so opening costs the same for any file size. Writes to the
+ * elements copy only the touched pages (MAP_PRIVATE) and never reach the file.
+ * The first operation that needs a larger or smaller buffer moves the elements
+ * to the heap and unmaps the file.
+ *
+ * Only the header is verified on open. listVerifyChecksum reads the whole
+ * payload and compares it with the checksum written by listSave. Platforms
+ * without mmap (_WIN32) read the elements into the heap and verify them then.
+ *
+ * @warning Elements are stored byte for byte: pointers inside them (char *name
+ * in a struct, for example) are not meaningful once the process exits.
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+#include <limits.h>
+
+#include "list.h"
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+#define LIST_FILE_MAGIC "CLISTBIN"
+#define LIST_FILE_VERSION 1u
+#define LIST_FILE_SORTED 1u
+
+/**
+ * @brief Header at the start of a list file.
+ */
+typedef struct ListFileHeader {
+    char magic[8];            /**< LIST_FILE_MAGIC */
+    uint32_t version;         /**< LIST_FILE_VERSION, also detects byte order */
+    uint32_t headerSize;      /**< LIST_FILE_HEADER_SIZE */
+    uint64_t elementSize;     /**< Size of each element in bytes */
+    uint64_t count;           /**< Number of elements */
+    uint32_t elementKind;     /**< ListKind of the elements */
+    uint32_t flags;           /**< LIST_FILE_SORTED */
+    uint64_t payloadChecksum; /**< FNV-1a of the element bytes */
+    char dataType[64];        /**< Data type name given to list_INIT */
+    uint64_t reserved;        /**< Zero */
+    uint64_t headerChecksum;  /**< FNV-1a of the header up to this field */
+} ListFileHeader;
+
+_Static_assert(sizeof(ListFileHeader) == LIST_FILE_HEADER_SIZE, "unexpected list file header size");
+
+/**
+ * @brief 64-bit FNV-1a, continued from hash.
+ */
+static uint64_t listChecksum(uint64_t hash, const void *data, size_t size) {
+    const unsigned char *bytes = data;
+    for (size_t i = 0; i < size; i++) {
+        hash ^= bytes[i];
+        hash *= 1099511628211ull;
+    }
+    return hash;
+}
+
+#define LIST_CHECKSUM_SEED 14695981039346656037ull
+
+static uint64_t listHeaderChecksum(const ListFileHeader *header) {
+    return listChecksum(LIST_CHECKSUM_SEED, header, offsetof(ListFileHeader, headerChecksum));
+}
+
+/**
+ * @brief Writes the list to a file that listOpenMapped can load.
+ * @param list A pointer to the List.
+ * @param path The file to write. An existing file is replaced.
+ * @return false if the file could not be written.
+ *
+ * The data is written to path.tmp and renamed over path, so a list mapped from
+ * path keeps working and readers never see a half-written file.
+ */
+bool listSave(List *list, const char *path) {
+    ListFileHeader header;
+    size_t payloadSize = (size_t)list->currentCount * list->size;
+    char tempPath[4096];
+
+    listLinearize(list);
+
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, LIST_FILE_MAGIC, sizeof(header.magic));
+    header.version = LIST_FILE_VERSION;
+    header.headerSize = LIST_FILE_HEADER_SIZE;
+    header.elementSize = list->size;
+    header.count = (uint64_t)list->currentCount;
+    header.elementKind = (uint32_t)list->elementKind;
+    header.flags = list->sorted ? LIST_FILE_SORTED : 0;
+    header.payloadChecksum = listChecksum(LIST_CHECKSUM_SEED, list->data, payloadSize);
+    if (list->dataTypeOf) {
+        strncpy(header.dataType, list->dataTypeOf, sizeof(header.dataType) - 1);
+    }
+    header.headerChecksum = listHeaderChecksum(&header);
+
+    if (snprintf(tempPath, sizeof(tempPath), "%s.tmp", path) >= (int)sizeof(tempPath)) {
+        fprintf(stderr, "listSave: path too long: %s\n", path);
+        return false;
+    }
+    FILE *file = fopen(tempPath, "wb");
+    if (!file) {
+        fprintf(stderr, "listSave: cannot open %s\n", tempPath);
+        return false;
+    }
+    bool written = fwrite(&header, sizeof(header), 1, file) == 1 &&
+                   (payloadSize == 0 || fwrite(list->data, payloadSize, 1, file) == 1);
+    if (fclose(file) != 0 || !written) {
+        fprintf(stderr, "listSave: cannot write %s\n", tempPath);
+        remove(tempPath);
+        return false;
+    }
+#ifdef _WIN32
+    remove(path);
+#endif
+    if (rename(tempPath, path) != 0) {
+        fprintf(stderr, "listSave: cannot replace %s\n", path);
+        remove(tempPath);
+        return false;
+    }
+    return true;
+}
+
+/**
+ * @brief Checks a header read from a file of fileSize bytes against the list.
+ * @return false, after printing the reason, if the file cannot be loaded.
+ */
+static bool listCheckHeader(List *list, const ListFileHeader *header, uint64_t fileSize,
+                            const char *path) {
+    if (memcmp(header->magic, LIST_FILE_MAGIC, sizeof(header->magic)) != 0) {
+        fprintf(stderr, "%s: not a list file\n", path);
+        return false;
+    }
+    if (header->version != LIST_FILE_VERSION) {
+        fprintf(stderr, "%s: unsupported version or byte order\n", path);
+        return false;
+    }
+    if (header->headerSize != LIST_FILE_HEADER_SIZE ||
+        header->headerChecksum != listHeaderChecksum(header)) {
+        fprintf(stderr, "%s: corrupted header\n", path);
+        return false;
+    }
+    if (header->elementSize != list->size) {
+        fprintf(stderr, "%s: element size %llu does not match %zu\n", path,
+                (unsigned long long)header->elementSize, list->size);
+        return false;
+    }
+    if (strncmp(header->dataType, list->dataTypeOf, sizeof(header->dataType)) != 0) {
+        fprintf(stderr, "%s: data type %.64s does not match %s\n", path, header->dataType,
+                list->dataTypeOf);
+        return false;
+    }
+    if (header->count > (uint64_t)INT_MAX ||
+        fileSize - LIST_FILE_HEADER_SIZE < header->count * header->elementSize) {
+        fprintf(stderr, "%s: truncated file\n", path);
+        return false;
+    }
+    return true;
+}
+
+/**
+ * @brief Sets the list fields that do not depend on where the elements live.
+ */
+static void listOpenFields(List *list, size_t elementSize) {
+    list->currentCount = 0;
+    list->size = elementSize;
+    list->elementKind = listKindOf(list->dataTypeOf, elementSize);
+    list->dataSize = 0;
+    list->hashIndex = NULL;
+    listBindType(list);
+    list->allocator = NULL;
+    list->growthPolicy = LIST_GROW_DOUBLE;
+    list->growthStep = 0;
+    list->autoShrink = false;
+    list->sorted = false;
+    list->head = 0;
+    list->incrementalResize = false;
+    list->oldData = NULL;
+    list->oldListSize = 0;
+    list->migrated = 0;
+    list->migrateEnd = 0;
+    list->mapping = NULL;
+    list->mappingSize = 0;
+    LIST_STAT_REGISTER(list);
+}
+
+/**
+ * @brief Loads a list written by listSave. Called by list_OPEN_MAPPED.
+ * @param list A pointer to the List, with dataTypeOf and nameOf already set.
+ * @param path The file to load.
+ * @param elementSize The size of the list data type.
+ * @return false if the file is missing, truncated, corrupted or holds another
+ *         type. The list is then initialized empty and must still be freed.
+ */
+bool listOpenMapped(List *list, const char *path, size_t elementSize) {
+    ListFileHeader header;
+
+    listOpenFields(list, elementSize);
+#ifndef _WIN32
+    int fd = open(path, O_RDONLY);
+    struct stat status;
+    if (fd < 0 || fstat(fd, &status) != 0) {
+        fprintf(stderr, "%s: cannot open\n", path);
+        if (fd >= 0) {
+            close(fd);
+        }
+        listInitBuffer(list, LIST_DEFAULT_CAPACITY);
+        return false;
+    }
+    size_t fileSize = (size_t)status.st_size;
+    void *base = fileSize >= sizeof(header)
+        ? mmap(NULL, fileSize, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0)
+        : MAP_FAILED;
+    close(fd);
+    if (base == MAP_FAILED) {
+        fprintf(stderr, "%s: %s\n", path, fileSize < sizeof(header) ? "truncated file" : "cannot map");
+        listInitBuffer(list, LIST_DEFAULT_CAPACITY);
+        return false;
+    }
+    memcpy(&header, base, sizeof(header));
+    if (!listCheckHeader(list, &header, fileSize, path)) {
+        munmap(base, fileSize);
+        listInitBuffer(list, LIST_DEFAULT_CAPACITY);
+        return false;
+    }
+    if (header.count == 0) {
+        /* No elements to serve from the mapping: start with a regular buffer */
+        munmap(base, fileSize);
+        listInitBuffer(list, LIST_DEFAULT_CAPACITY);
+        list->sorted = (header.flags & LIST_FILE_SORTED) != 0;
+        return true;
+    }
+    list->mapping = base;
+    list->mappingSize = fileSize;
+    list->data = (char *)base + LIST_FILE_HEADER_SIZE;
+#else
+    /* No mmap: read the elements into a heap buffer instead */
+    FILE *file = fopen(path, "rb");
+    long long fileSize = -1;
+    if (file && fseek(file, 0, SEEK_END) == 0) {
+        fileSize = _ftelli64(file);
+        fseek(file, 0, SEEK_SET);
+    }
+    if (!file || fileSize < (long long)sizeof(header) ||
+        fread(&header, sizeof(header), 1, file) != 1 ||
+        !listCheckHeader(list, &header, (uint64_t)fileSize, path)) {
+        if (file) {
+            fclose(file);
+        }
+        listInitBuffer(list, LIST_DEFAULT_CAPACITY);
+        return false;
+    }
+    if (header.count == 0) {
+        fclose(file);
+        listInitBuffer(list, LIST_DEFAULT_CAPACITY);
+        list->sorted = (header.flags & LIST_FILE_SORTED) != 0;
+        return true;
+    }
+    size_t payloadSize = (size_t)(header.count * header.elementSize);
+    list->data = listAllocate(list, payloadSize);
+    if ((payloadSize > 0 && fread(list->data, payloadSize, 1, file) != 1) ||
+        header.payloadChecksum != listChecksum(LIST_CHECKSUM_SEED, list->data, payloadSize)) {
+        fprintf(stderr, "%s: truncated or corrupted file\n", path);
+        fclose(file);
+        free(list->data);
+        listInitBuffer(list, LIST_DEFAULT_CAPACITY);
+        return false;
+    }
+    fclose(file);
+#endif
+    list->currentCount = (int)header.count;
+    list->initSize = (int)header.count;
+    list->dataSize = (size_t)header.count * list->size;
+    list->listSize = list->dataSize;
+    list->sorted = (header.flags & LIST_FILE_SORTED) != 0;
+    return true;
+}
+
+/**
+ * @brief Checks the elements of a mapped list against the checksum saved in the file.
+ * @param list A pointer to a List opened with list_OPEN_MAPPED.
+ * @return true if the elements are unchanged since listSave; false if they differ
+ *         or the list is no longer mapped.
+ *
+ * Reads every element, so call it once when integrity matters more than
+ * startup time. Without mmap (_WIN32) the checksum is verified while loading.
+ */
+bool listVerifyChecksum(List *list) {
+    if (!list->mapping) {
+        return false;
+    }
+    const ListFileHeader *header = list->mapping;
+    return header->count == (uint64_t)list->currentCount &&
+           header->payloadChecksum == listChecksum(LIST_CHECKSUM_SEED, list->data, list->dataSize);
+}
+
+/**
+ * @brief Releases the file mapping of a list.
+ * @param list A pointer to a List whose elements no longer live in the mapping.
+ *
+ * Called when the elements move to the heap and by listFree.
+ */
+void listUnmap(List *list) {
+#ifndef _WIN32
+    if (list->mapping) {
+        munmap(list->mapping, list->mappingSize);
+    }
+#endif
+    list->mapping = NULL;
+    list->mappingSize = 0;
+}
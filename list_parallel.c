@@ -0,0 +1,370 @@
+/**
+ * @file list_parallel.c
+ * @brief Small pthread pool and the parallel list operations built on it.
+ * @author Mark Jayson Lanuzo
+ * @date 2026-10-17
+ *
+ * The pool is created on first use with one worker per CPU (the calling thread
+ * also works). A job is split into tasks that workers claim with an atomic
+ * counter. Only one job runs at a time and jobs must not be nested.
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+#include <pthread.h>
+#include <unistd.h>
+
+#include "list.h"
+
+/** Lists shorter than this are processed on the calling thread. */
+#define LIST_PARALLEL_MIN_ELEMENTS 65536
+
+/** Smallest number of elements handed to one task. */
+#define LIST_PARALLEL_MIN_CHUNK 16384
+
+/** Tasks created per thread, so uneven chunks still balance. */
+#define LIST_PARALLEL_TASKS_PER_THREAD 4
+
+typedef struct {
+    pthread_mutex_t lock;        /**< Protects the fields below */
+    pthread_cond_t workReady;    /**< Signaled when a job is posted */
+    pthread_cond_t workDone;     /**< Signaled when the last worker finishes a job */
+    pthread_mutex_t submitLock;  /**< Serializes jobs */
+    pthread_t *workers;          /**< Worker threads */
+    int workerCount;             /**< Number of worker threads */
+    int requestedThreads;        /**< Threads requested with listParallelSetThreads, 0 for auto */
+    unsigned long generation;    /**< Incremented for every job */
+    int activeWorkers;           /**< Workers still running the current job */
+    bool shutdown;               /**< Tells workers to exit */
+    void (*task)(void *job, size_t taskIndex); /**< Task function of the current job */
+    void *job;                   /**< Argument of the current job */
+    size_t taskCount;            /**< Number of tasks in the current job */
+    size_t nextTask;             /**< Next unclaimed task, updated atomically */
+} ListThreadPool;
+
+static ListThreadPool listPool = {
+    PTHREAD_MUTEX_INITIALIZER, PTHREAD_COND_INITIALIZER, PTHREAD_COND_INITIALIZER,
+    PTHREAD_MUTEX_INITIALIZER, NULL, 0, 0, 0, 0, false, NULL, NULL, 0, 0
+};
+
+static void listPoolRunTasks(void) {
+    for (;;) {
+        size_t taskIndex = __atomic_fetch_add(&listPool.nextTask, 1, __ATOMIC_RELAXED);
+        if (taskIndex >= listPool.taskCount) {
+            return;
+        }
+        listPool.task(listPool.job, taskIndex);
+    }
+}
+
+static void *listPoolWorker(void *arg) {
+    unsigned long seen = (unsigned long)(uintptr_t)arg;
+
+    for (;;) {
+        pthread_mutex_lock(&listPool.lock);
+        while (!listPool.shutdown && listPool.generation == seen) {
+            pthread_cond_wait(&listPool.workReady, &listPool.lock);
+        }
+        if (listPool.shutdown) {
+            pthread_mutex_unlock(&listPool.lock);
+            return NULL;
+        }
+        seen = listPool.generation;
+        pthread_mutex_unlock(&listPool.lock);
+
+        listPoolRunTasks();
+
+        pthread_mutex_lock(&listPool.lock);
+        if (--listPool.activeWorkers == 0) {
+            pthread_cond_signal(&listPool.workDone);
+        }
+        pthread_mutex_unlock(&listPool.lock);
+    }
+}
+
+static int listParallelCpuCount(void) {
+#ifdef _SC_NPROCESSORS_ONLN
+    long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+    return cpus > 0 ? (int)cpus : 1;
+#else
+    return 1;
+#endif
+}
+
+/**
+ * @brief Starts the workers if needed. Called with submitLock held.
+ */
+static void listPoolStart(void) {
+    if (listPool.workers) {
+        return;
+    }
+    int threads = listPool.requestedThreads > 0 ? listPool.requestedThreads : listParallelCpuCount();
+    int workerCount = threads - 1;
+    if (workerCount <= 0) {
+        return;
+    }
+    listPool.workers = malloc((size_t)workerCount * sizeof(pthread_t));
+    if (!listPool.workers) {
+        fprintf(stderr, "Memory allocation failed\n");
+        exit(EXIT_FAILURE);
+    }
+    for (int i = 0; i < workerCount; i++) {
+        void *generation = (void *)(uintptr_t)listPool.generation;
+        if (pthread_create(&listPool.workers[i], NULL, listPoolWorker, generation) != 0) {
+            workerCount = i;
+            break;
+        }
+    }
+    listPool.workerCount = workerCount;
+}
+
+/**
+ * @brief Returns the number of threads used by parallel operations.
+ */
+int listParallelThreads(void) {
+    return listPool.requestedThreads > 0 ? listPool.requestedThreads : listParallelCpuCount();
+}
+
+/**
+ * @brief Sets the number of threads used by parallel operations.
+ * @param threads The number of threads including the caller, or 0 for one per CPU.
+ *
+ * Stops the current workers; new ones are started by the next parallel call.
+ */
+void listParallelSetThreads(int threads) {
+    listParallelShutdown();
+    pthread_mutex_lock(&listPool.submitLock);
+    listPool.requestedThreads = threads;
+    pthread_mutex_unlock(&listPool.submitLock);
+}
+
+/**
+ * @brief Stops the worker threads of the pool.
+ *
+ * Call before exit to release the threads. The next parallel call starts new ones.
+ */
+void listParallelShutdown(void) {
+    pthread_mutex_lock(&listPool.submitLock);
+    pthread_mutex_lock(&listPool.lock);
+    listPool.shutdown = true;
+    pthread_cond_broadcast(&listPool.workReady);
+    pthread_mutex_unlock(&listPool.lock);
+    for (int i = 0; i < listPool.workerCount; i++) {
+        pthread_join(listPool.workers[i], NULL);
+    }
+    free(listPool.workers);
+    listPool.workers = NULL;
+    listPool.workerCount = 0;
+    listPool.shutdown = false;
+    pthread_mutex_unlock(&listPool.submitLock);
+}
+
+/**
+ * @brief Runs task(job, i) for every i in [0, taskCount) on the pool.
+ * @param taskCount The number of tasks.
+ * @param task The task function.
+ * @param job The argument passed to every task.
+ *
+ * Returns when all tasks have finished. The calling thread runs tasks too.
+ */
+void listParallelFor(size_t taskCount, void (*task)(void *job, size_t taskIndex), void *job) {
+    pthread_mutex_lock(&listPool.submitLock);
+    listPoolStart();
+    if (listPool.workerCount == 0 || taskCount <= 1) {
+        pthread_mutex_unlock(&listPool.submitLock);
+        for (size_t i = 0; i < taskCount; i++) {
+            task(job, i);
+        }
+        return;
+    }
+
+    pthread_mutex_lock(&listPool.lock);
+    listPool.task = task;
+    listPool.job = job;
+    listPool.taskCount = taskCount;
+    listPool.nextTask = 0;
+    listPool.activeWorkers = listPool.workerCount;
+    listPool.generation++;
+    pthread_cond_broadcast(&listPool.workReady);
+    pthread_mutex_unlock(&listPool.lock);
+
+    listPoolRunTasks();
+
+    pthread_mutex_lock(&listPool.lock);
+    while (listPool.activeWorkers > 0) {
+        pthread_cond_wait(&listPool.workDone, &listPool.lock);
+    }
+    pthread_mutex_unlock(&listPool.lock);
+    pthread_mutex_unlock(&listPool.submitLock);
+}
+
+/* ---------------------------------------------------------------------------
+ * Parallel list operations
+ * ------------------------------------------------------------------------- */
+
+typedef struct {
+    List *list;                  /**< Source list */
+    List *subList;               /**< Destination list */
+    ListPredicate predicate;     /**< Filter */
+    ListAction action;           /**< Per-element action */
+    void *context;               /**< User context */
+    size_t chunkSize;            /**< Elements per task */
+    uint32_t **selected;         /**< Per-task selection vectors (offsets within the chunk) */
+    size_t *selectedCount;       /**< Per-task number of selected elements */
+    size_t *outputOffset;        /**< Per-task position in subList (prefix sum) */
+} ListParallelJob;
+
+static size_t listChunkSize(size_t count) {
+    size_t tasks = (size_t)listParallelThreads() * LIST_PARALLEL_TASKS_PER_THREAD;
+    size_t chunk = (count + tasks - 1) / tasks;
+    return chunk < LIST_PARALLEL_MIN_CHUNK ? LIST_PARALLEL_MIN_CHUNK : chunk;
+}
+
+static void listFilterTask(void *arg, size_t taskIndex) {
+    ListParallelJob *job = arg;
+    size_t start = taskIndex * job->chunkSize;
+    size_t end = start + job->chunkSize;
+    size_t count = (size_t)job->list->currentCount;
+    if (end > count) {
+        end = count;
+    }
+    uint32_t *selected = malloc((end - start) * sizeof(uint32_t));
+    if (!selected) {
+        fprintf(stderr, "Memory allocation failed\n");
+        exit(EXIT_FAILURE);
+    }
+    const char *data = (const char *)job->list->data;
+    size_t size = job->list->size;
+    size_t found = 0;
+    for (size_t i = start; i < end; i++) {
+        if (job->predicate(data + (i * size), job->context)) {
+            selected[found++] = (uint32_t)(i - start);
+        }
+    }
+    job->selected[taskIndex] = selected;
+    job->selectedCount[taskIndex] = found;
+}
+
+static void listGatherTask(void *arg, size_t taskIndex) {
+    ListParallelJob *job = arg;
+    const char *source = (const char *)job->list->data + (taskIndex * job->chunkSize * job->list->size);
+    char *target = (char *)job->subList->data + (job->outputOffset[taskIndex] * job->list->size);
+    size_t size = job->list->size;
+    const uint32_t *selected = job->selected[taskIndex];
+
+    for (size_t k = 0; k < job->selectedCount[taskIndex]; k++) {
+        memcpy(target + (k * size), source + ((size_t)selected[k] * size), size);
+    }
+    free(job->selected[taskIndex]);
+}
+
+static void listForEachTask(void *arg, size_t taskIndex) {
+    ListParallelJob *job = arg;
+    size_t start = taskIndex * job->chunkSize;
+    size_t end = start + job->chunkSize;
+    size_t count = (size_t)job->list->currentCount;
+    if (end > count) {
+        end = count;
+    }
+    char *data = (char *)job->list->data;
+    size_t size = job->list->size;
+    for (size_t i = start; i < end; i++) {
+        job->action(data + (i * size), job->context);
+    }
+}
+
+/**
+ * @brief Appends the elements of list that satisfy predicate to subList, in order.
+ * @param list A pointer to the source List.
+ * @param predicate The filter, called concurrently from several threads.
+ * @param context Passed to every predicate call.
+ * @param subList An initialized List with the same element type.
+ *
+ * Each chunk is filtered into its own selection vector, the counts are prefix
+ * summed, subList is sized once and every selected element is copied once.
+ */
+void listParallelCollect(List *list, ListPredicate predicate, void *context, List *subList) {
+    listLinearize(list);
+    size_t count = (size_t)list->currentCount;
+    size_t size = list->size;
+
+    if (count < LIST_PARALLEL_MIN_ELEMENTS) {
+        for (size_t i = 0; i < count; i++) {
+            const char *element = (const char *)list->data + (i * size);
+            if (predicate(element, context)) {
+                listAppendRange(subList, element, 1);
+            }
+        }
+        return;
+    }
+
+    ListParallelJob job = {0};
+    job.list = list;
+    job.subList = subList;
+    job.predicate = predicate;
+    job.context = context;
+    job.chunkSize = listChunkSize(count);
+    size_t taskCount = (count + job.chunkSize - 1) / job.chunkSize;
+    job.selected = calloc(taskCount, sizeof(uint32_t *));
+    job.selectedCount = calloc(taskCount, sizeof(size_t));
+    job.outputOffset = calloc(taskCount, sizeof(size_t));
+    if (!job.selected || !job.selectedCount || !job.outputOffset) {
+        fprintf(stderr, "Memory allocation failed\n");
+        exit(EXIT_FAILURE);
+    }
+
+    listParallelFor(taskCount, listFilterTask, &job);
+
+    size_t total = (size_t)subList->currentCount;
+    for (size_t t = 0; t < taskCount; t++) {
+        job.outputOffset[t] = total;
+        total += job.selectedCount[t];
+    }
+    listReserve(subList, total);
+
+    listParallelFor(taskCount, listGatherTask, &job);
+
+    subList->currentCount = (int)total;
+    subList->dataSize = total * size;
+    if (subList->hashIndex) {
+        listIndexRebuild(subList);
+    }
+    free(job.selected);
+    free(job.selectedCount);
+    free(job.outputOffset);
+}
+
+/**
+ * @brief Calls action on every element of list, in parallel.
+ * @param list A pointer to the List.
+ * @param action Called once per element, concurrently from several threads.
+ * @param context Passed to every action call.
+ *
+ * The action may modify the element in place. If it changes element contents,
+ * any hash index on the list is rebuilt afterwards.
+ */
+void listParallelForEach(List *list, ListAction action, void *context) {
+    listLinearize(list);
+    size_t count = (size_t)list->currentCount;
+    ListParallelJob job = {0};
+    job.list = list;
+    job.action = action;
+    job.context = context;
+
+    if (count < LIST_PARALLEL_MIN_ELEMENTS) {
+        job.chunkSize = count;
+        if (count > 0) {
+            listForEachTask(&job, 0);
+        }
+    } else {
+        job.chunkSize = listChunkSize(count);
+        listParallelFor((count + job.chunkSize - 1) / job.chunkSize, listForEachTask, &job);
+    }
+    list->sorted = false;
+    if (list->hashIndex) {
+        listIndexRebuild(list);
+    }
+}
@@ -0,0 +1,160 @@
+/**
+ * @file list_segmented.c
+ * @brief Segmented lists: growth without realloc.
+ * @author Mark Jayson Lanuzo
+ * @date 2026-10-17
+ *
+ * A List doubles its buffer with realloc, which copies every element and
+ * invalidates every pointer handed out so far; on a list of a few hundred
+ * megabytes one add can take hundreds of milliseconds. A ListSegmented adds a
+ * new segment as large as all previous ones together instead, so an add never
+ * copies and existing elements never move. Indexes map to segments with the
+ * bit-scan math of listSegmentOf, shared with ListConcurrent.
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "list.h"
+
+/**
+ * @brief Initializes an empty segmented list; the first segment is allocated on the first add.
+ * @param list A pointer to the ListSegmented.
+ * @param size The size of each element.
+ */
+void listSegInit(ListSegmented *list, size_t size) {
+    memset(list->segments, 0, sizeof(list->segments));
+    list->currentCount = 0;
+    list->initSize = 0;
+    list->size = size;
+}
+
+/**
+ * @brief Reserves the slot after the last element, adding a segment if all are full.
+ * @param list A pointer to the ListSegmented.
+ * @return The address of the new slot, for the caller to fill.
+ */
+void *listSegAppend(ListSegmented *list) {
+    if (list->currentCount == INT32_MAX) {
+        fprintf(stderr, "Memory allocation failed\n");
+        exit(EXIT_FAILURE);
+    }
+    size_t offset;
+    int segment = listSegmentOf(list->currentCount, &offset);
+    if (!list->segments[segment]) {
+        list->segments[segment] = malloc(listSegmentCapacity(segment) * list->size);
+        if (!list->segments[segment]) {
+            fprintf(stderr, "Memory allocation failed\n");
+            exit(EXIT_FAILURE);
+        }
+        list->initSize += (int)listSegmentCapacity(segment);
+    }
+    list->currentCount++;
+    return list->segments[segment] + offset * list->size;
+}
+
+/**
+ * @brief Removes the element at an index, shifting the later elements down by one.
+ * @param list A pointer to the ListSegmented.
+ * @param index The index of the element to remove.
+ *
+ * Within a segment the tail moves with one memmove; the first element of the
+ * next segment then moves into the freed last slot. Segments are kept, so a
+ * list that grows again does not allocate.
+ */
+void listSegRemoveAt(ListSegmented *list, int index) {
+    if (index < 0 || index >= list->currentCount) {
+        printf("Invalid index: %d\n", index);
+        return;
+    }
+    size_t offset;
+    int segment = listSegmentOf(index, &offset);
+    size_t remaining = (size_t)(list->currentCount - index - 1);
+
+    while (remaining > 0) {
+        size_t capacity = listSegmentCapacity(segment);
+        size_t inSegment = capacity - offset - 1;
+        unsigned char *slot = list->segments[segment] + offset * list->size;
+        if (inSegment > remaining) {
+            inSegment = remaining;
+        }
+        memmove(slot, slot + list->size, inSegment * list->size);
+        remaining -= inSegment;
+        if (remaining == 0) {
+            break;
+        }
+        memcpy(list->segments[segment] + (capacity - 1) * list->size,
+               list->segments[segment + 1], list->size);
+        remaining--;
+        segment++;
+        offset = 0;
+    }
+    list->currentCount--;
+}
+
+/**
+ * @brief Finds the first element equal to a value, comparing byte by byte.
+ * @param list A pointer to the ListSegmented.
+ * @param value A pointer to the value to look for.
+ * @return The index of the element, or -1 if it is not found.
+ */
+int listSegIndexOf(ListSegmented *list, const void *value) {
+    int index = 0;
+    for (int segment = 0; index < list->currentCount; segment++) {
+        size_t capacity = listSegmentCapacity(segment);
+        const unsigned char *element = list->segments[segment];
+        for (size_t i = 0; i < capacity && index < list->currentCount; i++, index++) {
+            if (memcmp(element, value, list->size) == 0) {
+                return index;
+            }
+            element += list->size;
+        }
+    }
+    return -1;
+}
+
+/**
+ * @brief Copies the elements of a segmented list into a new contiguous array.
+ * @param list A pointer to the ListSegmented.
+ * @return A malloc'd array of currentCount elements; free it when done.
+ */
+void *listSegToArray(ListSegmented *list) {
+    unsigned char *array = malloc((size_t)list->currentCount * list->size + 1);
+    if (!array) {
+        fprintf(stderr, "Memory allocation failed\n");
+        exit(EXIT_FAILURE);
+    }
+    size_t copied = 0;
+    for (int segment = 0; copied < (size_t)list->currentCount; segment++) {
+        size_t count = listSegmentCapacity(segment);
+        if (count > (size_t)list->currentCount - copied) {
+            count = (size_t)list->currentCount - copied;
+        }
+        memcpy(array + copied * list->size, list->segments[segment], count * list->size);
+        copied += count;
+    }
+    return array;
+}
+
+/**
+ * @brief Gets the number of elements in a segmented list.
+ */
+int listSegLength(ListSegmented *list) {
+    return list->currentCount;
+}
+
+/**
+ * @brief Frees every segment of a segmented list.
+ * @param list A pointer to the ListSegmented.
+ */
+void listSegFree(ListSegmented *list) {
+    for (int segment = 0; segment < LIST_SEGMENT_COUNT; segment++) {
+        free(list->segments[segment]);
+        list->segments[segment] = NULL;
+    }
+    list->currentCount = 0;
+    list->initSize = 0;
+}
@@ -0,0 +1,1357 @@
+/**
+ * @file list_simd.c
+ * @brief SSE2 / AVX2 search and reduction kernels for primitive-typed lists.
+ * @author Mark Jayson Lanuzo
+ * @date 2026-10-17
+ *
+ * Equality kernels compare elements as 32-bit or 64-bit words, which gives the
+ * same result as memcmp for any element of that size, so list_CONTAINS and
+ * list_GET_INDEX_OF use them for every 4 or 8 byte element type. Min, max and
+ * sum need the real element type and use the kind recorded by list_INIT.
+ *
+ * The instruction set is detected once at runtime. Builds for other
+ * architectures only get the scalar kernels.
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "list.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#define LIST_SIMD_X86 1
+#include <immintrin.h>
+#define LIST_TARGET_SSE2 __attribute__((target("sse2")))
+#define LIST_TARGET_AVX2 __attribute__((target("avx2")))
+#endif
+
+#define LIST_NOT_FOUND ((size_t)-1)
+
+static int listSimdCurrent = -1;
+
+/**
+ * @brief Maps a data type name and size to a primitive element kind.
+ * @param dataType The data type name as written in list_INIT.
+ * @param size The size of the data type in bytes.
+ * @return The element kind, or LIST_KIND_OTHER for non-primitive types.
+ */
+ListKind listKindOf(const char *dataType, size_t size) {
+    char name[64];
+    size_t length = 0;
+
+    if (!dataType || (size != 4 && size != 8)) {
+        return LIST_KIND_OTHER;
+    }
+    for (const char *c = dataType; *c && length < sizeof(name) - 1; c++) {
+        if (*c != ' ') {
+            name[length++] = *c;
+        }
+    }
+    name[length] = '\0';
+
+    if (length > 0 && name[length - 1] == '*') {
+        return LIST_KIND_PTR;
+    }
+    if (strcmp(name, "float") == 0) {
+        return LIST_KIND_F32;
+    }
+    if (strcmp(name, "double") == 0) {
+        return LIST_KIND_F64;
+    }
+    if (strcmp(name, "int") == 0 || strcmp(name, "signedint") == 0 ||
+        strcmp(name, "int32_t") == 0 || strcmp(name, "long") == 0 ||
+        strcmp(name, "longint") == 0 || strcmp(name, "longlong") == 0 ||
+        strcmp(name, "int64_t") == 0 || strcmp(name, "ssize_t") == 0 ||
+        strcmp(name, "intptr_t") == 0 || strcmp(name, "ptrdiff_t") == 0) {
+        return size == 4 ? LIST_KIND_I32 : size == 8 ? LIST_KIND_I64 : LIST_KIND_OTHER;
+    }
+    if (strcmp(name, "unsigned") == 0 || strcmp(name, "unsignedint") == 0 ||
+        strcmp(name, "uint32_t") == 0 || strcmp(name, "unsignedlong") == 0 ||
+        strcmp(name, "unsignedlonglong") == 0 || strcmp(name, "uint64_t") == 0 ||
+        strcmp(name, "size_t") == 0 || strcmp(name, "uintptr_t") == 0) {
+        return size == 4 ? LIST_KIND_U32 : size == 8 ? LIST_KIND_U64 : LIST_KIND_OTHER;
+    }
+    return LIST_KIND_OTHER;
+}
+
+/**
+ * @brief Returns the instruction set used by the kernels.
+ *
+ * Detected on first use; can be lowered with listSimdSetLevel.
+ */
+ListSimdLevel listSimdLevel(void) {
+    if (listSimdCurrent < 0) {
+        listSimdCurrent = LIST_SIMD_SCALAR;
+#ifdef LIST_SIMD_X86
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("avx2")) {
+            listSimdCurrent = LIST_SIMD_AVX2;
+        } else if (__builtin_cpu_supports("sse2")) {
+            listSimdCurrent = LIST_SIMD_SSE2;
+        }
+#endif
+    }
+    return (ListSimdLevel)listSimdCurrent;
+}
+
+/**
+ * @brief Selects the instruction set used by the kernels.
+ * @param level The requested level. It is capped to what the CPU supports.
+ *
+ * Mainly useful to benchmark or debug the scalar fallback.
+ */
+void listSimdSetLevel(ListSimdLevel level) {
+    listSimdCurrent = -1;
+    ListSimdLevel supported = listSimdLevel();
+    listSimdCurrent = level < supported ? level : supported;
+}
+
+/* ---------------------------------------------------------------------------
+ * Scalar kernels
+ * ------------------------------------------------------------------------- */
+
+static size_t listFind32Scalar(const uint32_t *data, size_t count, uint32_t value) {
+    for (size_t i = 0; i < count; i++) {
+        if (data[i] == value) {
+            return i;
+        }
+    }
+    return LIST_NOT_FOUND;
+}
+
+static size_t listFind64Scalar(const uint64_t *data, size_t count, uint64_t value) {
+    for (size_t i = 0; i < count; i++) {
+        if (data[i] == value) {
+            return i;
+        }
+    }
+    return LIST_NOT_FOUND;
+}
+
+static size_t listCount32Scalar(const uint32_t *data, size_t count, uint32_t value) {
+    size_t total = 0;
+    for (size_t i = 0; i < count; i++) {
+        total += data[i] == value;
+    }
+    return total;
+}
+
+static size_t listCount64Scalar(const uint64_t *data, size_t count, uint64_t value) {
+    size_t total = 0;
+    for (size_t i = 0; i < count; i++) {
+        total += data[i] == value;
+    }
+    return total;
+}
+
+#define LIST_MINMAX_SCALAR(name, T)                                                 \
+static void name(const T *data, size_t count, T *minOut, T *maxOut) {               \
+    T lo = data[0];                                                                 \
+    T hi = data[0];                                                                 \
+    for (size_t i = 1; i < count; i++) {                                            \
+        lo = data[i] < lo ? data[i] : lo;                                           \
+        hi = data[i] > hi ? data[i] : hi;                                           \
+    }                                                                               \
+    *minOut = lo;                                                                   \
+    *maxOut = hi;                                                                   \
+}
+
+LIST_MINMAX_SCALAR(listMinMaxI32Scalar, int32_t)
+LIST_MINMAX_SCALAR(listMinMaxU32Scalar, uint32_t)
+LIST_MINMAX_SCALAR(listMinMaxI64Scalar, int64_t)
+LIST_MINMAX_SCALAR(listMinMaxU64Scalar, uint64_t)
+LIST_MINMAX_SCALAR(listMinMaxF32Scalar, float)
+LIST_MINMAX_SCALAR(listMinMaxF64Scalar, double)
+
+/* Writes every position and advances only on a match, so there is no branch */
+#define LIST_SELECT_RANGE_SCALAR(name, T)                                           \
+static size_t name(const T *data, size_t count, T low, T high, uint32_t base,       \
+                   uint32_t *out) {                                                 \
+    size_t selected = 0;                                                            \
+    for (size_t i = 0; i < count; i++) {                                            \
+        out[selected] = base + (uint32_t)i;                                         \
+        selected += (data[i] >= low) & (data[i] <= high);                           \
+    }                                                                               \
+    return selected;                                                                \
+}
+
+LIST_SELECT_RANGE_SCALAR(listSelectRangeI32Scalar, int32_t)
+LIST_SELECT_RANGE_SCALAR(listSelectRangeU32Scalar, uint32_t)
+LIST_SELECT_RANGE_SCALAR(listSelectRangeI64Scalar, int64_t)
+LIST_SELECT_RANGE_SCALAR(listSelectRangeU64Scalar, uint64_t)
+LIST_SELECT_RANGE_SCALAR(listSelectRangeF32Scalar, float)
+LIST_SELECT_RANGE_SCALAR(listSelectRangeF64Scalar, double)
+
+static int64_t listSumI32Scalar(const int32_t *data, size_t count) {
+    int64_t total = 0;
+    for (size_t i = 0; i < count; i++) {
+        total += data[i];
+    }
+    return total;
+}
+
+static double listSumF32Scalar(const float *data, size_t count) {
+    double total = 0;
+    for (size_t i = 0; i < count; i++) {
+        total += data[i];
+    }
+    return total;
+}
+
+static double listSumF64Scalar(const double *data, size_t count) {
+    double total = 0;
+    for (size_t i = 0; i < count; i++) {
+        total += data[i];
+    }
+    return total;
+}
+
+#ifdef LIST_SIMD_X86
+
+/* ---------------------------------------------------------------------------
+ * SSE2 kernels
+ * ------------------------------------------------------------------------- */
+
+LIST_TARGET_SSE2
+static size_t listFind32Sse2(const uint32_t *data, size_t count, uint32_t value) {
+    __m128i needle = _mm_set1_epi32((int)value);
+    size_t i = 0;
+    for (; i + 16 <= count; i += 16) {
+        __m128i a = _mm_cmpeq_epi32(_mm_loadu_si128((const __m128i *)(data + i)), needle);
+        __m128i b = _mm_cmpeq_epi32(_mm_loadu_si128((const __m128i *)(data + i + 4)), needle);
+        __m128i c = _mm_cmpeq_epi32(_mm_loadu_si128((const __m128i *)(data + i + 8)), needle);
+        __m128i d = _mm_cmpeq_epi32(_mm_loadu_si128((const __m128i *)(data + i + 12)), needle);
+        if (_mm_movemask_epi8(_mm_or_si128(_mm_or_si128(a, b), _mm_or_si128(c, d)))) {
+            return i + listFind32Scalar(data + i, 16, value);
+        }
+    }
+    size_t rest = listFind32Scalar(data + i, count - i, value);
+    return rest == LIST_NOT_FOUND ? rest : i + rest;
+}
+
+LIST_TARGET_SSE2
+static inline __m128i listCmpEq64Sse2(__m128i a, __m128i b) {
+    __m128i eq = _mm_cmpeq_epi32(a, b);
+    return _mm_and_si128(eq, _mm_shuffle_epi32(eq, _MM_SHUFFLE(2, 3, 0, 1)));
+}
+
+LIST_TARGET_SSE2
+static size_t listFind64Sse2(const uint64_t *data, size_t count, uint64_t value) {
+    __m128i needle = _mm_set1_epi64x((long long)value);
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        __m128i a = listCmpEq64Sse2(_mm_loadu_si128((const __m128i *)(data + i)), needle);
+        __m128i b = listCmpEq64Sse2(_mm_loadu_si128((const __m128i *)(data + i + 2)), needle);
+        __m128i c = listCmpEq64Sse2(_mm_loadu_si128((const __m128i *)(data + i + 4)), needle);
+        __m128i d = listCmpEq64Sse2(_mm_loadu_si128((const __m128i *)(data + i + 6)), needle);
+        if (_mm_movemask_epi8(_mm_or_si128(_mm_or_si128(a, b), _mm_or_si128(c, d)))) {
+            return i + listFind64Scalar(data + i, 8, value);
+        }
+    }
+    size_t rest = listFind64Scalar(data + i, count - i, value);
+    return rest == LIST_NOT_FOUND ? rest : i + rest;
+}
+
+LIST_TARGET_SSE2
+static size_t listCount32Sse2(const uint32_t *data, size_t count, uint32_t value) {
+    __m128i needle = _mm_set1_epi32((int)value);
+    __m128i total = _mm_setzero_si128();
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        __m128i eq = _mm_cmpeq_epi32(_mm_loadu_si128((const __m128i *)(data + i)), needle);
+        total = _mm_sub_epi32(total, eq);
+    }
+    uint32_t lanes[4];
+    _mm_storeu_si128((__m128i *)lanes, total);
+    return (size_t)lanes[0] + lanes[1] + lanes[2] + lanes[3] +
+           listCount32Scalar(data + i, count - i, value);
+}
+
+LIST_TARGET_SSE2
+static size_t listCount64Sse2(const uint64_t *data, size_t count, uint64_t value) {
+    __m128i needle = _mm_set1_epi64x((long long)value);
+    __m128i total = _mm_setzero_si128();
+    size_t i = 0;
+    for (; i + 2 <= count; i += 2) {
+        __m128i eq = listCmpEq64Sse2(_mm_loadu_si128((const __m128i *)(data + i)), needle);
+        total = _mm_sub_epi64(total, eq);
+    }
+    uint64_t lanes[2];
+    _mm_storeu_si128((__m128i *)lanes, total);
+    return (size_t)(lanes[0] + lanes[1]) + listCount64Scalar(data + i, count - i, value);
+}
+
+LIST_TARGET_SSE2
+static void listMinMaxI32Sse2(const int32_t *data, size_t count, int32_t *minOut, int32_t *maxOut) {
+    if (count < 4) {
+        listMinMaxI32Scalar(data, count, minOut, maxOut);
+        return;
+    }
+    __m128i lo = _mm_loadu_si128((const __m128i *)data);
+    __m128i hi = lo;
+    size_t i = 4;
+    for (; i + 4 <= count; i += 4) {
+        __m128i x = _mm_loadu_si128((const __m128i *)(data + i));
+        __m128i lt = _mm_cmplt_epi32(x, lo);
+        __m128i gt = _mm_cmpgt_epi32(x, hi);
+        lo = _mm_or_si128(_mm_and_si128(lt, x), _mm_andnot_si128(lt, lo));
+        hi = _mm_or_si128(_mm_and_si128(gt, x), _mm_andnot_si128(gt, hi));
+    }
+    int32_t los[4], his[4];
+    _mm_storeu_si128((__m128i *)los, lo);
+    _mm_storeu_si128((__m128i *)his, hi);
+    for (int k = 0; k < 4; k++) {
+        los[0] = los[k] < los[0] ? los[k] : los[0];
+        his[0] = his[k] > his[0] ? his[k] : his[0];
+    }
+    for (; i < count; i++) {
+        los[0] = data[i] < los[0] ? data[i] : los[0];
+        his[0] = data[i] > his[0] ? data[i] : his[0];
+    }
+    *minOut = los[0];
+    *maxOut = his[0];
+}
+
+LIST_TARGET_SSE2
+static void listMinMaxF32Sse2(const float *data, size_t count, float *minOut, float *maxOut) {
+    if (count < 4) {
+        listMinMaxF32Scalar(data, count, minOut, maxOut);
+        return;
+    }
+    __m128 lo = _mm_loadu_ps(data);
+    __m128 hi = lo;
+    size_t i = 4;
+    for (; i + 4 <= count; i += 4) {
+        __m128 x = _mm_loadu_ps(data + i);
+        lo = _mm_min_ps(x, lo);
+        hi = _mm_max_ps(x, hi);
+    }
+    float los[4], his[4];
+    _mm_storeu_ps(los, lo);
+    _mm_storeu_ps(his, hi);
+    for (int k = 0; k < 4; k++) {
+        los[0] = los[k] < los[0] ? los[k] : los[0];
+        his[0] = his[k] > his[0] ? his[k] : his[0];
+    }
+    for (; i < count; i++) {
+        los[0] = data[i] < los[0] ? data[i] : los[0];
+        his[0] = data[i] > his[0] ? data[i] : his[0];
+    }
+    *minOut = los[0];
+    *maxOut = his[0];
+}
+
+LIST_TARGET_SSE2
+static void listMinMaxF64Sse2(const double *data, size_t count, double *minOut, double *maxOut) {
+    if (count < 2) {
+        listMinMaxF64Scalar(data, count, minOut, maxOut);
+        return;
+    }
+    __m128d lo = _mm_loadu_pd(data);
+    __m128d hi = lo;
+    size_t i = 2;
+    for (; i + 2 <= count; i += 2) {
+        __m128d x = _mm_loadu_pd(data + i);
+        lo = _mm_min_pd(x, lo);
+        hi = _mm_max_pd(x, hi);
+    }
+    double los[2], his[2];
+    _mm_storeu_pd(los, lo);
+    _mm_storeu_pd(his, hi);
+    los[0] = los[1] < los[0] ? los[1] : los[0];
+    his[0] = his[1] > his[0] ? his[1] : his[0];
+    for (; i < count; i++) {
+        los[0] = data[i] < los[0] ? data[i] : los[0];
+        his[0] = data[i] > his[0] ? data[i] : his[0];
+    }
+    *minOut = los[0];
+    *maxOut = his[0];
+}
+
+LIST_TARGET_SSE2
+static int64_t listSumI32Sse2(const int32_t *data, size_t count) {
+    __m128i total = _mm_setzero_si128();
+    __m128i zero = _mm_setzero_si128();
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        __m128i x = _mm_loadu_si128((const __m128i *)(data + i));
+        __m128i sign = _mm_cmpgt_epi32(zero, x);
+        total = _mm_add_epi64(total, _mm_unpacklo_epi32(x, sign));
+        total = _mm_add_epi64(total, _mm_unpackhi_epi32(x, sign));
+    }
+    int64_t lanes[2];
+    _mm_storeu_si128((__m128i *)lanes, total);
+    return lanes[0] + lanes[1] + listSumI32Scalar(data + i, count - i);
+}
+
+LIST_TARGET_SSE2
+static double listSumF32Sse2(const float *data, size_t count) {
+    __m128d total = _mm_setzero_pd();
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        __m128 x = _mm_loadu_ps(data + i);
+        total = _mm_add_pd(total, _mm_cvtps_pd(x));
+        total = _mm_add_pd(total, _mm_cvtps_pd(_mm_movehl_ps(x, x)));
+    }
+    double lanes[2];
+    _mm_storeu_pd(lanes, total);
+    return lanes[0] + lanes[1] + listSumF32Scalar(data + i, count - i);
+}
+
+LIST_TARGET_SSE2
+static double listSumF64Sse2(const double *data, size_t count) {
+    __m128d total = _mm_setzero_pd();
+    size_t i = 0;
+    for (; i + 2 <= count; i += 2) {
+        total = _mm_add_pd(total, _mm_loadu_pd(data + i));
+    }
+    double lanes[2];
+    _mm_storeu_pd(lanes, total);
+    return lanes[0] + lanes[1] + listSumF64Scalar(data + i, count - i);
+}
+
+/* ---------------------------------------------------------------------------
+ * AVX2 kernels
+ * ------------------------------------------------------------------------- */
+
+LIST_TARGET_AVX2
+static size_t listFind32Avx2(const uint32_t *data, size_t count, uint32_t value) {
+    __m256i needle = _mm256_set1_epi32((int)value);
+    size_t i = 0;
+    for (; i + 32 <= count; i += 32) {
+        __m256i a = _mm256_cmpeq_epi32(_mm256_loadu_si256((const __m256i *)(data + i)), needle);
+        __m256i b = _mm256_cmpeq_epi32(_mm256_loadu_si256((const __m256i *)(data + i + 8)), needle);
+        __m256i c = _mm256_cmpeq_epi32(_mm256_loadu_si256((const __m256i *)(data + i + 16)), needle);
+        __m256i d = _mm256_cmpeq_epi32(_mm256_loadu_si256((const __m256i *)(data + i + 24)), needle);
+        if (_mm256_movemask_epi8(_mm256_or_si256(_mm256_or_si256(a, b), _mm256_or_si256(c, d)))) {
+            return i + listFind32Scalar(data + i, 32, value);
+        }
+    }
+    size_t rest = listFind32Scalar(data + i, count - i, value);
+    return rest == LIST_NOT_FOUND ? rest : i + rest;
+}
+
+LIST_TARGET_AVX2
+static size_t listFind64Avx2(const uint64_t *data, size_t count, uint64_t value) {
+    __m256i needle = _mm256_set1_epi64x((long long)value);
+    size_t i = 0;
+    for (; i + 16 <= count; i += 16) {
+        __m256i a = _mm256_cmpeq_epi64(_mm256_loadu_si256((const __m256i *)(data + i)), needle);
+        __m256i b = _mm256_cmpeq_epi64(_mm256_loadu_si256((const __m256i *)(data + i + 4)), needle);
+        __m256i c = _mm256_cmpeq_epi64(_mm256_loadu_si256((const __m256i *)(data + i + 8)), needle);
+        __m256i d = _mm256_cmpeq_epi64(_mm256_loadu_si256((const __m256i *)(data + i + 12)), needle);
+        if (_mm256_movemask_epi8(_mm256_or_si256(_mm256_or_si256(a, b), _mm256_or_si256(c, d)))) {
+            return i + listFind64Scalar(data + i, 16, value);
+        }
+    }
+    size_t rest = listFind64Scalar(data + i, count - i, value);
+    return rest == LIST_NOT_FOUND ? rest : i + rest;
+}
+
+LIST_TARGET_AVX2
+static size_t listCount32Avx2(const uint32_t *data, size_t count, uint32_t value) {
+    __m256i needle = _mm256_set1_epi32((int)value);
+    __m256i total = _mm256_setzero_si256();
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        __m256i eq = _mm256_cmpeq_epi32(_mm256_loadu_si256((const __m256i *)(data + i)), needle);
+        total = _mm256_sub_epi32(total, eq);
+    }
+    uint32_t lanes[8];
+    _mm256_storeu_si256((__m256i *)lanes, total);
+    size_t sum = 0;
+    for (int k = 0; k < 8; k++) {
+        sum += lanes[k];
+    }
+    return sum + listCount32Scalar(data + i, count - i, value);
+}
+
+LIST_TARGET_AVX2
+static size_t listCount64Avx2(const uint64_t *data, size_t count, uint64_t value) {
+    __m256i needle = _mm256_set1_epi64x((long long)value);
+    __m256i total = _mm256_setzero_si256();
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        __m256i eq = _mm256_cmpeq_epi64(_mm256_loadu_si256((const __m256i *)(data + i)), needle);
+        total = _mm256_sub_epi64(total, eq);
+    }
+    uint64_t lanes[4];
+    _mm256_storeu_si256((__m256i *)lanes, total);
+    return (size_t)(lanes[0] + lanes[1] + lanes[2] + lanes[3]) +
+           listCount64Scalar(data + i, count - i, value);
+}
+
+LIST_TARGET_AVX2
+static void listMinMaxI32Avx2(const int32_t *data, size_t count, int32_t *minOut, int32_t *maxOut) {
+    if (count < 8) {
+        listMinMaxI32Scalar(data, count, minOut, maxOut);
+        return;
+    }
+    __m256i lo = _mm256_loadu_si256((const __m256i *)data);
+    __m256i hi = lo;
+    size_t i = 8;
+    for (; i + 8 <= count; i += 8) {
+        __m256i x = _mm256_loadu_si256((const __m256i *)(data + i));
+        lo = _mm256_min_epi32(lo, x);
+        hi = _mm256_max_epi32(hi, x);
+    }
+    int32_t los[8], his[8];
+    _mm256_storeu_si256((__m256i *)los, lo);
+    _mm256_storeu_si256((__m256i *)his, hi);
+    for (int k = 0; k < 8; k++) {
+        los[0] = los[k] < los[0] ? los[k] : los[0];
+        his[0] = his[k] > his[0] ? his[k] : his[0];
+    }
+    for (; i < count; i++) {
+        los[0] = data[i] < los[0] ? data[i] : los[0];
+        his[0] = data[i] > his[0] ? data[i] : his[0];
+    }
+    *minOut = los[0];
+    *maxOut = his[0];
+}
+
+LIST_TARGET_AVX2
+static void listMinMaxF32Avx2(const float *data, size_t count, float *minOut, float *maxOut) {
+    if (count < 8) {
+        listMinMaxF32Scalar(data, count, minOut, maxOut);
+        return;
+    }
+    __m256 lo = _mm256_loadu_ps(data);
+    __m256 hi = lo;
+    size_t i = 8;
+    for (; i + 8 <= count; i += 8) {
+        __m256 x = _mm256_loadu_ps(data + i);
+        lo = _mm256_min_ps(x, lo);
+        hi = _mm256_max_ps(x, hi);
+    }
+    float los[8], his[8];
+    _mm256_storeu_ps(los, lo);
+    _mm256_storeu_ps(his, hi);
+    for (int k = 0; k < 8; k++) {
+        los[0] = los[k] < los[0] ? los[k] : los[0];
+        his[0] = his[k] > his[0] ? his[k] : his[0];
+    }
+    for (; i < count; i++) {
+        los[0] = data[i] < los[0] ? data[i] : los[0];
+        his[0] = data[i] > his[0] ? data[i] : his[0];
+    }
+    *minOut = los[0];
+    *maxOut = his[0];
+}
+
+LIST_TARGET_AVX2
+static void listMinMaxF64Avx2(const double *data, size_t count, double *minOut, double *maxOut) {
+    if (count < 4) {
+        listMinMaxF64Scalar(data, count, minOut, maxOut);
+        return;
+    }
+    __m256d lo = _mm256_loadu_pd(data);
+    __m256d hi = lo;
+    size_t i = 4;
+    for (; i + 4 <= count; i += 4) {
+        __m256d x = _mm256_loadu_pd(data + i);
+        lo = _mm256_min_pd(x, lo);
+        hi = _mm256_max_pd(x, hi);
+    }
+    double los[4], his[4];
+    _mm256_storeu_pd(los, lo);
+    _mm256_storeu_pd(his, hi);
+    for (int k = 0; k < 4; k++) {
+        los[0] = los[k] < los[0] ? los[k] : los[0];
+        his[0] = his[k] > his[0] ? his[k] : his[0];
+    }
+    for (; i < count; i++) {
+        los[0] = data[i] < los[0] ? data[i] : los[0];
+        his[0] = data[i] > his[0] ? data[i] : his[0];
+    }
+    *minOut = los[0];
+    *maxOut = his[0];
+}
+
+LIST_TARGET_AVX2
+static int64_t listSumI32Avx2(const int32_t *data, size_t count) {
+    __m256i total = _mm256_setzero_si256();
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        __m128i a = _mm_loadu_si128((const __m128i *)(data + i));
+        __m128i b = _mm_loadu_si128((const __m128i *)(data + i + 4));
+        total = _mm256_add_epi64(total, _mm256_cvtepi32_epi64(a));
+        total = _mm256_add_epi64(total, _mm256_cvtepi32_epi64(b));
+    }
+    int64_t lanes[4];
+    _mm256_storeu_si256((__m256i *)lanes, total);
+    return lanes[0] + lanes[1] + lanes[2] + lanes[3] + listSumI32Scalar(data + i, count - i);
+}
+
+LIST_TARGET_AVX2
+static double listSumF32Avx2(const float *data, size_t count) {
+    __m256d total = _mm256_setzero_pd();
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        total = _mm256_add_pd(total, _mm256_cvtps_pd(_mm_loadu_ps(data + i)));
+        total = _mm256_add_pd(total, _mm256_cvtps_pd(_mm_loadu_ps(data + i + 4)));
+    }
+    double lanes[4];
+    _mm256_storeu_pd(lanes, total);
+    return lanes[0] + lanes[1] + lanes[2] + lanes[3] + listSumF32Scalar(data + i, count - i);
+}
+
+LIST_TARGET_AVX2
+static double listSumF64Avx2(const double *data, size_t count) {
+    __m256d total = _mm256_setzero_pd();
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        total = _mm256_add_pd(total, _mm256_loadu_pd(data + i));
+    }
+    double lanes[4];
+    _mm256_storeu_pd(lanes, total);
+    return lanes[0] + lanes[1] + lanes[2] + lanes[3] + listSumF64Scalar(data + i, count - i);
+}
+
+LIST_TARGET_AVX2
+static size_t listSelectRangeI32Avx2(const int32_t *data, size_t count, int32_t low, int32_t high,
+                                     uint32_t base, uint32_t *out) {
+    __m256i lo = _mm256_set1_epi32(low);
+    __m256i hi = _mm256_set1_epi32(high);
+    size_t selected = 0;
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        __m256i v = _mm256_loadu_si256((const __m256i *)(data + i));
+        __m256i outside = _mm256_or_si256(_mm256_cmpgt_epi32(lo, v), _mm256_cmpgt_epi32(v, hi));
+        unsigned bits = ~(unsigned)_mm256_movemask_ps(_mm256_castsi256_ps(outside)) & 0xFFu;
+        while (bits) {
+            out[selected++] = base + (uint32_t)i + (uint32_t)__builtin_ctz(bits);
+            bits &= bits - 1;
+        }
+    }
+    return selected + listSelectRangeI32Scalar(data + i, count - i, low, high,
+                                               base + (uint32_t)i, out + selected);
+}
+
+#endif /* LIST_SIMD_X86 */
+
+/* ---------------------------------------------------------------------------
+ * Dispatch
+ * ------------------------------------------------------------------------- */
+
+static size_t listFind32(const void *data, size_t count, uint32_t value) {
+#ifdef LIST_SIMD_X86
+    switch (listSimdLevel()) {
+    case LIST_SIMD_AVX2: return listFind32Avx2(data, count, value);
+    case LIST_SIMD_SSE2: return listFind32Sse2(data, count, value);
+    default: break;
+    }
+#endif
+    return listFind32Scalar(data, count, value);
+}
+
+static size_t listFind64(const void *data, size_t count, uint64_t value) {
+#ifdef LIST_SIMD_X86
+    switch (listSimdLevel()) {
+    case LIST_SIMD_AVX2: return listFind64Avx2(data, count, value);
+    case LIST_SIMD_SSE2: return listFind64Sse2(data, count, value);
+    default: break;
+    }
+#endif
+    return listFind64Scalar(data, count, value);
+}
+
+static size_t listCount32(const void *data, size_t count, uint32_t value) {
+#ifdef LIST_SIMD_X86
+    switch (listSimdLevel()) {
+    case LIST_SIMD_AVX2: return listCount32Avx2(data, count, value);
+    case LIST_SIMD_SSE2: return listCount32Sse2(data, count, value);
+    default: break;
+    }
+#endif
+    return listCount32Scalar(data, count, value);
+}
+
+static size_t listCount64(const void *data, size_t count, uint64_t value) {
+#ifdef LIST_SIMD_X86
+    switch (listSimdLevel()) {
+    case LIST_SIMD_AVX2: return listCount64Avx2(data, count, value);
+    case LIST_SIMD_SSE2: return listCount64Sse2(data, count, value);
+    default: break;
+    }
+#endif
+    return listCount64Scalar(data, count, value);
+}
+
+/**
+ * @brief Appends to out the positions (plus base) of the elements in [low, high].
+ * @return The number of positions written; out must have room for count.
+ */
+static size_t listSelectRange(const void *data, size_t count, ListKind kind, const void *low,
+                              const void *high, uint32_t base, uint32_t *out) {
+    switch (kind) {
+    case LIST_KIND_I32: {
+        int32_t lo, hi;
+        memcpy(&lo, low, sizeof(lo));
+        memcpy(&hi, high, sizeof(hi));
+#ifdef LIST_SIMD_X86
+        if (listSimdLevel() == LIST_SIMD_AVX2) {
+            return listSelectRangeI32Avx2(data, count, lo, hi, base, out);
+        }
+#endif
+        return listSelectRangeI32Scalar(data, count, lo, hi, base, out);
+    }
+    case LIST_KIND_U32: {
+        uint32_t lo, hi;
+        memcpy(&lo, low, sizeof(lo));
+        memcpy(&hi, high, sizeof(hi));
+        return listSelectRangeU32Scalar(data, count, lo, hi, base, out);
+    }
+    case LIST_KIND_I64: {
+        int64_t lo, hi;
+        memcpy(&lo, low, sizeof(lo));
+        memcpy(&hi, high, sizeof(hi));
+        return listSelectRangeI64Scalar(data, count, lo, hi, base, out);
+    }
+    case LIST_KIND_U64:
+    case LIST_KIND_PTR: {
+        if (kind == LIST_KIND_PTR && sizeof(void *) != 8) {
+            uint32_t lo, hi;
+            memcpy(&lo, low, sizeof(lo));
+            memcpy(&hi, high, sizeof(hi));
+            return listSelectRangeU32Scalar(data, count, lo, hi, base, out);
+        }
+        uint64_t lo, hi;
+        memcpy(&lo, low, sizeof(lo));
+        memcpy(&hi, high, sizeof(hi));
+        return listSelectRangeU64Scalar(data, count, lo, hi, base, out);
+    }
+    case LIST_KIND_F32: {
+        float lo, hi;
+        memcpy(&lo, low, sizeof(lo));
+        memcpy(&hi, high, sizeof(hi));
+        return listSelectRangeF32Scalar(data, count, lo, hi, base, out);
+    }
+    case LIST_KIND_F64: {
+        double lo, hi;
+        memcpy(&lo, low, sizeof(lo));
+        memcpy(&hi, high, sizeof(hi));
+        return listSelectRangeF64Scalar(data, count, lo, hi, base, out);
+    }
+    default:
+        return 0;
+    }
+}
+
+/**
+ * @brief Computes min and max of count elements of the given kind.
+ * @return false if the kind has no ordering or count is zero.
+ */
+static bool listMinMax(const void *data, size_t count, ListKind kind, void *minOut, void *maxOut) {
+    if (count == 0) {
+        return false;
+    }
+    ListSimdLevel level = listSimdLevel();
+    (void)level;
+    switch (kind) {
+    case LIST_KIND_I32:
+#ifdef LIST_SIMD_X86
+        if (level == LIST_SIMD_AVX2) { listMinMaxI32Avx2(data, count, minOut, maxOut); return true; }
+        if (level == LIST_SIMD_SSE2) { listMinMaxI32Sse2(data, count, minOut, maxOut); return true; }
+#endif
+        listMinMaxI32Scalar(data, count, minOut, maxOut);
+        return true;
+    case LIST_KIND_F32:
+#ifdef LIST_SIMD_X86
+        if (level == LIST_SIMD_AVX2) { listMinMaxF32Avx2(data, count, minOut, maxOut); return true; }
+        if (level == LIST_SIMD_SSE2) { listMinMaxF32Sse2(data, count, minOut, maxOut); return true; }
+#endif
+        listMinMaxF32Scalar(data, count, minOut, maxOut);
+        return true;
+    case LIST_KIND_F64:
+#ifdef LIST_SIMD_X86
+        if (level == LIST_SIMD_AVX2) { listMinMaxF64Avx2(data, count, minOut, maxOut); return true; }
+        if (level == LIST_SIMD_SSE2) { listMinMaxF64Sse2(data, count, minOut, maxOut); return true; }
+#endif
+        listMinMaxF64Scalar(data, count, minOut, maxOut);
+        return true;
+    case LIST_KIND_U32:
+        listMinMaxU32Scalar(data, count, minOut, maxOut);
+        return true;
+    case LIST_KIND_I64:
+        listMinMaxI64Scalar(data, count, minOut, maxOut);
+        return true;
+    case LIST_KIND_U64:
+        listMinMaxU64Scalar(data, count, minOut, maxOut);
+        return true;
+    case LIST_KIND_PTR:
+        if (sizeof(void *) == 8) {
+            listMinMaxU64Scalar(data, count, minOut, maxOut);
+        } else {
+            listMinMaxU32Scalar(data, count, minOut, maxOut);
+        }
+        return true;
+    default:
+        return false;
+    }
+}
+
+/**
+ * @brief Sums count contiguous int32 values in 64 bits with the best kernel.
+ */
+static int64_t listSumI32(const int32_t *data, size_t count) {
+#ifdef LIST_SIMD_X86
+    ListSimdLevel level = listSimdLevel();
+    if (level == LIST_SIMD_AVX2) return listSumI32Avx2(data, count);
+    if (level == LIST_SIMD_SSE2) return listSumI32Sse2(data, count);
+#endif
+    return listSumI32Scalar(data, count);
+}
+
+/**
+ * @brief Sums count contiguous elements of the given kind.
+ * @return The sum, or 0 if the kind is not numeric.
+ */
+static double listSumContiguous(const void *data, size_t count, ListKind kind) {
+    ListSimdLevel level = listSimdLevel();
+    (void)level;
+
+    switch (kind) {
+    case LIST_KIND_I32:
+        return (double)listSumI32(data, count);
+    case LIST_KIND_F32:
+#ifdef LIST_SIMD_X86
+        if (level == LIST_SIMD_AVX2) return listSumF32Avx2(data, count);
+        if (level == LIST_SIMD_SSE2) return listSumF32Sse2(data, count);
+#endif
+        return listSumF32Scalar(data, count);
+    case LIST_KIND_F64:
+#ifdef LIST_SIMD_X86
+        if (level == LIST_SIMD_AVX2) return listSumF64Avx2(data, count);
+        if (level == LIST_SIMD_SSE2) return listSumF64Sse2(data, count);
+#endif
+        return listSumF64Scalar(data, count);
+    case LIST_KIND_U32: {
+        const uint32_t *values = data;
+        uint64_t total = 0;
+        for (size_t i = 0; i < count; i++) {
+            total += values[i];
+        }
+        return (double)total;
+    }
+    case LIST_KIND_I64: {
+        const uint64_t *values = data; /* unsigned adds wrap instead of overflowing */
+        uint64_t total = 0;
+        for (size_t i = 0; i < count; i++) {
+            total += values[i];
+        }
+        return (double)(int64_t)total;
+    }
+    case LIST_KIND_U64: {
+        const uint64_t *values = data;
+        uint64_t total = 0;
+        for (size_t i = 0; i < count; i++) {
+            total += values[i];
+        }
+        return (double)total;
+    }
+    default:
+        return 0.0;
+    }
+}
+
+/**
+ * @brief Whether a kind is a signed (I32, I64) or an unsigned (U32, U64) integer kind.
+ */
+static bool listIsIntegerKind(ListKind kind, bool isSigned) {
+    return isSigned ? kind == LIST_KIND_I32 || kind == LIST_KIND_I64
+                    : kind == LIST_KIND_U32 || kind == LIST_KIND_U64;
+}
+
+/**
+ * @brief Sums count contiguous integers of an integer kind in 64 bits.
+ * @return The sum, wrapped modulo 2^64; signed sums are two's complement.
+ */
+static uint64_t listSumIntegers(const void *data, size_t count, ListKind kind) {
+    uint64_t total = 0;
+
+    switch (kind) {
+    case LIST_KIND_I32:
+        return (uint64_t)listSumI32(data, count);
+    case LIST_KIND_U32: {
+        const uint32_t *values = data;
+        for (size_t i = 0; i < count; i++) {
+            total += values[i];
+        }
+        return total;
+    }
+    default: {
+        const uint64_t *values = data;
+        for (size_t i = 0; i < count; i++) {
+            total += values[i];
+        }
+        return total;
+    }
+    }
+}
+
+/* ---------------------------------------------------------------------------
+ * View API
+ *
+ * Contiguous views run the kernels on their buffer directly. Strided views are
+ * gathered into a small stack buffer one chunk at a time, so the kernels still
+ * run on packed data and nothing is allocated.
+ * ------------------------------------------------------------------------- */
+
+#define LIST_VIEW_CHUNK 256
+
+/**
+ * @brief Copies up to LIST_VIEW_CHUNK elements of a strided view, from start on.
+ * @return The number of elements copied.
+ */
+static size_t listViewGather(const ListView *view, size_t start, unsigned char *buffer) {
+    size_t count = (size_t)view->currentCount - start;
+    if (count > LIST_VIEW_CHUNK) {
+        count = LIST_VIEW_CHUNK;
+    }
+    const unsigned char *source = (const unsigned char *)view->data + (start * view->stride);
+    for (size_t i = 0; i < count; i++) {
+        memcpy(buffer + (i * view->size), source + (i * view->stride), view->size);
+    }
+    return count;
+}
+
+static bool listViewIsContiguous(const ListView *view) {
+    return view->stride == view->size;
+}
+
+/*
+ * Scans count packed elements for value with the element size as a constant,
+ * so the compiler expands each memcmp inline instead of calling it.
+ */
+#define LIST_FIND_SIZED(bytes)                                                      \
+    case bytes:                                                                     \
+        for (size_t i = 0; i < count; i++) {                                        \
+            if (memcmp((const char *)data + (i * (bytes)), value, (bytes)) == 0) {  \
+                return i;                                                           \
+            }                                                                       \
+        }                                                                           \
+        return LIST_NOT_FOUND;
+
+#define LIST_COUNT_SIZED(bytes)                                                     \
+    case bytes:                                                                     \
+        for (size_t i = 0; i < count; i++) {                                        \
+            total += memcmp((const char *)data + (i * (bytes)), value, (bytes)) == 0;\
+        }                                                                           \
+        return total;
+
+/**
+ * @brief Finds the first position of a word in count packed elements of a view.
+ */
+static size_t listFindPacked(const void *data, size_t count, size_t size, const void *value) {
+    if (size == 4) {
+        uint32_t word;
+        memcpy(&word, value, sizeof(word));
+        return listFind32(data, count, word);
+    }
+    if (size == 8) {
+        uint64_t word;
+        memcpy(&word, value, sizeof(word));
+        return listFind64(data, count, word);
+    }
+    switch (size) {
+    LIST_FIND_SIZED(12)
+    LIST_FIND_SIZED(16)
+    LIST_FIND_SIZED(24)
+    LIST_FIND_SIZED(32)
+    LIST_FIND_SIZED(48)
+    LIST_FIND_SIZED(64)
+    default:
+        break;
+    }
+    for (size_t i = 0; i < count; i++) {
+        if (memcmp((const char *)data + (i * size), value, size) == 0) {
+            return i;
+        }
+    }
+    return LIST_NOT_FOUND;
+}
+
+/**
+ * @brief Counts the elements equal to a word in count packed elements of a view.
+ */
+static size_t listCountPacked(const void *data, size_t count, size_t size, const void *value) {
+    if (size == 4) {
+        uint32_t word;
+        memcpy(&word, value, sizeof(word));
+        return listCount32(data, count, word);
+    }
+    if (size == 8) {
+        uint64_t word;
+        memcpy(&word, value, sizeof(word));
+        return listCount64(data, count, word);
+    }
+    size_t total = 0;
+    switch (size) {
+    LIST_COUNT_SIZED(12)
+    LIST_COUNT_SIZED(16)
+    LIST_COUNT_SIZED(24)
+    LIST_COUNT_SIZED(32)
+    LIST_COUNT_SIZED(48)
+    LIST_COUNT_SIZED(64)
+    default:
+        break;
+    }
+    for (size_t i = 0; i < count; i++) {
+        total += memcmp((const char *)data + (i * size), value, size) == 0;
+    }
+    return total;
+}
+
+/**
+ * @brief Scans a view with its registered equality from start on.
+ * @return The index of the first equal element, or LIST_NOT_FOUND.
+ */
+static size_t listViewFindEqual(const ListView *view, size_t start, const void *value) {
+    for (size_t i = start; i < (size_t)view->currentCount; i++) {
+        if (view->equals((char *)view->data + (i * view->stride), value, view->size)) {
+            return i;
+        }
+    }
+    return LIST_NOT_FOUND;
+}
+
+/**
+ * @brief Finds the first element of a view equal to value.
+ * @param view A pointer to the ListView.
+ * @param value A pointer to the element to search for.
+ * @return The index of the element in the view, or -1 if it is not found.
+ *
+ * Uses the equality registered for the data type of the list (see
+ * listRegisterType) if any, like listIndexOf; otherwise compares bytewise.
+ */
+int listViewFindFirst(const ListView *view, const void *value) {
+    size_t count = (size_t)view->currentCount;
+    size_t found = LIST_NOT_FOUND;
+
+    if (view->equals) {
+        found = listViewFindEqual(view, 0, value);
+    } else if (listViewIsContiguous(view)) {
+        found = listFindPacked(view->data, count, view->size, value);
+    } else if (view->size > 8) {
+        for (size_t i = 0; i < count; i++) {
+            if (memcmp((char *)view->data + (i * view->stride), value, view->size) == 0) {
+                found = i;
+                break;
+            }
+        }
+    } else {
+        unsigned char buffer[LIST_VIEW_CHUNK * 8];
+        for (size_t start = 0; start < count && found == LIST_NOT_FOUND; start += LIST_VIEW_CHUNK) {
+            size_t chunk = listViewGather(view, start, buffer);
+            size_t position = listFindPacked(buffer, chunk, view->size, value);
+            if (position != LIST_NOT_FOUND) {
+                found = start + position;
+            }
+        }
+    }
+    return found == LIST_NOT_FOUND ? -1 : (int)found;
+}
+
+/**
+ * @brief Counts the elements of a view equal to value.
+ * @param view A pointer to the ListView.
+ * @param value A pointer to the element to count.
+ * @return The number of matching elements.
+ *
+ * Uses the registered equality if any, like listViewFindFirst.
+ */
+size_t listViewCountEqual(const ListView *view, const void *value) {
+    size_t count = (size_t)view->currentCount;
+
+    if (view->equals) {
+        size_t total = 0;
+        for (size_t i = listViewFindEqual(view, 0, value); i != LIST_NOT_FOUND;
+             i = listViewFindEqual(view, i + 1, value)) {
+            total++;
+        }
+        return total;
+    }
+    if (listViewIsContiguous(view)) {
+        return listCountPacked(view->data, count, view->size, value);
+    }
+    size_t total = 0;
+    if (view->size > 8) {
+        for (size_t i = 0; i < count; i++) {
+            total += memcmp((char *)view->data + (i * view->stride), value, view->size) == 0;
+        }
+        return total;
+    }
+    unsigned char buffer[LIST_VIEW_CHUNK * 8];
+    for (size_t start = 0; start < count; start += LIST_VIEW_CHUNK) {
+        size_t chunk = listViewGather(view, start, buffer);
+        total += listCountPacked(buffer, chunk, view->size, value);
+    }
+    return total;
+}
+
+/**
+ * @brief Computes min and max of a view, one chunk at a time when it is strided.
+ */
+static bool listViewMinMax(const ListView *view, void *minOut, void *maxOut) {
+    size_t count = (size_t)view->currentCount;
+
+    if (listViewIsContiguous(view)) {
+        return listMinMax(view->data, count, view->elementKind, minOut, maxOut);
+    }
+    if (count == 0 || view->elementKind == LIST_KIND_OTHER) {
+        return false;
+    }
+    unsigned char buffer[LIST_VIEW_CHUNK * 8];
+    unsigned char lows[16];
+    unsigned char highs[16];
+    unsigned char ignored[8];
+    for (size_t start = 0; start < count; start += LIST_VIEW_CHUNK) {
+        size_t chunk = listViewGather(view, start, buffer);
+        if (start == 0) {
+            listMinMax(buffer, chunk, view->elementKind, lows, highs);
+            continue;
+        }
+        /* Fold the chunk into the running result: slot 0 holds it, slot 1 the chunk */
+        listMinMax(buffer, chunk, view->elementKind, lows + view->size, highs + view->size);
+        listMinMax(lows, 2, view->elementKind, buffer, ignored);
+        memcpy(lows, buffer, view->size);
+        listMinMax(highs, 2, view->elementKind, ignored, buffer);
+        memcpy(highs, buffer, view->size);
+    }
+    memcpy(minOut, lows, view->size);
+    memcpy(maxOut, highs, view->size);
+    return true;
+}
+
+/**
+ * @brief Gets the smallest element of a primitive-typed view.
+ * @param view A pointer to the ListView.
+ * @param out Where to store the smallest element (view element size).
+ * @return false if the view is empty or its data type has no natural order.
+ */
+bool listViewMin(const ListView *view, void *out) {
+    unsigned char ignored[8];
+    return listViewMinMax(view, out, ignored);
+}
+
+/**
+ * @brief Gets the largest element of a primitive-typed view.
+ * @param view A pointer to the ListView.
+ * @param out Where to store the largest element (view element size).
+ * @return false if the view is empty or its data type has no natural order.
+ */
+bool listViewMax(const ListView *view, void *out) {
+    unsigned char ignored[8];
+    return listViewMinMax(view, ignored, out);
+}
+
+/**
+ * @brief Sums the elements of a numeric view.
+ * @param view A pointer to the ListView.
+ * @return The sum of the elements, or 0 if the data type is not numeric.
+ */
+double listViewSum(const ListView *view) {
+    size_t count = (size_t)view->currentCount;
+
+    if (listViewIsContiguous(view)) {
+        return listSumContiguous(view->data, count, view->elementKind);
+    }
+    if (view->elementKind == LIST_KIND_OTHER) {
+        return 0.0;
+    }
+    unsigned char buffer[LIST_VIEW_CHUNK * 8];
+    double total = 0.0;
+    for (size_t start = 0; start < count; start += LIST_VIEW_CHUNK) {
+        size_t chunk = listViewGather(view, start, buffer);
+        total += listSumContiguous(buffer, chunk, view->elementKind);
+    }
+    return total;
+}
+
+/**
+ * @brief Sums a view of integers of the given signedness, chunk by chunk if strided.
+ */
+static bool listViewSumIntegers(const ListView *view, bool isSigned, uint64_t *total) {
+    size_t count = (size_t)view->currentCount;
+
+    if (!listIsIntegerKind(view->elementKind, isSigned)) {
+        return false;
+    }
+    if (listViewIsContiguous(view)) {
+        *total = listSumIntegers(view->data, count, view->elementKind);
+        return true;
+    }
+    unsigned char buffer[LIST_VIEW_CHUNK * 8];
+    *total = 0;
+    for (size_t start = 0; start < count; start += LIST_VIEW_CHUNK) {
+        size_t chunk = listViewGather(view, start, buffer);
+        *total += listSumIntegers(buffer, chunk, view->elementKind);
+    }
+    return true;
+}
+
+/**
+ * @brief Sums the elements of a view of signed integers exactly.
+ * @param view A pointer to a ListView of int, long or long long.
+ * @param out Receives the sum; it wraps around like int64_t arithmetic on overflow.
+ * @return false if the elements are not signed integers.
+ */
+bool listViewSumI64(const ListView *view, int64_t *out) {
+    uint64_t total;
+    if (!listViewSumIntegers(view, true, &total)) {
+        return false;
+    }
+    *out = (int64_t)total;
+    return true;
+}
+
+/**
+ * @brief Sums the elements of a view of unsigned integers exactly.
+ * @param view A pointer to a ListView of unsigned int, unsigned long or size_t.
+ * @param out Receives the sum, modulo 2^64.
+ * @return false if the elements are not unsigned integers.
+ */
+bool listViewSumU64(const ListView *view, uint64_t *out) {
+    return listViewSumIntegers(view, false, out);
+}
+
+/**
+ * @brief Selects the positions of the elements of a view between two bounds.
+ * @param view A pointer to a primitive-typed ListView.
+ * @param low A pointer to the smallest value to select (view element size).
+ * @param high A pointer to the largest value to select (view element size).
+ * @param selection A pointer to an initialized ListSelection that receives the positions.
+ * @return false if the data type of the view has no natural order.
+ *
+ * Same result as list_SELECT with low <= *element && *element <= high, without
+ * a branch per element; int views use AVX2 when available.
+ */
+bool listViewSelectRange(const ListView *view, const void *low, const void *high,
+                         ListSelection *selection) {
+    size_t count = (size_t)view->currentCount;
+
+    selection->currentCount = 0;
+    if (view->elementKind == LIST_KIND_OTHER) {
+        return false;
+    }
+    listSelectionReserve(selection, (int)count);
+    if (listViewIsContiguous(view)) {
+        selection->currentCount = (int)listSelectRange(view->data, count, view->elementKind,
+                                                       low, high, 0, selection->positions);
+        return true;
+    }
+    unsigned char buffer[LIST_VIEW_CHUNK * 8];
+    size_t selected = 0;
+    for (size_t start = 0; start < count; start += LIST_VIEW_CHUNK) {
+        size_t chunk = listViewGather(view, start, buffer);
+        selected += listSelectRange(buffer, chunk, view->elementKind, low, high, (uint32_t)start,
+                                    selection->positions + selected);
+    }
+    selection->currentCount = (int)selected;
+    return true;
+}
+
+/* ---------------------------------------------------------------------------
+ * List API
+ * ------------------------------------------------------------------------- */
+
+/**
+ * @brief Finds the first element bytewise equal to value.
+ * @param list A pointer to the List.
+ * @param value A pointer to the element to search for.
+ * @return The index of the element, or -1 if the element is not found.
+ *
+ * 4 and 8 byte elements are compared with the SIMD kernels, other sizes with memcmp,
+ * expanded inline for common struct sizes (see LIST_FIND_SIZED).
+ */
+int listFindFirst(List *list, const void *value) {
+    int run;
+    for (int i = 0; i < list->currentCount; i += run) {
+        const void *data = listRun(list, i, &run);
+        size_t found = listFindPacked(data, (size_t)run, list->size, value);
+        if (found != LIST_NOT_FOUND) {
+            return i + (int)found;
+        }
+    }
+    return -1;
+}
+
+/**
+ * @brief Counts the elements bytewise equal to value.
+ * @param list A pointer to the List.
+ * @param value A pointer to the element to count.
+ * @return The number of matching elements.
+ */
+size_t listCountEqual(List *list, const void *value) {
+    size_t total = 0;
+    int run;
+    for (int i = 0; i < list->currentCount; i += run) {
+        const void *data = listRun(list, i, &run);
+        total += listCountPacked(data, (size_t)run, list->size, value);
+    }
+    return total;
+}
+
+/**
+ * @brief Gets the smallest element of a primitive-typed list.
+ * @param list A pointer to the List.
+ * @param out Where to store the smallest element (list element size).
+ * @return false if the list is empty or its data type has no natural order.
+ */
+bool listMin(List *list, void *out) {
+    listLinearize(list);
+    unsigned char ignored[8];
+    return listMinMax(list->data, (size_t)list->currentCount, list->elementKind, out, ignored);
+}
+
+/**
+ * @brief Gets the largest element of a primitive-typed list.
+ * @param list A pointer to the List.
+ * @param out Where to store the largest element (list element size).
+ * @return false if the list is empty or its data type has no natural order.
+ */
+bool listMax(List *list, void *out) {
+    listLinearize(list);
+    unsigned char ignored[8];
+    return listMinMax(list->data, (size_t)list->currentCount, list->elementKind, ignored, out);
+}
+
+/**
+ * @brief Sums the elements of a numeric list.
+ * @param list A pointer to the List.
+ * @return The sum of the elements, or 0 if the data type is not numeric.
+ *
+ * Integers are added in 64 bits and the total is converted to double, so it is
+ * exact only up to 2^53; listSumI64 and listSumU64 return the exact total.
+ * float lists are accumulated in double.
+ */
+double listSum(List *list) {
+    listLinearize(list);
+    return listSumContiguous(list->data, (size_t)list->currentCount, list->elementKind);
+}
+
+/**
+ * @brief Sums the elements of a list of signed integers exactly.
+ * @param list A pointer to a List of int, long or long long.
+ * @param out Receives the sum; it wraps around like int64_t arithmetic on overflow.
+ * @return false if the elements are not signed integers.
+ */
+bool listSumI64(List *list, int64_t *out) {
+    ListView view = listAsView(list);
+    return listViewSumI64(&view, out);
+}
+
+/**
+ * @brief Sums the elements of a list of unsigned integers exactly.
+ * @param list A pointer to a List of unsigned int, unsigned long or size_t.
+ * @param out Receives the sum, modulo 2^64.
+ * @return false if the elements are not unsigned integers.
+ */
+bool listSumU64(List *list, uint64_t *out) {
+    ListView view = listAsView(list);
+    return listViewSumU64(&view, out);
+}
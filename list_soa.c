@@ -0,0 +1,266 @@
+/**
+ * @file list_soa.c
+ * @brief Struct-of-arrays (columnar) lists.
+ * @author Mark Jayson Lanuzo
+ * @date 2026-10-17
+ *
+ * A ListSoA stores each field of a ListSchema in its own contiguous array. A
+ * filter on one field then reads only that field's bytes instead of pulling
+ * every whole row through the cache, and the column can be handed to the view
+ * kernels in list_simd.c as an ordinary contiguous ListView.
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "list.h"
+
+/**
+ * @brief Finds the schema field stored at an offset of the row struct.
+ * @return The index of the field, or -1 if no field starts at offset.
+ */
+static int listSoAFieldAt(const ListSoA *soa, size_t offset) {
+    for (int f = 0; f < soa->schema->fieldCount; f++) {
+        if (soa->schema->fields[f].offset == offset) {
+            return f;
+        }
+    }
+    return -1;
+}
+
+/**
+ * @brief Initializes a columnar list with one empty column per schema field.
+ * @param soa A pointer to the ListSoA to initialize.
+ * @param schema The fields to store as columns.
+ * @param size The size of the row struct.
+ * @return false if the schema does not describe rows of this size.
+ *
+ * dataTypeOf and nameOf are left as set by list_SOA_INIT.
+ */
+bool listSoAInit(ListSoA *soa, const ListSchema *schema, size_t size) {
+    soa->schema = schema;
+    soa->size = size;
+    soa->currentCount = 0;
+    soa->initSize = 0;
+    soa->columns = calloc((size_t)(schema->fieldCount ? schema->fieldCount : 1),
+                          sizeof(unsigned char *));
+    if (!soa->columns) {
+        fprintf(stderr, "Memory allocation failed\n");
+        exit(EXIT_FAILURE);
+    }
+    if (schema->size != size) {
+        printf("Schema %s does not match a row of %zu bytes\n", schema->name, size);
+        return false;
+    }
+    listSoAReserve(soa, LIST_DEFAULT_CAPACITY);
+    return true;
+}
+
+/**
+ * @brief Grows every column to hold at least capacity rows.
+ * @param soa A pointer to the ListSoA.
+ * @param capacity The number of rows to make room for.
+ */
+void listSoAReserve(ListSoA *soa, int capacity) {
+    if (capacity <= soa->initSize) {
+        return;
+    }
+    for (int f = 0; f < soa->schema->fieldCount; f++) {
+        unsigned char *temp = realloc(soa->columns[f],
+                                      (size_t)capacity * soa->schema->fields[f].size);
+        if (!temp) {
+            fprintf(stderr, "Memory allocation failed\n");
+            exit(EXIT_FAILURE);
+        }
+        soa->columns[f] = temp;
+    }
+    soa->initSize = capacity;
+}
+
+/**
+ * @brief Writes the fields of a row into the columns at an index.
+ */
+static void listSoAScatter(ListSoA *soa, int index, const void *row) {
+    for (int f = 0; f < soa->schema->fieldCount; f++) {
+        const ListField *field = &soa->schema->fields[f];
+        memcpy(soa->columns[f] + (size_t)index * field->size,
+               (const char *)row + field->offset, field->size);
+    }
+}
+
+/**
+ * @brief Appends a row, doubling the capacity of the columns when full.
+ * @param soa A pointer to the ListSoA.
+ * @param row A pointer to the row struct to add.
+ */
+void listSoAAdd(ListSoA *soa, const void *row) {
+    if (soa->currentCount >= soa->initSize) {
+        listSoAReserve(soa, soa->initSize ? soa->initSize * 2 : LIST_DEFAULT_CAPACITY);
+    }
+    listSoAScatter(soa, soa->currentCount, row);
+    soa->currentCount++;
+}
+
+/**
+ * @brief Copies the row at an index out of the columns into a struct.
+ * @param soa A pointer to the ListSoA.
+ * @param index The index of the row.
+ * @param row A pointer to the struct to fill; bytes of fields not in the schema are zeroed.
+ * @return false if the index is invalid, in which case row is all zero.
+ */
+bool listSoAGather(const ListSoA *soa, int index, void *row) {
+    memset(row, 0, soa->size);
+    if (index < 0 || index >= soa->currentCount) {
+        printf("No value\n");
+        return false;
+    }
+    for (int f = 0; f < soa->schema->fieldCount; f++) {
+        const ListField *field = &soa->schema->fields[f];
+        memcpy((char *)row + field->offset,
+               soa->columns[f] + (size_t)index * field->size, field->size);
+    }
+    return true;
+}
+
+/**
+ * @brief Replaces the row at an index.
+ * @param soa A pointer to the ListSoA.
+ * @param index The index of the row to replace.
+ * @param row A pointer to the new row struct.
+ */
+void listSoASet(ListSoA *soa, int index, const void *row) {
+    if (index < 0 || index >= soa->currentCount) {
+        printf("Invalid index: %d\n", index);
+        return;
+    }
+    listSoAScatter(soa, index, row);
+}
+
+/**
+ * @brief Removes the row at an index, shifting the later rows of every column.
+ * @param soa A pointer to the ListSoA.
+ * @param index The index of the row to remove.
+ */
+void listSoARemoveAt(ListSoA *soa, int index) {
+    if (index < 0 || index >= soa->currentCount) {
+        printf("Invalid index: %d\n", index);
+        return;
+    }
+    for (int f = 0; f < soa->schema->fieldCount; f++) {
+        size_t fieldSize = soa->schema->fields[f].size;
+        memmove(soa->columns[f] + (size_t)index * fieldSize,
+                soa->columns[f] + (size_t)(index + 1) * fieldSize,
+                (size_t)(soa->currentCount - index - 1) * fieldSize);
+    }
+    soa->currentCount--;
+}
+
+/**
+ * @brief Finds the first row whose stored fields equal those of a struct.
+ * @param soa A pointer to the ListSoA.
+ * @param row A pointer to the row struct to look for.
+ * @return The index of the row, or -1 if it is not found.
+ *
+ * Only the fields in the schema are compared, so padding never matters.
+ */
+int listSoAIndexOf(const ListSoA *soa, const void *row) {
+    for (int i = 0; i < soa->currentCount; i++) {
+        bool equal = true;
+        for (int f = 0; f < soa->schema->fieldCount && equal; f++) {
+            const ListField *field = &soa->schema->fields[f];
+            equal = memcmp(soa->columns[f] + (size_t)i * field->size,
+                           (const char *)row + field->offset, field->size) == 0;
+        }
+        if (equal) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+/**
+ * @brief Gets the column of the field at an offset of the row struct.
+ * @param soa A pointer to the ListSoA.
+ * @param offset The offset of the field, as given by offsetof.
+ * @return A pointer to the column, or NULL if the field is not in the schema.
+ */
+void *listSoAColumn(const ListSoA *soa, size_t offset) {
+    int f = listSoAFieldAt(soa, offset);
+    if (f < 0) {
+        printf("No column at offset %zu\n", offset);
+        return NULL;
+    }
+    return soa->columns[f];
+}
+
+/**
+ * @brief Gets the column of a field as a contiguous ListView.
+ * @param soa A pointer to the ListSoA.
+ * @param offset The offset of the field, as given by offsetof.
+ * @param kind The primitive kind of the field, LIST_KIND_OTHER if none.
+ * @return The view, or an empty view if the field is not in the schema.
+ *
+ * The view is invalidated when the list grows or is freed.
+ */
+ListView listSoAColumnView(const ListSoA *soa, size_t offset, ListKind kind) {
+    ListView view = { NULL, 0, 0, 0, LIST_KIND_OTHER, NULL };
+    int f = listSoAFieldAt(soa, offset);
+    if (f < 0) {
+        printf("No column at offset %zu\n", offset);
+        return view;
+    }
+    size_t fieldSize = soa->schema->fields[f].size;
+    view.data = soa->columns[f];
+    view.currentCount = soa->currentCount;
+    view.size = fieldSize;
+    view.stride = fieldSize;
+    view.elementKind = kind;
+    return view;
+}
+
+/**
+ * @brief Copies the selected rows into a new columnar list, column by column.
+ * @param soa A pointer to the source ListSoA.
+ * @param selection The positions to copy, for example from list_SOA_SELECT.
+ * @param subSoA A pointer to the ListSoA to fill; it is initialized here.
+ */
+void listSoACopySelection(const ListSoA *soa, const ListSelection *selection, ListSoA *subSoA) {
+    listSoAInit(subSoA, soa->schema, soa->size);
+    subSoA->dataTypeOf = soa->dataTypeOf;
+    subSoA->nameOf = soa->nameOf;
+    listSoAReserve(subSoA, selection->currentCount);
+    for (int f = 0; f < soa->schema->fieldCount; f++) {
+        size_t fieldSize = soa->schema->fields[f].size;
+        const unsigned char *src = soa->columns[f];
+        unsigned char *dst = subSoA->columns[f];
+        for (int i = 0; i < selection->currentCount; i++) {
+            memcpy(dst + (size_t)i * fieldSize,
+                   src + (size_t)selection->positions[i] * fieldSize, fieldSize);
+        }
+    }
+    subSoA->currentCount = selection->currentCount;
+}
+
+/**
+ * @brief Gets the number of rows in a columnar list.
+ */
+int listSoALength(const ListSoA *soa) {
+    return soa->currentCount;
+}
+
+/**
+ * @brief Frees every column of a columnar list.
+ * @param soa A pointer to the ListSoA.
+ */
+void listSoAFree(ListSoA *soa) {
+    for (int f = 0; soa->columns && f < soa->schema->fieldCount; f++) {
+        free(soa->columns[f]);
+    }
+    free(soa->columns);
+    soa->columns = NULL;
+    soa->currentCount = 0;
+    soa->initSize = 0;
+}
@@ -0,0 +1,224 @@
+/**
+ * @file list_sort.c
+ * @brief Radix sort and sorted lookups for primitive-typed lists.
+ * @author Mark Jayson Lanuzo
+ * @date 2026-10-17
+ *
+ * Elements are mapped to unsigned keys whose order matches the natural order of
+ * the element type (sign bit flipped for signed integers, sign-magnitude to
+ * two's complement order for floating point). The mapping is one to one, so two
+ * keys are equal exactly when the elements are bytewise equal, and a list sorted
+ * by key can answer list_GET_INDEX_OF with a binary search.
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "list.h"
+
+static uint32_t listKey32(const void *element, ListKind kind) {
+    uint32_t bits;
+    memcpy(&bits, element, sizeof(bits));
+    switch (kind) {
+    case LIST_KIND_I32:
+        return bits ^ 0x80000000u;
+    case LIST_KIND_F32:
+        return (bits & 0x80000000u) ? ~bits : bits | 0x80000000u;
+    default:
+        return bits;
+    }
+}
+
+static uint64_t listKey64(const void *element, ListKind kind) {
+    uint64_t bits;
+    memcpy(&bits, element, sizeof(bits));
+    switch (kind) {
+    case LIST_KIND_I64:
+        return bits ^ 0x8000000000000000ull;
+    case LIST_KIND_F64:
+        return (bits & 0x8000000000000000ull) ? ~bits : bits | 0x8000000000000000ull;
+    default:
+        return bits;
+    }
+}
+
+/**
+ * @brief Returns the sort key of an element as a 64-bit value.
+ */
+static uint64_t listKeyOf(List *list, const void *element) {
+    return list->size == 4 ? listKey32(element, list->elementKind)
+                           : listKey64(element, list->elementKind);
+}
+
+/**
+ * @brief Sorts a primitive-typed list in ascending order.
+ * @param list A pointer to the List.
+ * @return false if the element type has no natural order (see ListKind).
+ *
+ * Uses an LSD radix sort with 8-bit digits. All digit histograms are built in
+ * one pass, and digits that are equal in every element are skipped. Floating
+ * point values are ordered with -0.0 before 0.0 and NaNs at the ends. Marks
+ * the list as sorted, so list_GET_INDEX_OF and list_CONTAINS use a binary
+ * search until the order is changed or list_GET, list_FOR_EACH or
+ * listGetMemoryAddress hand out a pointer an element could be edited through.
+ */
+bool listSort(List *list) {
+    listLinearize(list);
+    size_t count = (size_t)list->currentCount;
+    size_t size = list->size;
+
+    if (list->elementKind == LIST_KIND_OTHER || (size != 4 && size != 8)) {
+        return false;
+    }
+    if (count > 1) {
+        unsigned char *source = list->data;
+        unsigned char *target = malloc(count * size);
+        uint64_t *keys = malloc(count * sizeof(uint64_t));
+        uint64_t *keysTarget = malloc(count * sizeof(uint64_t));
+        if (!target || !keys || !keysTarget) {
+            fprintf(stderr, "Memory allocation failed\n");
+            exit(EXIT_FAILURE);
+        }
+        for (size_t i = 0; i < count; i++) {
+            keys[i] = listKeyOf(list, source + (i * size));
+        }
+
+        size_t offsets[8][256] = {{0}};
+        for (size_t i = 0; i < count; i++) {
+            for (size_t digit = 0; digit < size; digit++) {
+                offsets[digit][(keys[i] >> (digit * 8)) & 0xFF]++;
+            }
+        }
+
+        for (size_t digit = 0; digit < size; digit++) {
+            unsigned shift = (unsigned)digit * 8;
+            if (offsets[digit][(keys[0] >> shift) & 0xFF] == count) {
+                continue;
+            }
+            size_t total = 0;
+            for (int value = 0; value < 256; value++) {
+                size_t valueCount = offsets[digit][value];
+                offsets[digit][value] = total;
+                total += valueCount;
+            }
+            for (size_t i = 0; i < count; i++) {
+                size_t position = offsets[digit][(keys[i] >> shift) & 0xFF]++;
+                keysTarget[position] = keys[i];
+                memcpy(target + (position * size), source + (i * size), size);
+            }
+            uint64_t *swapKeys = keys;
+            keys = keysTarget;
+            keysTarget = swapKeys;
+            unsigned char *swapData = source;
+            source = target;
+            target = swapData;
+        }
+
+        if (source != list->data) {
+            memcpy(list->data, source, count * size);
+            target = source;
+        }
+        free(target);
+        free(keys);
+        free(keysTarget);
+        if (list->hashIndex) {
+            listIndexRebuild(list);
+        }
+    }
+    list->sorted = true;
+    return true;
+}
+
+/**
+ * @brief Finds value in a list sorted by listSort with a binary search.
+ * @param list A pointer to the List, which must be marked as sorted.
+ * @param value A pointer to the element to search for.
+ * @return The index of the first equal element, or -1 if it is not found.
+ */
+int listSortedIndexOf(List *list, const void *value) {
+    uint64_t key = listKeyOf(list, value);
+    size_t low = 0;
+    size_t high = (size_t)list->currentCount;
+
+    while (low < high) {
+        size_t mid = low + (high - low) / 2;
+        if (listKeyOf(list, listAt(list, (int)mid)) < key) {
+            low = mid + 1;
+        } else {
+            high = mid;
+        }
+    }
+    if (low < (size_t)list->currentCount && listKeyOf(list, listAt(list, (int)low)) == key) {
+        return (int)low;
+    }
+    return -1;
+}
+
+/**
+ * @brief Copies one element of a keyed list, with a constant size for the compiler.
+ */
+static inline void listCopyKeyed(void *target, const void *source, size_t size) {
+    if (size == 4) {
+        memcpy(target, source, 4);
+    } else {
+        memcpy(target, source, 8);
+    }
+}
+
+/**
+ * @brief Merges a sorted primitive-typed list into another, in ascending order.
+ * @param list A pointer to the sorted List that receives the elements.
+ * @param other A pointer to a different sorted List of the same type; left unchanged.
+ * @return false if the lists hold different types or a type with no natural order.
+ *
+ * The list grows once and is filled from the back, so each of its elements
+ * moves at most once. Equal elements of list come before those of other. The
+ * result is marked as sorted when both lists were sorted with listSort. Use
+ * list_MERGE_SORTED for other types.
+ */
+bool listMergeSorted(List *list, List *other) {
+    size_t size = list->size;
+    if (list->elementKind == LIST_KIND_OTHER || (size != 4 && size != 8) ||
+        other->elementKind != list->elementKind || other->size != size) {
+        return false;
+    }
+    size_t oldCount = (size_t)list->currentCount;
+    size_t count = (size_t)other->currentCount;
+    listGrow(list, oldCount + count);
+    listLinearize(list);
+    listLinearize(other);
+
+    unsigned char *data = list->data;
+    const unsigned char *source = other->data;
+    size_t left = oldCount;
+    size_t right = count;
+    size_t out = oldCount + count;
+    /* Keys of the last unmerged element of each list, computed once per element */
+    uint64_t leftKey = left > 0 ? listKeyOf(list, data + (left - 1) * size) : 0;
+    uint64_t rightKey = right > 0 ? listKeyOf(list, source + (right - 1) * size) : 0;
+    while (right > 0) {
+        if (left > 0 && rightKey < leftKey) {
+            listCopyKeyed(data + (--out) * size, data + (--left) * size, size);
+            if (left > 0) {
+                leftKey = listKeyOf(list, data + (left - 1) * size);
+            }
+        } else {
+            listCopyKeyed(data + (--out) * size, source + (--right) * size, size);
+            if (right > 0) {
+                rightKey = listKeyOf(list, source + (right - 1) * size);
+            }
+        }
+    }
+    LIST_STAT_MOVED(list, (oldCount - left) * size);
+
+    list->currentCount = (int)(oldCount + count);
+    list->dataSize = list->currentCount * list->size;
+    list->sorted = list->sorted && other->sorted;
+    if (list->hashIndex) {
+        listIndexRebuild(list);
+    }
+    return true;
+}
@@ -0,0 +1,156 @@
+/**
+ * @file list_stats.c
+ * @brief Opt-in operation counters for lists, built with -DLIST_STATS.
+ * @author Mark Jayson Lanuzo
+ * @date 2026-10-17
+ *
+ * With -DLIST_STATS every List points to a ListStats entry that counts the
+ * macros called on it, the reallocations and bytes copied while growing, the
+ * bytes shifted by inserts and removals, the elements compared by linear
+ * searches and the peak buffer size. Entries are kept in a process-wide
+ * registry keyed by list name, so all lists initialized as "&people" share one
+ * entry and the registry stays as small as the number of names in the program.
+ *
+ * Without the flag the List has no stats pointer, every hook in list.h expands
+ * to ((void)0) and only the two dump functions below remain. Every translation
+ * unit of a program must be built with the same setting, because the flag
+ * changes the layout of List.
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+#include <pthread.h>
+
+#include "list.h"
+
+/**
+ * @brief The macro names printed for each ListStatsOp.
+ */
+static const char *const listStatsOpNames[] = {
+    "list_INIT", "list_ADD", "list_ADD_ALL", "list_ADD_AT", "list_REMOVE",
+    "list_REMOVE_AT", "list_SWAP_REMOVE_AT", "list_REMOVE_IF", "list_GET",
+    "list_SET", "list_GET_INDEX_OF", "list_CONTAINS", "list_TO_ARRAY",
+    "list_COLLECT", "list_SORT", "list_SORT_STABLE", "list_BINARY_SEARCH",
+    "list_PUSH_FRONT", "list_POP_FRONT", "list_POP_BACK", "list_FOR_EACH",
+    "list_SELECT", "list_PAR_COLLECT", "list_PAR_FOR_EACH", "list_MERGE_SORTED",
+    "list_PIPE",
+};
+
+_Static_assert(sizeof(listStatsOpNames) / sizeof(listStatsOpNames[0]) == LIST_OP_COUNT,
+               "listStatsOpNames must name every ListStatsOp");
+
+#ifdef LIST_STATS
+
+static pthread_mutex_t listStatsLock = PTHREAD_MUTEX_INITIALIZER;
+static ListStats *listStatsHead;
+
+/**
+ * @brief Finds or creates the registry entry for the name of a list.
+ * @param list A pointer to the List, with nameOf and dataTypeOf already set.
+ * @return The entry, which lives until the program exits.
+ *
+ * Called by list_INIT and the functions that load lists. The counters of an
+ * entry are plain integers: lists that share a name must not be used from
+ * different threads at the same time.
+ */
+ListStats *listStatsRegister(List *list) {
+    const char *name = list->nameOf ? list->nameOf : "(unnamed)";
+    pthread_mutex_lock(&listStatsLock);
+    ListStats *stats = listStatsHead;
+    while (stats && strcmp(stats->name, name) != 0) {
+        stats = stats->next;
+    }
+    if (!stats) {
+        const char *dataType = list->dataTypeOf ? list->dataTypeOf : "";
+        stats = calloc(1, sizeof(ListStats));
+        char *copy = malloc(strlen(name) + strlen(dataType) + 2);
+        if (!stats || !copy) {
+            fprintf(stderr, "Memory allocation failed\n");
+            exit(EXIT_FAILURE);
+        }
+        stats->name = copy;
+        strcpy(stats->name, name);
+        stats->dataTypeOf = stats->name + strlen(name) + 1;
+        strcpy(stats->dataTypeOf, dataType);
+        stats->next = listStatsHead;
+        listStatsHead = stats;
+    }
+    stats->liveLists++;
+    pthread_mutex_unlock(&listStatsLock);
+    return stats;
+}
+
+/**
+ * @brief Detaches a list from its registry entry; the counters are kept.
+ * @param list A pointer to the List being freed.
+ */
+void listStatsRelease(List *list) {
+    if (!list->stats) {
+        return;
+    }
+    pthread_mutex_lock(&listStatsLock);
+    list->stats->liveLists--;
+    pthread_mutex_unlock(&listStatsLock);
+    list->stats = NULL;
+}
+
+/**
+ * @brief Prints the counters of one registry entry.
+ */
+static void listStatsPrint(const ListStats *stats, FILE *out) {
+    fprintf(out, "%s (%s): %d live\n", stats->name, stats->dataTypeOf, stats->liveLists);
+    for (int op = 0; op < LIST_OP_COUNT; op++) {
+        if (stats->calls[op]) {
+            fprintf(out, "  %-20s %llu\n", listStatsOpNames[op], stats->calls[op]);
+        }
+    }
+    fprintf(out, "  reallocs %llu, bytes copied %llu, bytes moved %llu, "
+                 "comparisons %llu, peak listSize %zu\n",
+            stats->reallocs, stats->bytesCopied, stats->bytesMoved,
+            stats->comparisons, stats->peakListSize);
+}
+
+#endif
+
+/**
+ * @brief Prints the counters of a list, keyed by its name.
+ * @param list A pointer to the List.
+ * @param out The stream to print to, such as stderr.
+ *
+ * The counters include every list that was initialized with the same name,
+ * freed ones too.
+ */
+void listStatsDump(List *list, FILE *out) {
+#ifdef LIST_STATS
+    if (list->stats) {
+        listStatsPrint(list->stats, out);
+        return;
+    }
+    fprintf(out, "%s: no stats\n", listGetName(list) ? listGetName(list) : "(unnamed)");
+#else
+    (void)list;
+    fprintf(out, "list stats disabled (build with -DLIST_STATS)\n");
+#endif
+}
+
+/**
+ * @brief Prints the counters of every name in the registry.
+ * @param out The stream to print to.
+ *
+ * Meant for periodic dumps, for example from a background thread; counters
+ * of lists in use at the same time may be printed mid-update.
+ */
+void listStatsDumpAll(FILE *out) {
+#ifdef LIST_STATS
+    pthread_mutex_lock(&listStatsLock);
+    for (const ListStats *stats = listStatsHead; stats; stats = stats->next) {
+        listStatsPrint(stats, out);
+    }
+    pthread_mutex_unlock(&listStatsLock);
+#else
+    fprintf(out, "list stats disabled (build with -DLIST_STATS)\n");
+#endif
+}
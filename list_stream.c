@@ -0,0 +1,589 @@
+/**
+ * @file list_stream.c
+ * @brief Schema-driven streaming encoder and decoder for lists.
+ * @author Mark Jayson Lanuzo
+ * @date 2026-10-17
+ *
+ * listSave copies elements byte for byte, which is wrong for types holding
+ * pointers such as Person. A ListSchema describes where the strings and nested
+ * structs of a type are, so the stream can store the strings themselves.
+ *
+ * Stream layout (native byte order):
+ *
+ *   header  "CLSTREAM", u32 version, u32 element size, u64 count,
+ *           u32 name length, data type name
+ *   chunk   u32 records (0 ends the stream), u32 flags, u32 new strings,
+ *           u64 string bytes, the new strings NUL-terminated back to back,
+ *           then records * encoded record size bytes
+ *
+ * Each string is written once: records refer to strings by their position in
+ * the string pool, and every chunk only carries the strings first used in it.
+ * Scalars are copied as is, strings become a u32 pool id (LIST_STREAM_NULL for
+ * NULL) and nested structs are encoded field by field.
+ *
+ * The encoder holds one chunk and the string pool in memory, never a second
+ * copy of the list. When the pool reaches LIST_STREAM_POOL_LIMIT strings it is
+ * cleared, and the next chunk carries LIST_STREAM_RESET so that the decoder
+ * clears its pool too.
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+#include <limits.h>
+
+#include "list.h"
+
+#ifdef _WIN32
+#include <io.h>
+#define listDup _dup
+#define listFdOpen _fdopen
+#define listClose _close
+#else
+#include <unistd.h>
+#define listDup dup
+#define listFdOpen fdopen
+#define listClose close
+#endif
+
+#define LIST_STREAM_MAGIC "CLSTREAM"
+#define LIST_STREAM_VERSION 1u
+
+/** Records per chunk. */
+#define LIST_STREAM_CHUNK 4096
+
+/** Strings kept in the pool before it is cleared. */
+#ifndef LIST_STREAM_POOL_LIMIT
+#define LIST_STREAM_POOL_LIMIT (1u << 20)
+#endif
+
+/** Pool id written for a NULL string. */
+#define LIST_STREAM_NULL UINT32_MAX
+
+/** Chunk flag: both sides clear their string pool before this chunk. */
+#define LIST_STREAM_RESET 1u
+
+static const ListSchema **listSchemas;
+static int listSchemaCount;
+
+/**
+ * @brief Registers the schema of a data type for listStreamWrite and list_STREAM_READ.
+ * @param schema The schema, usually from list_SCHEMA. It must outlive its use.
+ *
+ * Lists are matched to schemas by the data type name given to list_INIT.
+ * Registering a name again replaces the previous schema.
+ */
+void listRegisterSchema(const ListSchema *schema) {
+    for (int i = 0; i < listSchemaCount; i++) {
+        if (strcmp(listSchemas[i]->name, schema->name) == 0) {
+            listSchemas[i] = schema;
+            return;
+        }
+    }
+    const ListSchema **temp = realloc(listSchemas, (size_t)(listSchemaCount + 1) * sizeof(*temp));
+    if (!temp) {
+        fprintf(stderr, "Memory allocation failed\n");
+        exit(EXIT_FAILURE);
+    }
+    listSchemas = temp;
+    listSchemas[listSchemaCount++] = schema;
+}
+
+/**
+ * @brief Finds the schema registered for a data type name.
+ * @param dataType The data type name, as given to list_INIT.
+ * @return The schema, or NULL if none is registered.
+ */
+const ListSchema *listFindSchema(const char *dataType) {
+    for (int i = 0; dataType && i < listSchemaCount; i++) {
+        if (strcmp(listSchemas[i]->name, dataType) == 0) {
+            return listSchemas[i];
+        }
+    }
+    return NULL;
+}
+
+/**
+ * @brief Size of one record of the schema in the stream.
+ */
+static size_t listEncodedSize(const ListSchema *schema) {
+    size_t size = 0;
+    for (int i = 0; i < schema->fieldCount; i++) {
+        const ListField *field = &schema->fields[i];
+        switch (field->kind) {
+        case LIST_FIELD_STRING:
+            size += sizeof(uint32_t);
+            break;
+        case LIST_FIELD_STRUCT:
+            size += listEncodedSize(field->schema);
+            break;
+        default:
+            size += field->size;
+            break;
+        }
+    }
+    return size;
+}
+
+/**
+ * @brief Number of string fields in one record of the schema.
+ */
+static size_t listStringFields(const ListSchema *schema) {
+    size_t count = 0;
+    for (int i = 0; i < schema->fieldCount; i++) {
+        const ListField *field = &schema->fields[i];
+        if (field->kind == LIST_FIELD_STRING) {
+            count++;
+        } else if (field->kind == LIST_FIELD_STRUCT) {
+            count += listStringFields(field->schema);
+        }
+    }
+    return count;
+}
+
+/* ---------------------------------------------------------------------------
+ * Encoder
+ * ------------------------------------------------------------------------- */
+
+typedef struct ListStreamBuffer {
+    unsigned char *data;
+    size_t size;
+    size_t capacity;
+} ListStreamBuffer;
+
+/**
+ * @brief String pool of the encoder: open addressing from string to pool id.
+ */
+typedef struct ListStringPool {
+    const char **strings; /**< Pool id to string, not copied */
+    size_t *hashes;       /**< Pool id to hash of the string */
+    uint32_t *slots;      /**< Hash table of pool id + 1, 0 when empty */
+    size_t slotCount;     /**< Power of two, at least twice capacity */
+    uint32_t count;       /**< Strings in the pool */
+    uint32_t capacity;    /**< Allocated size of strings and hashes */
+} ListStringPool;
+
+static void listBufferAppend(ListStreamBuffer *buffer, const void *bytes, size_t size) {
+    if (buffer->size + size > buffer->capacity) {
+        size_t capacity = buffer->capacity ? buffer->capacity : 4096;
+        while (capacity < buffer->size + size) {
+            capacity *= 2;
+        }
+        unsigned char *temp = realloc(buffer->data, capacity);
+        if (!temp) {
+            fprintf(stderr, "Memory allocation failed\n");
+            exit(EXIT_FAILURE);
+        }
+        buffer->data = temp;
+        buffer->capacity = capacity;
+    }
+    memcpy(buffer->data + buffer->size, bytes, size);
+    buffer->size += size;
+}
+
+static void *listStreamResize(void *data, size_t size) {
+    void *temp = realloc(data, size);
+    if (!temp) {
+        fprintf(stderr, "Memory allocation failed\n");
+        exit(EXIT_FAILURE);
+    }
+    return temp;
+}
+
+static void listPoolInsertSlot(ListStringPool *pool, uint32_t id) {
+    size_t mask = pool->slotCount - 1;
+    size_t slot = pool->hashes[id] & mask;
+    while (pool->slots[slot]) {
+        slot = (slot + 1) & mask;
+    }
+    pool->slots[slot] = id + 1;
+}
+
+/**
+ * @brief Gets the pool id of a string, adding it to the pool and to the
+ *        string section of the chunk if it is new.
+ */
+static uint32_t listPoolIntern(ListStringPool *pool, const char *string, ListStreamBuffer *strings,
+                               uint32_t *newStrings) {
+    size_t length = strlen(string);
+    size_t hash = listHashBytes(string, length);
+    size_t mask = pool->slotCount - 1;
+
+    for (size_t slot = hash & mask; pool->slotCount && pool->slots[slot]; slot = (slot + 1) & mask) {
+        uint32_t id = pool->slots[slot] - 1;
+        if (pool->hashes[id] == hash && strcmp(pool->strings[id], string) == 0) {
+            return id;
+        }
+    }
+    if (pool->count == pool->capacity) {
+        pool->capacity = pool->capacity ? pool->capacity * 2 : 1024;
+        pool->strings = listStreamResize(pool->strings, pool->capacity * sizeof(*pool->strings));
+        pool->hashes = listStreamResize(pool->hashes, pool->capacity * sizeof(*pool->hashes));
+        pool->slotCount = (size_t)pool->capacity * 2;
+        pool->slots = listStreamResize(pool->slots, pool->slotCount * sizeof(uint32_t));
+        memset(pool->slots, 0, pool->slotCount * sizeof(uint32_t));
+        for (uint32_t i = 0; i < pool->count; i++) {
+            listPoolInsertSlot(pool, i);
+        }
+    }
+    uint32_t id = pool->count++;
+    pool->strings[id] = string;
+    pool->hashes[id] = hash;
+    listPoolInsertSlot(pool, id);
+    listBufferAppend(strings, string, length + 1);
+    (*newStrings)++;
+    return id;
+}
+
+static void listEncodeStruct(const ListSchema *schema, const unsigned char *element,
+                             ListStringPool *pool, ListStreamBuffer *strings,
+                             ListStreamBuffer *records, uint32_t *newStrings) {
+    for (int i = 0; i < schema->fieldCount; i++) {
+        const ListField *field = &schema->fields[i];
+        const unsigned char *value = element + field->offset;
+        switch (field->kind) {
+        case LIST_FIELD_STRING: {
+            const char *string;
+            memcpy(&string, value, sizeof(string));
+            uint32_t id = string ? listPoolIntern(pool, string, strings, newStrings)
+                                 : LIST_STREAM_NULL;
+            listBufferAppend(records, &id, sizeof(id));
+            break;
+        }
+        case LIST_FIELD_STRUCT:
+            listEncodeStruct(field->schema, value, pool, strings, records, newStrings);
+            break;
+        default:
+            listBufferAppend(records, value, field->size);
+            break;
+        }
+    }
+}
+
+/**
+ * @brief Writes the list to a stream using the schema registered for its data type.
+ * @param list A pointer to the List.
+ * @param out The stream to write to, which is not closed.
+ * @return false if no schema is registered for the data type or writing failed.
+ *
+ * Memory use is bounded by one chunk of LIST_STREAM_CHUNK records plus the
+ * string pool, whatever the size of the list.
+ */
+bool listStreamWrite(List *list, FILE *out) {
+    const ListSchema *schema = listFindSchema(list->dataTypeOf);
+    listLinearize(list);
+    if (!schema || schema->size != list->size) {
+        fprintf(stderr, "listStreamWrite: no schema registered for %s\n",
+                list->dataTypeOf ? list->dataTypeOf : "(null)");
+        return false;
+    }
+
+    uint32_t version = LIST_STREAM_VERSION;
+    uint32_t elementSize = (uint32_t)list->size;
+    uint64_t count = (uint64_t)list->currentCount;
+    uint32_t nameLength = (uint32_t)strlen(schema->name);
+    bool written = fwrite(LIST_STREAM_MAGIC, 8, 1, out) == 1 &&
+                   fwrite(&version, sizeof(version), 1, out) == 1 &&
+                   fwrite(&elementSize, sizeof(elementSize), 1, out) == 1 &&
+                   fwrite(&count, sizeof(count), 1, out) == 1 &&
+                   fwrite(&nameLength, sizeof(nameLength), 1, out) == 1 &&
+                   fwrite(schema->name, nameLength, 1, out) == 1;
+
+    /* A chunk must fit in an empty pool */
+    size_t stringFields = listStringFields(schema);
+    int chunkRecords = LIST_STREAM_CHUNK;
+    if (stringFields * LIST_STREAM_CHUNK > LIST_STREAM_POOL_LIMIT) {
+        chunkRecords = (int)(LIST_STREAM_POOL_LIMIT / stringFields);
+    }
+    size_t stringsPerChunk = stringFields * (size_t)chunkRecords;
+    ListStringPool pool = {0};
+    ListStreamBuffer strings = {0};
+    ListStreamBuffer records = {0};
+
+    for (int start = 0; written && start < list->currentCount; start += chunkRecords) {
+        uint32_t chunkCount = (uint32_t)(list->currentCount - start < chunkRecords
+                                         ? list->currentCount - start : chunkRecords);
+        uint32_t flags = 0;
+        uint32_t newStrings = 0;
+        if (pool.count + stringsPerChunk > LIST_STREAM_POOL_LIMIT) {
+            pool.count = 0;
+            if (pool.slots) {
+                memset(pool.slots, 0, pool.slotCount * sizeof(uint32_t));
+            }
+            flags |= LIST_STREAM_RESET;
+        }
+        strings.size = 0;
+        records.size = 0;
+        for (uint32_t i = 0; i < chunkCount; i++) {
+            const unsigned char *element = (unsigned char *)list->data +
+                                           ((size_t)start + i) * list->size;
+            listEncodeStruct(schema, element, &pool, &strings, &records, &newStrings);
+        }
+        uint64_t stringBytes = strings.size;
+        written = fwrite(&chunkCount, sizeof(chunkCount), 1, out) == 1 &&
+                  fwrite(&flags, sizeof(flags), 1, out) == 1 &&
+                  fwrite(&newStrings, sizeof(newStrings), 1, out) == 1 &&
+                  fwrite(&stringBytes, sizeof(stringBytes), 1, out) == 1 &&
+                  (strings.size == 0 || fwrite(strings.data, strings.size, 1, out) == 1) &&
+                  fwrite(records.data, records.size, 1, out) == 1;
+    }
+    uint32_t end = 0;
+    written = written && fwrite(&end, sizeof(end), 1, out) == 1 && fflush(out) == 0;
+
+    free(pool.strings);
+    free(pool.hashes);
+    free(pool.slots);
+    free(strings.data);
+    free(records.data);
+    if (!written) {
+        fprintf(stderr, "listStreamWrite: write failed\n");
+    }
+    return written;
+}
+
+/**
+ * @brief Writes the list to a file descriptor. See listStreamWrite.
+ * @param list A pointer to the List.
+ * @param fd The file descriptor to write to, which is not closed.
+ */
+bool listStreamWriteFd(List *list, int fd) {
+    int copy = listDup(fd);
+    FILE *out = copy >= 0 ? listFdOpen(copy, "wb") : NULL;
+    if (!out) {
+        if (copy >= 0) {
+            listClose(copy);
+        }
+        fprintf(stderr, "listStreamWrite: cannot open descriptor %d\n", fd);
+        return false;
+    }
+    bool written = listStreamWrite(list, out);
+    return fclose(out) == 0 && written;
+}
+
+/* ---------------------------------------------------------------------------
+ * Decoder
+ * ------------------------------------------------------------------------- */
+
+static bool listDecodeStruct(const ListSchema *schema, const unsigned char **cursor,
+                             unsigned char *element, char **pool, uint32_t poolCount) {
+    for (int i = 0; i < schema->fieldCount; i++) {
+        const ListField *field = &schema->fields[i];
+        unsigned char *value = element + field->offset;
+        switch (field->kind) {
+        case LIST_FIELD_STRING: {
+            uint32_t id;
+            memcpy(&id, *cursor, sizeof(id));
+            *cursor += sizeof(id);
+            if (id != LIST_STREAM_NULL && id >= poolCount) {
+                return false;
+            }
+            char *string = id == LIST_STREAM_NULL ? NULL : pool[id];
+            memcpy(value, &string, sizeof(string));
+            break;
+        }
+        case LIST_FIELD_STRUCT:
+            if (!listDecodeStruct(field->schema, cursor, value, pool, poolCount)) {
+                return false;
+            }
+            break;
+        default:
+            memcpy(value, *cursor, field->size);
+            *cursor += field->size;
+            break;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Sets the fields of a list decoded into arena, with an empty buffer of capacity.
+ */
+static void listStreamInitList(List *list, size_t elementSize, ListArena *arena, size_t capacity) {
+    list->currentCount = 0;
+    list->size = elementSize;
+    list->elementKind = listKindOf(list->dataTypeOf, elementSize);
+    list->dataSize = 0;
+    list->hashIndex = NULL;
+    listBindType(list);
+    list->allocator = listArenaAllocator(arena);
+    list->growthPolicy = LIST_GROW_DOUBLE;
+    list->growthStep = 0;
+    list->autoShrink = false;
+    list->sorted = false;
+    list->head = 0;
+    list->incrementalResize = false;
+    list->oldData = NULL;
+    list->oldListSize = 0;
+    list->migrated = 0;
+    list->migrateEnd = 0;
+    list->mapping = NULL;
+    list->mappingSize = 0;
+    LIST_STAT_REGISTER(list);
+    listInitBuffer(list, capacity > 0 ? capacity : 1);
+}
+
+/**
+ * @brief Reads the chunks of a stream into a list whose header was checked.
+ */
+static bool listStreamReadChunks(List *list, const ListSchema *schema, FILE *in,
+                                 ListArena *arena, uint64_t count) {
+    const ListAllocator *allocator = listArenaAllocator(arena);
+    size_t recordSize = listEncodedSize(schema);
+    unsigned char *records = listStreamResize(NULL, recordSize * LIST_STREAM_CHUNK + 1);
+    char **pool = NULL;
+    uint32_t poolCount = 0;
+    uint32_t poolCapacity = 0;
+    bool valid = true;
+
+    while (valid) {
+        uint32_t chunkCount, flags, newStrings;
+        uint64_t stringBytes;
+        if (fread(&chunkCount, sizeof(chunkCount), 1, in) != 1) {
+            valid = false;
+            break;
+        }
+        if (chunkCount == 0) {
+            break;
+        }
+        if (chunkCount > LIST_STREAM_CHUNK ||
+            (uint64_t)list->currentCount + chunkCount > count ||
+            fread(&flags, sizeof(flags), 1, in) != 1 ||
+            fread(&newStrings, sizeof(newStrings), 1, in) != 1 ||
+            fread(&stringBytes, sizeof(stringBytes), 1, in) != 1) {
+            valid = false;
+            break;
+        }
+        if (flags & LIST_STREAM_RESET) {
+            poolCount = 0;
+        }
+        if (newStrings > LIST_STREAM_POOL_LIMIT - poolCount || stringBytes < newStrings ||
+            stringBytes > SIZE_MAX / 2) {
+            valid = false;
+            break;
+        }
+        if (poolCount + newStrings > poolCapacity) {
+            while (poolCount + newStrings > poolCapacity) {
+                poolCapacity = poolCapacity ? poolCapacity * 2 : 1024;
+            }
+            pool = listStreamResize(pool, poolCapacity * sizeof(*pool));
+        }
+        if (stringBytes > 0) {
+            /* The strings of the chunk stay in one arena block, already NUL-terminated */
+            char *block = allocator->alloc(allocator->context, (size_t)stringBytes);
+            if (!block || fread(block, (size_t)stringBytes, 1, in) != 1 ||
+                block[stringBytes - 1] != '\0') {
+                valid = false;
+                break;
+            }
+            uint32_t found = 0;
+            for (char *string = block; string < block + stringBytes && found <= newStrings;
+                 string += strlen(string) + 1) {
+                if (found < newStrings) {
+                    pool[poolCount + found] = string;
+                }
+                found++;
+            }
+            if (found != newStrings) {
+                valid = false;
+                break;
+            }
+            poolCount += newStrings;
+        } else if (newStrings != 0) {
+            valid = false;
+            break;
+        }
+        if (recordSize > 0 && fread(records, recordSize * chunkCount, 1, in) != 1) {
+            valid = false;
+            break;
+        }
+        /* The buffer grows with the chunks read, not with the count in the header */
+        listGrow(list, (size_t)list->currentCount + chunkCount);
+        const unsigned char *cursor = records;
+        for (uint32_t i = 0; i < chunkCount && valid; i++) {
+            unsigned char *element = (unsigned char *)list->data +
+                                     ((size_t)list->currentCount * list->size);
+            memset(element, 0, list->size);
+            valid = listDecodeStruct(schema, &cursor, element, pool, poolCount);
+            list->currentCount += valid;
+        }
+    }
+    free(records);
+    free(pool);
+    list->dataSize = (size_t)list->currentCount * list->size;
+    return valid && (uint64_t)list->currentCount == count;
+}
+
+/**
+ * @brief Reads a list written by listStreamWrite. Called by list_STREAM_READ.
+ * @param list A pointer to the List, with dataTypeOf and nameOf already set.
+ * @param in The stream to read from, which is not closed.
+ * @param arena The arena that receives the elements and their strings.
+ * @param elementSize The size of the list data type.
+ * @return false if the stream is truncated, corrupted, holds another data type or
+ *         no schema is registered for it.
+ *
+ * The list and every string it points to live in arena: listArenaDestroy frees
+ * them all at once, and listFree is not needed. Equal strings are decoded once
+ * per pool and shared between elements. On failure the list holds the elements
+ * decoded so far. The element count in the header is not trusted for
+ * allocation: the buffer starts at one chunk and grows as chunks arrive.
+ */
+bool listStreamRead(List *list, FILE *in, ListArena *arena, size_t elementSize) {
+    char magic[8];
+    uint32_t version, storedSize, nameLength;
+    uint64_t count = 0;
+    char name[256];
+    const ListSchema *schema = listFindSchema(list->dataTypeOf);
+    bool valid = fread(magic, sizeof(magic), 1, in) == 1 &&
+                 memcmp(magic, LIST_STREAM_MAGIC, sizeof(magic)) == 0 &&
+                 fread(&version, sizeof(version), 1, in) == 1 && version == LIST_STREAM_VERSION &&
+                 fread(&storedSize, sizeof(storedSize), 1, in) == 1 && storedSize == elementSize &&
+                 fread(&count, sizeof(count), 1, in) == 1 && count <= (uint64_t)INT_MAX &&
+                 fread(&nameLength, sizeof(nameLength), 1, in) == 1 && nameLength < sizeof(name) &&
+                 fread(name, nameLength, 1, in) == 1;
+
+    if (valid) {
+        name[nameLength] = '\0';
+        valid = strcmp(name, list->dataTypeOf) == 0;
+    }
+    listStreamInitList(list, elementSize, arena,
+                       valid ? (size_t)(count < LIST_STREAM_CHUNK ? count : LIST_STREAM_CHUNK) : 0);
+
+    if (!valid || !schema || schema->size != elementSize) {
+        fprintf(stderr, "listStreamRead: %s\n", !schema ? "no schema registered for the data type"
+                                                        : "not a stream of this data type");
+        return false;
+    }
+    if (!listStreamReadChunks(list, schema, in, arena, count)) {
+        fprintf(stderr, "listStreamRead: truncated or corrupted stream\n");
+        return false;
+    }
+    return true;
+}
+
+/**
+ * @brief Reads a list from a file descriptor. See listStreamRead.
+ * @param fd The file descriptor to read from, which is not closed.
+ *
+ * The descriptor is read without buffering, so it is left right after the end
+ * of the stream and the caller can go on reading whatever follows.
+ */
+bool listStreamReadFd(List *list, int fd, ListArena *arena, size_t elementSize) {
+    int copy = listDup(fd);
+    FILE *in = copy >= 0 ? listFdOpen(copy, "rb") : NULL;
+    if (!in || setvbuf(in, NULL, _IONBF, 0) != 0) {
+        fprintf(stderr, "listStreamRead: cannot open descriptor %d\n", fd);
+        if (in) {
+            fclose(in);
+        } else if (copy >= 0) {
+            listClose(copy);
+        }
+        listStreamInitList(list, elementSize, arena, 0);
+        return false;
+    }
+    bool valid = listStreamRead(list, in, arena, elementSize);
+    fclose(in);
+    return valid;
+}
@@ -0,0 +1,241 @@
+/**
+ * @file list_typed.h
+ * @brief Type-specialized list generator.
+ * @author Mark Jayson Lanuzo
+ * @date 2026-10-17
+ *
+ * The generic List in list.h stores elements behind a void pointer and copies
+ * them with memcpy of a runtime size. LIST_DECLARE / LIST_DEFINE generate a
+ * list type bound to a single element type at compile time, so element stores,
+ * loads and comparisons use the real type and can be inlined and vectorized.
+ *
+ * The generic List API is unchanged and can still be used side by side; it is
+ * not rebuilt on top of the typed lists, because List picks its element type
+ * at run time and carries state (index, ring head, mapping, allocator) that a
+ * generated struct does not have.
+ *
+ * @code
+ * LIST_DECLARE(IntList, int)
+ * LIST_DEFINE(IntList, int)
+ *
+ * IntList grades;
+ * IntListInit(&grades);
+ * IntListAdd(&grades, 79);
+ * int *first = IntListGet(&grades, 0);
+ * IntListFree(&grades);
+ * @endcode
+ */
+
+#ifndef LIST_TYPED_H
+#define LIST_TYPED_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+
+/** Initial capacity of a generated list, same as list_INIT. */
+#define LIST_TYPED_INIT_SIZE 8
+
+/**
+ * @brief Declares a typed list named Name holding elements of type T.
+ * @param Name The name of the generated struct and the prefix of its functions.
+ * @param T The element type.
+ *
+ * Emits the struct definition and the prototypes of the generated functions.
+ */
+#define LIST_DECLARE(Name, T)                                                       \
+typedef struct Name {                                                               \
+    T *data;             /**< Pointer to the stored elements */                     \
+    size_t count;        /**< Number of elements currently in the list */           \
+    size_t capacity;     /**< Allocated size (number of elements) */                \
+} Name;                                                                             \
+                                                                                    \
+static inline void Name##Init(Name *list);                                          \
+static inline void Name##Reserve(Name *list, size_t capacity);                      \
+static inline void Name##Add(Name *list, T inputData);                              \
+static inline void Name##AddAll(Name *list, const T *values, size_t count);         \
+static inline void Name##AddAt(Name *list, T inputData, size_t index);              \
+static inline void Name##Remove(Name *list, T inputData);                           \
+static inline void Name##RemoveAt(Name *list, size_t index);                        \
+static inline int Name##IndexOf(const Name *list, T inputData);                     \
+static inline bool Name##Contains(const Name *list, T inputData);                   \
+static inline T *Name##ToArray(const Name *list);                                   \
+static inline void Name##FromArray(Name *list, const T *array, size_t count);       \
+static inline T *Name##Get(Name *list, size_t index);                               \
+static inline void Name##Set(Name *list, size_t index, T inputData);                \
+static inline size_t Name##Length(const Name *list);                                \
+static inline bool Name##IsEmpty(const Name *list);                                 \
+static inline void Name##Free(Name *list);
+
+
+/**
+ * @brief Defines the functions declared by LIST_DECLARE(Name, T).
+ * @param Name The name used in LIST_DECLARE.
+ * @param T The element type used in LIST_DECLARE.
+ *
+ * Every function mirrors the list_* macro of the same name in list.h, including
+ * its handling of invalid indexes and allocation failures.
+ */
+#define LIST_DEFINE(Name, T)                                                        \
+static inline void Name##Init(Name *list) {                                         \
+    list->count = 0;                                                                \
+    list->capacity = LIST_TYPED_INIT_SIZE;                                          \
+    list->data = (T *)malloc(list->capacity * sizeof(T));                           \
+    if (!list->data) {                                                              \
+        fprintf(stderr, "Memory allocation failed\n");                              \
+        exit(EXIT_FAILURE);                                                         \
+    }                                                                               \
+}                                                                                   \
+                                                                                    \
+static inline void Name##Reserve(Name *list, size_t capacity) {                     \
+    if (capacity <= list->capacity) {                                               \
+        return;                                                                     \
+    }                                                                               \
+    T *temp = (T *)realloc(list->data, capacity * sizeof(T));                       \
+    if (!temp) {                                                                    \
+        fprintf(stderr, "Memory allocation failed\n");                              \
+        exit(EXIT_FAILURE);                                                         \
+    }                                                                               \
+    list->data = temp;                                                              \
+    list->capacity = capacity;                                                      \
+}                                                                                   \
+                                                                                    \
+static inline void Name##Add(Name *list, T inputData) {                             \
+    if (list->count >= list->capacity) {                                            \
+        Name##Reserve(list, list->capacity ? list->capacity * 2                     \
+                                           : LIST_TYPED_INIT_SIZE);                 \
+    }                                                                               \
+    list->data[list->count++] = inputData;                                          \
+}                                                                                   \
+                                                                                    \
+static inline void Name##AddAll(Name *list, const T *values, size_t count) {        \
+    if (count == 0) {                                                               \
+        return;                  /* values may be NULL, memcpy must not see it */   \
+    }                                                                               \
+    if (list->count + count > list->capacity) {                                     \
+        size_t capacity = list->capacity ? list->capacity : LIST_TYPED_INIT_SIZE;   \
+        while (capacity < list->count + count) {                                    \
+            capacity *= 2;                                                          \
+        }                                                                           \
+        Name##Reserve(list, capacity);                                              \
+    }                                                                               \
+    memcpy(list->data + list->count, values, count * sizeof(T));                    \
+    list->count += count;                                                           \
+}                                                                                   \
+                                                                                    \
+static inline void Name##AddAt(Name *list, T inputData, size_t index) {             \
+    if (index > list->count) {                                                      \
+        printf("Invalid index\n");                                                  \
+        return;                                                                     \
+    }                                                                               \
+    if (list->count >= list->capacity) {                                            \
+        Name##Reserve(list, list->capacity ? list->capacity * 2                     \
+                                           : LIST_TYPED_INIT_SIZE);                 \
+    }                                                                               \
+    memmove(list->data + index + 1, list->data + index,                             \
+            (list->count - index) * sizeof(T));                                     \
+    list->data[index] = inputData;                                                  \
+    list->count++;                                                                  \
+}                                                                                   \
+                                                                                    \
+static inline void Name##RemoveAt(Name *list, size_t index) {                       \
+    if (index >= list->count) {                                                     \
+        printf("Invalid index: %zu\n", index);                                      \
+        return;                                                                     \
+    }                                                                               \
+    memmove(list->data + index, list->data + index + 1,                             \
+            (list->count - index - 1) * sizeof(T));                                 \
+    list->count--;                                                                  \
+}                                                                                   \
+                                                                                    \
+static inline int Name##IndexOf(const Name *list, T inputData) {                    \
+    for (size_t i = 0; i < list->count; i++) {                                      \
+        if (memcmp(&list->data[i], &inputData, sizeof(T)) == 0) {                   \
+            return (int)i;                                                          \
+        }                                                                           \
+    }                                                                               \
+    return -1;                                                                      \
+}                                                                                   \
+                                                                                    \
+static inline void Name##Remove(Name *list, T inputData) {                          \
+    int foundIndex = Name##IndexOf(list, inputData);                                \
+    if (foundIndex != -1) {                                                         \
+        Name##RemoveAt(list, (size_t)foundIndex);                                   \
+    } else {                                                                        \
+        printf("Value not found in the list.\n");                                   \
+    }                                                                               \
+}                                                                                   \
+                                                                                    \
+static inline bool Name##Contains(const Name *list, T inputData) {                  \
+    return Name##IndexOf(list, inputData) != -1;                                    \
+}                                                                                   \
+                                                                                    \
+static inline T *Name##ToArray(const Name *list) {                                  \
+    T *array = (T *)malloc(list->count * sizeof(T) + 1); /* never malloc(0) */      \
+    if (!array) {                                                                   \
+        fprintf(stderr, "Memory allocation failed\n");                              \
+        exit(EXIT_FAILURE);                                                         \
+    }                                                                               \
+    memcpy(array, list->data, list->count * sizeof(T));                             \
+    return array;                                                                   \
+}                                                                                   \
+                                                                                    \
+static inline void Name##FromArray(Name *list, const T *array, size_t count) {      \
+    Name##AddAll(list, array, count);                                               \
+}                                                                                   \
+                                                                                    \
+static inline T *Name##Get(Name *list, size_t index) {                              \
+    if (index >= list->count) {                                                     \
+        printf("No value\n");                                                       \
+        return NULL;                                                                \
+    }                                                                               \
+    return &list->data[index];                                                      \
+}                                                                                   \
+                                                                                    \
+static inline void Name##Set(Name *list, size_t index, T inputData) {               \
+    if (index >= list->count) {                                                     \
+        printf("Invalid index: %zu\n", index);                                      \
+        return;                                                                     \
+    }                                                                               \
+    list->data[index] = inputData;                                                  \
+}                                                                                   \
+                                                                                    \
+static inline size_t Name##Length(const Name *list) {                               \
+    return list->count;                                                             \
+}                                                                                   \
+                                                                                    \
+static inline bool Name##IsEmpty(const Name *list) {                                \
+    return list->count == 0;                                                        \
+}                                                                                   \
+                                                                                    \
+static inline void Name##Free(Name *list) {                                         \
+    free(list->data);                                                               \
+    list->data = NULL;                                                              \
+    list->count = 0;                                                                \
+    list->capacity = 0;                                                             \
+}
+
+/**
+ * @brief Collects the elements of a typed list that satisfy an expression.
+ * @param Name The name used in LIST_DECLARE.
+ * @param list A pointer to the source list.
+ * @param expression The expression to evaluate for each element.
+ * @param subList A pointer to the list to collect into; it is initialized here.
+ *
+ * The typed counterpart of list_COLLECT_TO_SUBLIST. The expression is expanded
+ * in the loop, so the compiler can inline and vectorize it.
+ *
+ * @warning Use "element" to compare and treat it as a pointer, e.g. *element > 0.
+ */
+#define LIST_TYPED_COLLECT(Name, list, expression, subList) do {                    \
+    Name##Init(subList);                                                            \
+    for (size_t i = 0; i < (list)->count; i++) {                                    \
+        __typeof__((list)->data) element = &(list)->data[i];                        \
+        if (expression) {                                                           \
+            Name##Add(subList, *element);                                           \
+        }                                                                           \
+    }                                                                               \
+} while (0)
+
+#endif /* LIST_TYPED_H */
@@ -0,0 +1,156 @@
+/**
+ * @file list_view.c
+ * @brief Borrowed views over lists and selection vectors.
+ * @author Mark Jayson Lanuzo
+ * @date 2026-10-17
+ *
+ * Views replace list_TO_ARRAY and sublist copies for read-only code: they point
+ * into the buffer of the list and cost nothing to create. The search and
+ * reduction kernels for views live in list_simd.c next to the list versions.
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "list.h"
+
+/**
+ * @brief Narrows a view to length elements, step apart, from start on.
+ * @return The narrowed view, or an empty view if the range is not inside view.
+ */
+static ListView listViewRange(const ListView *view, int start, int length, int step) {
+    ListView slice = *view;
+    long long last = (long long)start + ((long long)length - 1) * step;
+
+    if (start < 0 || length < 0 || step < 1 || start > view->currentCount ||
+        (length > 0 && last >= view->currentCount)) {
+        printf("Invalid range: %d + %d\n", start, length);
+        slice.currentCount = 0;
+        return slice;
+    }
+    slice.data = (char *)view->data + ((size_t)start * view->stride);
+    slice.currentCount = length;
+    slice.stride = view->stride * (size_t)step;
+    return slice;
+}
+
+/**
+ * @brief Gets a view over every element of a list.
+ * @param list A pointer to the List.
+ * @return A contiguous view, valid until the list is resized or freed.
+ */
+ListView listAsView(List *list) {
+    ListView view;
+    listLinearize(list);
+    view.data = list->data;
+    view.currentCount = list->currentCount;
+    view.size = list->size;
+    view.stride = list->size;
+    view.elementKind = list->elementKind;
+    view.equals = list->equals;
+    return view;
+}
+
+/**
+ * @brief Gets a view over consecutive elements of a list.
+ * @param list A pointer to the List.
+ * @param start The index of the first element of the view.
+ * @param length The number of elements in the view.
+ * @return The view, or an empty view if the range is not inside the list.
+ */
+ListView listSlice(List *list, int start, int length) {
+    return listSliceStep(list, start, length, 1);
+}
+
+/**
+ * @brief Gets a view over every step-th element of a list.
+ * @param list A pointer to the List.
+ * @param start The index of the first element of the view.
+ * @param length The number of elements in the view.
+ * @param step The distance between two elements of the view, in elements.
+ * @return The view, or an empty view if the range is not inside the list.
+ */
+ListView listSliceStep(List *list, int start, int length, int step) {
+    ListView view = listAsView(list);
+    return listViewRange(&view, start, length, step);
+}
+
+/**
+ * @brief Gets a view over consecutive elements of another view.
+ * @param view A pointer to the ListView.
+ * @param start The index of the first element of the new view.
+ * @param length The number of elements in the new view.
+ * @return The view, or an empty view if the range is not inside view.
+ */
+ListView listViewSlice(const ListView *view, int start, int length) {
+    return listViewRange(view, start, length, 1);
+}
+
+/**
+ * @brief Gets the memory address of an element of a view.
+ * @param view A pointer to the ListView.
+ * @param index The index of the element.
+ * @return A pointer to the element, or NULL if the index is invalid.
+ */
+void *listViewGet(const ListView *view, int index) {
+    if (index < 0 || index >= view->currentCount) {
+        printf("Invalid index: %d\n", index);
+        return NULL;
+    }
+    return listViewAt(view, index);
+}
+
+/**
+ * @brief Initializes an empty selection.
+ * @param selection A pointer to the ListSelection.
+ */
+void listSelectionInit(ListSelection *selection) {
+    selection->positions = NULL;
+    selection->currentCount = 0;
+    selection->capacity = 0;
+}
+
+/**
+ * @brief Doubles the capacity of a selection. Called by list_SELECT when it is full.
+ * @param selection A pointer to the ListSelection.
+ */
+void listSelectionGrow(ListSelection *selection) {
+    int capacity = selection->capacity > 0 ? selection->capacity * 2 : LIST_DEFAULT_CAPACITY;
+    uint32_t *temp = realloc(selection->positions, (size_t)capacity * sizeof(uint32_t));
+    if (!temp) {
+        fprintf(stderr, "Memory allocation failed\n");
+        exit(EXIT_FAILURE);
+    }
+    selection->positions = temp;
+    selection->capacity = capacity;
+}
+
+/**
+ * @brief Makes sure a selection can hold capacity positions without growing.
+ * @param selection A pointer to the ListSelection.
+ * @param capacity The number of positions to reserve room for.
+ */
+void listSelectionReserve(ListSelection *selection, int capacity) {
+    if (capacity <= selection->capacity) {
+        return;
+    }
+    uint32_t *temp = realloc(selection->positions, (size_t)capacity * sizeof(uint32_t));
+    if (!temp) {
+        fprintf(stderr, "Memory allocation failed\n");
+        exit(EXIT_FAILURE);
+    }
+    selection->positions = temp;
+    selection->capacity = capacity;
+}
+
+/**
+ * @brief Frees the positions of a selection.
+ * @param selection A pointer to the ListSelection.
+ */
+void listSelectionFree(ListSelection *selection) {
+    free(selection->positions);
+    listSelectionInit(selection);
+}
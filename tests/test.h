@@ -0,0 +1,51 @@
+/**
+ * @file test.h
+ * @brief Shared helpers for the list tests.
+ * @author Mark Jayson Lanuzo
+ * @date 2026-10-17
+ *
+ * Each test is a program that returns a nonzero exit status when a check
+ * fails; make test builds and runs all of them.
+ */
+
+#ifndef TEST_H
+#define TEST_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+
+/** Number of failed checks so far. */
+static int testFailures;
+
+/**
+ * @brief Records a failure, with its location, when condition is false.
+ */
+#define TEST_CHECK(condition) do {                                                  \
+    if (!(condition)) {                                                             \
+        fprintf(stderr, "%s:%d: check failed: %s\n", __FILE__, __LINE__, #condition);\
+        testFailures++;                                                             \
+    }                                                                               \
+} while (0)
+
+static uint32_t testSeed = 2463534242u;
+
+/**
+ * @brief Deterministic xorshift random numbers, so failures can be replayed.
+ */
+static inline uint32_t testRandom(void) {
+    testSeed ^= testSeed << 13;
+    testSeed ^= testSeed >> 17;
+    testSeed ^= testSeed << 5;
+    return testSeed;
+}
+
+/**
+ * @brief Prints the outcome of a test program and returns its exit status.
+ */
+static inline int testReport(const char *name) {
+    printf("%-24s %s\n", name, testFailures ? "FAILED" : "ok");
+    return testFailures ? EXIT_FAILURE : EXIT_SUCCESS;
+}
+
+#endif /* TEST_H */
@@ -0,0 +1,164 @@
+/**
+ * @file test_alloc.c
+ * @brief Arena and pool backends checked with many interleaved lists.
+ * @author Mark Jayson Lanuzo
+ * @date 2026-10-17
+ *
+ * Grows, shrinks and frees a set of lists whose buffers come from one arena or
+ * one pool, in random order, and compares each list with its own plain array,
+ * so a block handed out twice or resized over a neighbour shows up as changed
+ * contents. Also checks block alignment, arena reset, pool recycling, buffers
+ * larger than the biggest size class, moving a list between allocators and
+ * collecting a sublist into an arena.
+ */
+
+#include <stdlib.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "test.h"
+#include "../list.h"
+
+#define LISTS 16
+#define STEPS 20000
+#define MAX_COUNT 20000
+
+static int models[LISTS][MAX_COUNT];
+static int modelCounts[LISTS];
+
+static bool sameContents(List *list, const int *model, int count) {
+    if (list->currentCount != count) {
+        return false;
+    }
+    for (int i = 0; i < count; i++) {
+        if (*list_GET(list, int, i) != model[i]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Applies random adds, pops, shrinks and re-creations to LISTS lists that
+ *        share one allocator, checking all of them as it goes.
+ */
+static void runLists(const ListAllocator *allocator) {
+    List lists[LISTS];
+    for (int l = 0; l < LISTS; l++) {
+        list_INIT_WITH_ALLOCATOR(&lists[l], int, 1, allocator);
+        modelCounts[l] = 0;
+    }
+
+    for (int s = 0; s < STEPS && !testFailures; s++) {
+        int l = (int)(testRandom() % LISTS);
+        List *list = &lists[l];
+        int *model = models[l];
+        int operation = (int)(testRandom() % 10);
+        if (operation < 6) {
+            /* mostly small lists, now and then one past the largest size class */
+            int count = (int)(testRandom() % (operation == 0 && l == 0 ? 2000 : 40));
+            for (int i = 0; i < count && modelCounts[l] < MAX_COUNT; i++) {
+                int value = (int)testRandom();
+                list_ADD(list, int, value);
+                model[modelCounts[l]++] = value;
+            }
+        } else if (operation < 8) {
+            while (modelCounts[l] > 0 && testRandom() % 4) {
+                TEST_CHECK(list_POP_BACK(list, int) == model[modelCounts[l] - 1]);
+                modelCounts[l]--;
+            }
+            listShrinkToFit(list);
+        } else if (operation == 8) {
+            listFree(list);
+            list_INIT_WITH_ALLOCATOR(list, int, 1 + testRandom() % 100, allocator);
+            modelCounts[l] = 0;
+        }
+        TEST_CHECK(((uintptr_t)list->data & 15) == 0);
+        TEST_CHECK(sameContents(list, model, modelCounts[l]));
+        for (int k = 0; k < LISTS && s % 64 == 0; k++) {
+            TEST_CHECK(sameContents(&lists[k], models[k], modelCounts[k]));
+        }
+    }
+
+    for (int l = 0; l < LISTS; l++) {
+        listFree(&lists[l]);
+    }
+}
+
+static void testArena(void) {
+    ListArena arena;
+    listArenaInit(&arena, 4096);
+    runLists(listArenaAllocator(&arena));
+
+    listArenaReset(&arena);
+    List list;
+    list_INIT_WITH_ALLOCATOR(&list, int, 8, listArenaAllocator(&arena));
+    void *first = list.data;
+    for (int i = 0; i < 1000; i++) {    /* the newest block grows in place */
+        list_ADD(&list, int, i);
+    }
+    for (int i = 0; i < 1000; i++) {
+        TEST_CHECK(*list_GET(&list, int, i) == i);
+    }
+    listArenaReset(&arena);
+    List again;
+    list_INIT_WITH_ALLOCATOR(&again, int, 8, listArenaAllocator(&arena));
+    TEST_CHECK(again.data == first);    /* reset reuses the newest block */
+    listArenaDestroy(&arena);
+}
+
+static void testPool(void) {
+    ListPool pool;
+    listPoolInit(&pool);
+    runLists(listPoolAllocator(&pool));
+
+    List list;
+    list_INIT_WITH_ALLOCATOR(&list, int, 10, listPoolAllocator(&pool));
+    void *block = list.data;
+    listFree(&list);
+    list_INIT_WITH_ALLOCATOR(&list, int, 12, listPoolAllocator(&pool));
+    TEST_CHECK(list.data == block);     /* same size class: recycled */
+    listFree(&list);
+    listPoolDestroy(&pool);
+}
+
+static void testMoveAndCollect(void) {
+    ListArena arena;
+    ListPool pool;
+    listArenaInit(&arena, 0);
+    listPoolInit(&pool);
+
+    List numbers;
+    list_INIT(&numbers, int);
+    for (int i = 0; i < 500; i++) {
+        list_ADD(&numbers, int, i);
+    }
+    listSetAllocator(&numbers, listPoolAllocator(&pool));
+    TEST_CHECK(numbers.allocator == listPoolAllocator(&pool));
+    list_ADD(&numbers, int, 500);
+    listSetAllocator(&numbers, listArenaAllocator(&arena));
+    for (int i = 0; i <= 500; i++) {
+        TEST_CHECK(*list_GET(&numbers, int, i) == i);
+    }
+
+    List even;
+    list_COLLECT_TO_SUBLIST_WITH_ALLOCATOR(&numbers, int, *element % 2 == 0, &even,
+                                           listArenaAllocator(&arena));
+    TEST_CHECK(even.currentCount == 251 && even.allocator == listArenaAllocator(&arena));
+    for (int i = 0; i < even.currentCount; i++) {
+        TEST_CHECK(*list_GET(&even, int, i) == 2 * i);
+    }
+    listSetAllocator(&numbers, NULL);
+    TEST_CHECK(*list_GET(&numbers, int, 500) == 500);
+    listFree(&numbers);
+    listArenaDestroy(&arena);
+    listPoolDestroy(&pool);
+}
+
+int main(void) {
+    testArena();
+    testPool();
+    testMoveAndCollect();
+    return testReport("test_alloc");
+}
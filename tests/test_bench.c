@@ -0,0 +1,193 @@
+/**
+ * @file test_bench.c
+ * @brief Output and regression check of the benchmark suite.
+ * @author Mark Jayson Lanuzo
+ * @date 2026-10-17
+ *
+ * Includes bench/bench_suite.c with its main renamed and runs it on small
+ * lists. The CSV and JSON files must hold one record per case that matches the
+ * printed results, and the allocations per operation must be the exact number
+ * of buffer growths the capacity policy implies. The baseline comparison is fed
+ * known medians: cases slower than the threshold count as regressions, faster
+ * ones and ones within the threshold do not, and header, malformed and
+ * unmatched lines are skipped. A run against a baseline exits with a failure
+ * status only when something regressed.
+ */
+
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+#include <unistd.h>
+#include <fcntl.h>
+
+#include "test.h"
+
+#define main benchSuiteMain
+#include "../bench/bench_suite.c"
+#undef main
+
+static char csvPath[64];
+static char jsonPath[64];
+static char baselinePath[64];
+static int savedStdout;
+
+/**
+ * @brief Sends the tables and reports of the suite to /dev/null until unmuteStdout.
+ */
+static void muteStdout(void) {
+    fflush(stdout);
+    savedStdout = dup(STDOUT_FILENO);
+    int null = open("/dev/null", O_WRONLY);
+    dup2(null, STDOUT_FILENO);
+    close(null);
+}
+
+static void unmuteStdout(void) {
+    fflush(stdout);
+    dup2(savedStdout, STDOUT_FILENO);
+    close(savedStdout);
+}
+
+/**
+ * @brief Runs the suite from scratch with the given arguments.
+ */
+static int runSuite(int argc, char **argv) {
+    muteStdout();
+    resultCount = 0;
+    int status = benchSuiteMain(argc, argv);
+    unmuteStdout();
+    return status;
+}
+
+static void testOutputs(void) {
+    static const size_t elementSizes[] = { 4, 64, 256 };
+    char *argv[] = { "bench_suite", "--reps", "3", "--max-n", "1000", "--op", "add",
+                     "--csv", csvPath, "--json", jsonPath };
+    TEST_CHECK(runSuite(11, argv) == EXIT_SUCCESS);
+    TEST_CHECK(resultCount == 6);               /* 3 element sizes, n = 100 and 1000 */
+    for (int i = 0; i < resultCount; i++) {
+        const BenchResult *r = &results[i];
+        TEST_CHECK(strcmp(r->op, "add") == 0 && r->reps == 3);
+        TEST_CHECK(r->elementSize == elementSizes[i / 2]);
+        TEST_CHECK(r->n == (i % 2 ? 1000 : 100));
+        TEST_CHECK(r->medianNs > 0 && r->p99Ns >= r->medianNs);
+        /* 8 -> 16 -> 32 -> 64 -> 128 for 100 adds, three more up to 1024 for 1000 */
+        TEST_CHECK(r->allocsPerOp == (r->n == 100 ? 4.0 / 100 : 7.0 / 1000));
+    }
+
+    FILE *csv = fopen(csvPath, "r");
+    char line[256];
+    TEST_CHECK(csv && fgets(line, sizeof(line), csv) &&
+               strcmp(line, "op,element_bytes,n,reps,median_ns,p99_ns,allocs_per_op,"
+                            "rss_kb\n") == 0);
+    int rows = 0;
+    char op[64];
+    size_t elementSize;
+    size_t n;
+    int reps;
+    double medianNs;
+    double p99Ns;
+    while (csv && fgets(line, sizeof(line), csv)) {
+        TEST_CHECK(sscanf(line, "%63[^,],%zu,%zu,%d,%lf,%lf", op, &elementSize, &n, &reps,
+                          &medianNs, &p99Ns) == 6);
+        TEST_CHECK(rows < resultCount);
+        if (rows < resultCount) {
+            const BenchResult *r = &results[rows];
+            TEST_CHECK(strcmp(op, r->op) == 0 && elementSize == r->elementSize && n == r->n);
+            TEST_CHECK(reps == 3 && medianNs > r->medianNs - 0.001 &&
+                       medianNs < r->medianNs + 0.001);
+        }
+        rows++;
+    }
+    TEST_CHECK(rows == resultCount);
+    if (csv) {
+        fclose(csv);
+    }
+
+    FILE *json = fopen(jsonPath, "r");
+    char text[4096];
+    size_t length = json ? fread(text, 1, sizeof(text) - 1, json) : 0;
+    text[length] = '\0';
+    int objects = 0;
+    for (const char *at = text; (at = strstr(at, "{\"op\": \"add\", ")) != NULL; at++) {
+        objects++;
+    }
+    TEST_CHECK(objects == resultCount);
+    TEST_CHECK(text[0] == '[' && length > 4 && strcmp(text + length - 4, "}\n]\n") == 0);
+    TEST_CHECK(strstr(text, "},\n]") == NULL);  /* no comma after the last object */
+    if (json) {
+        fclose(json);
+    }
+
+    char *getArgv[] = { "bench_suite", "--reps", "1", "--max-n", "100", "--op", "get" };
+    TEST_CHECK(runSuite(7, getArgv) == EXIT_SUCCESS);
+    TEST_CHECK(resultCount == 3);
+    for (int i = 0; i < resultCount; i++) {
+        TEST_CHECK(results[i].allocsPerOp == 0 && results[i].p99Ns == results[i].medianNs);
+    }
+}
+
+/**
+ * @brief Writes a baseline where every current median is divided by factor.
+ */
+static void writeBaseline(double factor) {
+    FILE *out = fopen(baselinePath, "w");
+    fprintf(out, "op,element_bytes,n,reps,median_ns,p99_ns,allocs_per_op,rss_kb\n");
+    fprintf(out, "not a result\n");
+    fprintf(out, "add,4,999,3,0.001,0.001,0,0\n");        /* no such case: ignored */
+    for (int i = 0; i < resultCount; i++) {
+        const BenchResult *r = &results[i];
+        fprintf(out, "%s,%zu,%zu,%d,%.3f,%.3f,0,0\n", r->op, r->elementSize, r->n, r->reps,
+                r->medianNs / factor, r->p99Ns / factor);
+    }
+    fclose(out);
+}
+
+static void testBaseline(void) {
+    static const BenchResult known[] = {
+        { "add", 4, 100, 3, 10.0, 12.0, 0.04, 0 },
+        { "add", 64, 100, 3, 40.0, 41.0, 0.04, 0 },
+        { "get", 4, 100, 3, 2.0, 2.5, 0.0, 0 },
+    };
+    resultCount = 3;
+    memcpy(results, known, sizeof(known));
+
+    muteStdout();
+    options.threshold = 10.0;
+    writeBaseline(0.5);                         /* twice as fast now */
+    int faster = compareBaseline(baselinePath);
+    writeBaseline(1.05);                        /* 5% slower: within 10% */
+    int within = compareBaseline(baselinePath);
+    writeBaseline(1.25);                        /* 25% slower */
+    int slower = compareBaseline(baselinePath);
+    options.threshold = 1.0;
+    writeBaseline(1.05);
+    int strict = compareBaseline(baselinePath);
+    unmuteStdout();
+    TEST_CHECK(faster == 0 && within == 0 && slower == 3 && strict == 3);
+
+    /* end to end: the exit status follows the comparison */
+    char *argv[] = { "bench_suite", "--reps", "1", "--max-n", "100", "--op", "get",
+                     "--baseline", baselinePath, "--threshold", "10" };
+    FILE *out = fopen(baselinePath, "w");
+    fprintf(out, "get,4,100,1,1000000.000,1000000.000,0,0\n");
+    fclose(out);
+    TEST_CHECK(runSuite(11, argv) == EXIT_SUCCESS);
+    out = fopen(baselinePath, "w");
+    fprintf(out, "get,4,100,1,0.000001,0.000001,0,0\n");
+    fclose(out);
+    TEST_CHECK(runSuite(11, argv) == EXIT_FAILURE);
+}
+
+int main(void) {
+    snprintf(csvPath, sizeof(csvPath), "/tmp/test_bench_%d.csv", (int)getpid());
+    snprintf(jsonPath, sizeof(jsonPath), "/tmp/test_bench_%d.json", (int)getpid());
+    snprintf(baselinePath, sizeof(baselinePath), "/tmp/test_bench_%d_baseline.csv",
+             (int)getpid());
+    testOutputs();
+    testBaseline();
+    remove(csvPath);
+    remove(jsonPath);
+    remove(baselinePath);
+    return testReport("test_bench");
+}
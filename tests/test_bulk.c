@@ -0,0 +1,139 @@
+/**
+ * @file test_bulk.c
+ * @brief Bulk appends and reservations: contents and number of growths.
+ * @author Mark Jayson Lanuzo
+ * @date 2026-10-17
+ *
+ * Appends random batches with listAppendRange, list_ADD_ALL and
+ * list_ARRAY_TO_LIST_N and compares the list with a plain array. A counting
+ * allocator checks that every batch grows the buffer at most once and that a
+ * reserved list does not grow at all.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "test.h"
+#include "../list.h"
+
+#define MAX_COUNT 100000
+
+static int model[MAX_COUNT];
+static int modelCount;
+static size_t growths;
+
+static void *countingAlloc(void *context, size_t size) {
+    (void)context;
+    return malloc(size);
+}
+
+static void *countingRealloc(void *context, void *ptr, size_t oldSize, size_t newSize) {
+    (void)context;
+    (void)oldSize;
+    growths++;
+    return realloc(ptr, newSize);
+}
+
+static void countingFree(void *context, void *ptr, size_t size) {
+    (void)context;
+    (void)size;
+    free(ptr);
+}
+
+static const ListAllocator countingAllocator = {
+    countingAlloc, countingRealloc, countingFree, NULL
+};
+
+static void checkContents(List *list) {
+    TEST_CHECK(list->currentCount == modelCount);
+    TEST_CHECK(memcmp(list->data, model, (size_t)modelCount * sizeof(int)) == 0);
+}
+
+static void testBatches(void) {
+    List list;
+    int batch[1000];
+    list_INIT_WITH_ALLOCATOR(&list, int, LIST_DEFAULT_CAPACITY, &countingAllocator);
+    modelCount = 0;
+    while (!testFailures) {
+        int count = (int)(testRandom() % 1000);
+        if (modelCount + count > MAX_COUNT) {
+            break;
+        }
+        for (int i = 0; i < count; i++) {
+            batch[i] = (int)testRandom();
+        }
+        size_t before = growths;
+        if (count % 2) {
+            listAppendRange(&list, batch, (size_t)count);
+        } else {
+            list_ARRAY_TO_LIST_N(&list, int, batch, count);
+        }
+        TEST_CHECK(growths - before <= 1);
+        memcpy(model + modelCount, batch, (size_t)count * sizeof(int));
+        modelCount += count;
+        checkContents(&list);
+    }
+    list_ADD_ALL(&list, int, 3, 7, 8, 9);
+    model[modelCount++] = 7;
+    model[modelCount++] = 8;
+    model[modelCount++] = 9;
+    checkContents(&list);
+    listFree(&list);
+}
+
+static void testReserve(void) {
+    List list;
+    list_INIT_WITH_ALLOCATOR(&list, int, LIST_DEFAULT_CAPACITY, &countingAllocator);
+    listReserve(&list, MAX_COUNT);
+    TEST_CHECK(list.initSize >= MAX_COUNT);
+    size_t before = growths;
+    for (int i = 0; i < MAX_COUNT; i++) {
+        list_ADD(&list, int, i);
+    }
+    TEST_CHECK(growths == before);
+    listReserve(&list, 10);                 /* never shrinks */
+    TEST_CHECK(list.initSize >= MAX_COUNT && *list_GET(&list, int, MAX_COUNT - 1) == MAX_COUNT - 1);
+    listFree(&list);
+
+    List sized;
+    list_INIT_WITH_CAPACITY(&sized, int, 5000);
+    TEST_CHECK(sized.initSize >= 5000 && sized.currentCount == 0);
+    int values[5000];
+    for (int i = 0; i < 5000; i++) {
+        values[i] = -i;
+    }
+    list_ARRAY_TO_LIST(&sized, int, values);
+    TEST_CHECK(sized.initSize == 5000 && *list_GET(&sized, int, 4999) == -4999);
+    listAppendRange(&sized, values, 0);     /* nothing to add */
+    TEST_CHECK(sized.currentCount == 5000);
+    listFree(&sized);
+}
+
+static void testAppendToRing(void) {
+    List list;
+    int batch[40];
+    list_INIT(&list, int);
+    for (int i = 0; i < 8; i++) {
+        list_ADD(&list, int, i);
+    }
+    list_POP_FRONT(&list, int);
+    list_POP_FRONT(&list, int);
+    list_PUSH_BACK(&list, int, 8);
+    list_PUSH_BACK(&list, int, 9);           /* wraps around the buffer end */
+    for (int i = 0; i < 40; i++) {
+        batch[i] = 10 + i;
+    }
+    listAppendRange(&list, batch, 40);
+    TEST_CHECK(list.currentCount == 48);
+    for (int i = 0; i < 48; i++) {
+        TEST_CHECK(*list_GET(&list, int, i) == i + 2);
+    }
+    listFree(&list);
+}
+
+int main(void) {
+    testBatches();
+    testReserve();
+    testAppendToRing();
+    return testReport("test_bulk");
+}
@@ -0,0 +1,134 @@
+/**
+ * @file test_concurrent.c
+ * @brief Stress test of ListConcurrent: appending threads racing with readers.
+ * @author Mark Jayson Lanuzo
+ * @date 2026-10-17
+ *
+ * Writer threads append the values (thread << 32) | sequence and remember the
+ * index each append returned. Reader threads poll random elements while the
+ * writers run: an element they can get must hold a well-formed value that
+ * never changes, at an address that never changes. Afterwards every value must
+ * be present exactly once, at the index its append returned.
+ */
+
+#include <stdlib.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+#include <pthread.h>
+
+#include "test.h"
+#include "../list.h"
+
+#define WRITERS 8
+#define READERS 2
+#define PER_WRITER 100000
+#define ROUNDS 4
+#define SAMPLES 64
+
+static ListConcurrent list;
+static int indexes[WRITERS][PER_WRITER];
+static int appendsDone;
+
+static void *writer(void *arg) {
+    int64_t thread = (int64_t)(intptr_t)arg;
+    for (int i = 0; i < PER_WRITER; i++) {
+        indexes[thread][i] = list_CONCURRENT_ADD(&list, int64_t, (thread << 32) | i);
+    }
+    return NULL;
+}
+
+static bool wellFormed(int64_t value) {
+    return (value >> 32) >= 0 && (value >> 32) < WRITERS && (value & 0xffffffff) < PER_WRITER;
+}
+
+/**
+ * @brief Polls elements until the writers are done; returns (void *)1 on a failure.
+ */
+static void *reader(void *arg) {
+    uint32_t seed = (uint32_t)(uintptr_t)arg * 2654435761u + 1;
+    int sampled[SAMPLES];
+    int64_t *addresses[SAMPLES];
+    int64_t values[SAMPLES];
+    int count = 0;
+
+    while (!__atomic_load_n(&appendsDone, __ATOMIC_ACQUIRE)) {
+        int length = listConcurrentLength(&list);
+        if (length == 0) {
+            continue;
+        }
+        seed ^= seed << 13;
+        seed ^= seed >> 17;
+        seed ^= seed << 5;
+        int index = (int)(seed % (uint32_t)length);
+        int64_t *element = listConcurrentGet(&list, index);
+        if (element && !wellFormed(*element)) {
+            return (void *)1;
+        }
+        if (element && count < SAMPLES) {
+            sampled[count] = index;
+            addresses[count] = element;
+            values[count] = *element;
+            count++;
+        }
+        for (int i = 0; i < count; i++) {
+            int64_t *again = listConcurrentGet(&list, sampled[i]);
+            if (again != addresses[i] || *again != values[i]) {
+                return (void *)1;
+            }
+        }
+    }
+    return NULL;
+}
+
+static void runRound(void) {
+    pthread_t writers[WRITERS];
+    pthread_t readers[READERS];
+    static unsigned char seen[WRITERS * PER_WRITER];
+
+    list_CONCURRENT_INIT(&list, int64_t);
+    __atomic_store_n(&appendsDone, 0, __ATOMIC_RELEASE);
+    for (int t = 0; t < READERS; t++) {
+        pthread_create(&readers[t], NULL, reader, (void *)(intptr_t)t);
+    }
+    for (int t = 0; t < WRITERS; t++) {
+        pthread_create(&writers[t], NULL, writer, (void *)(intptr_t)t);
+    }
+    for (int t = 0; t < WRITERS; t++) {
+        pthread_join(writers[t], NULL);
+    }
+    __atomic_store_n(&appendsDone, 1, __ATOMIC_RELEASE);
+    for (int t = 0; t < READERS; t++) {
+        void *failed;
+        pthread_join(readers[t], &failed);
+        TEST_CHECK(failed == NULL);
+    }
+
+    TEST_CHECK(listConcurrentLength(&list) == WRITERS * PER_WRITER);
+    memset(seen, 0, sizeof(seen));
+    int bad = 0;
+    list_CONCURRENT_FOR_EACH(&list, int64_t, {
+        if (!element || !wellFormed(*element) ||
+            seen[(*element >> 32) * PER_WRITER + (*element & 0xffffffff)]++) {
+            bad++;
+        }
+    });
+    TEST_CHECK(bad == 0);
+    for (int t = 0; t < WRITERS && bad == 0; t++) {
+        for (int i = 0; i < PER_WRITER; i++) {
+            int64_t *element = list_CONCURRENT_GET(&list, int64_t, indexes[t][i]);
+            if (!element || *element != (((int64_t)t << 32) | i)) {
+                bad++;
+            }
+        }
+    }
+    TEST_CHECK(bad == 0);
+    listConcurrentFree(&list);
+}
+
+int main(void) {
+    for (int round = 0; round < ROUNDS && !testFailures; round++) {
+        runRound();
+    }
+    return testReport("test_concurrent");
+}
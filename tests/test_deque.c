@@ -0,0 +1,137 @@
+/**
+ * @file test_deque.c
+ * @brief Lists used as deques checked against a plain array.
+ * @author Mark Jayson Lanuzo
+ * @date 2026-10-17
+ *
+ * Applies random pushes and pops at both ends, sets, and now and then an
+ * ordered insert or removal, to a list and to an array. The length swings up
+ * and down so the ring wraps around the end of the buffer and grows while
+ * wrapped. list_GET, list_FOR_EACH and list_TO_ARRAY must follow the
+ * wraparound. A FIFO queue of constant length must cycle its head through the
+ * whole buffer without growing it.
+ */
+
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include "test.h"
+#include "../list.h"
+
+#define STEPS 200000
+#define MAX_COUNT 4096
+
+static int model[MAX_COUNT];
+static int modelCount;
+
+static void modelInsert(int position, int value) {
+    memmove(model + position + 1, model + position, (size_t)(modelCount - position) * sizeof(int));
+    model[position] = value;
+    modelCount++;
+}
+
+static void modelRemove(int position) {
+    memmove(model + position, model + position + 1,
+            (size_t)(modelCount - position - 1) * sizeof(int));
+    modelCount--;
+}
+
+static void checkContents(List *list) {
+    TEST_CHECK(list->currentCount == modelCount);
+    for (int i = 0; i < modelCount; i++) {
+        if (*list_GET(list, int, i) != model[i]) {
+            TEST_CHECK(*list_GET(list, int, i) == model[i]);
+            break;
+        }
+    }
+    int visited = 0;
+    bool inOrder = true;
+    list_FOR_EACH(list, int, inOrder = inOrder && *element == model[visited]; visited++);
+    TEST_CHECK(inOrder && visited == modelCount);
+}
+
+static void testAgainstArray(void) {
+    List list;
+    list_INIT(&list, int);
+    modelCount = 0;
+    int wrapped = 0;
+    for (int s = 0; s < STEPS && !testFailures; s++) {
+        /* grow for a while, then shrink for a while */
+        bool growing = (s / 3000) % 2 == 0;
+        int value = (int)testRandom();
+        int operation = (int)(testRandom() % 10);
+        if (modelCount == 0 || (modelCount < MAX_COUNT && operation < (growing ? 5 : 3))) {
+            if (operation % 2) {
+                list_PUSH_FRONT(&list, int, value);
+                modelInsert(0, value);
+            } else {
+                list_PUSH_BACK(&list, int, value);
+                model[modelCount++] = value;
+            }
+        } else if (operation < 8) {
+            if (operation % 2) {
+                TEST_CHECK(list_POP_FRONT(&list, int) == model[0]);
+                modelRemove(0);
+            } else {
+                TEST_CHECK(list_POP_BACK(&list, int) == model[modelCount - 1]);
+                modelCount--;
+            }
+        } else if (operation == 8) {
+            int position = (int)(testRandom() % (uint32_t)modelCount);
+            list_SET(&list, int, position, value);
+            model[position] = value;
+        } else if (s % 50 == 0) {
+            int position = (int)(testRandom() % (uint32_t)modelCount);
+            if (value % 2) {
+                list_ADD_AT(&list, int, value, position);
+                modelInsert(position, value);
+            } else {
+                list_REMOVE_AT(&list, int, position);
+                modelRemove(position);
+            }
+        }
+        wrapped += list.head + list.currentCount > list.initSize;
+        if (s % 500 == 0) {
+            checkContents(&list);
+        }
+        if (s % 5000 == 0) {
+            int *array = list_TO_ARRAY(&list, int);
+            TEST_CHECK(memcmp(array, model, (size_t)modelCount * sizeof(int)) == 0);
+            TEST_CHECK(list.head == 0);         /* linearized */
+            free(array);
+        }
+    }
+    TEST_CHECK(wrapped > STEPS / 10);           /* the interesting case was covered */
+    checkContents(&list);
+    listFree(&list);
+}
+
+static void testQueue(void) {
+    List queue;
+    list_INIT(&queue, int);
+    for (int i = 0; i < 1000; i++) {
+        list_PUSH_BACK(&queue, int, i);
+    }
+    int capacity = queue.initSize;
+    int next = 0;
+    bool inOrder = true;
+    for (int i = 1000; i < 1000000; i++) {
+        inOrder = inOrder && list_POP_FRONT(&queue, int) == next++;
+        list_PUSH_BACK(&queue, int, i);
+    }
+    TEST_CHECK(inOrder && queue.initSize == capacity && queue.currentCount == 1000);
+    TEST_CHECK(*list_GET(&queue, int, 999) == 999999);
+    while (queue.currentCount > 0) {
+        list_POP_BACK(&queue, int);
+    }
+    TEST_CHECK(queue.head == 0);
+    TEST_CHECK(list_POP_FRONT(&queue, int) == 0 && list_POP_BACK(&queue, int) == 0);
+    listFree(&queue);
+}
+
+int main(void) {
+    testAgainstArray();
+    testQueue();
+    return testReport("test_deque");
+}
@@ -0,0 +1,72 @@
+/**
+ * @file test_equals.c
+ * @brief Lookups on a List and on views of it agree under a registered equality.
+ * @author Mark Jayson Lanuzo
+ * @date 2026-10-17
+ *
+ * Persons compare by the text of their name and by age, so a probe whose name
+ * is another copy of the string, with different padding bytes, is equal to
+ * the stored element without being bytewise equal. The list, a view over it,
+ * a strided slice and a slice of the slice must all find it.
+ */
+
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include "test.h"
+#include "../list.h"
+
+typedef struct {
+    char *name;
+    char initial;
+    int age;
+} Person;
+
+list_DEFINE_TYPE_OPS(Person, STRING(name), VALUE(age))
+
+static const char *const names[] = {"Alice", "Bob", "Charlie", "Dana", "Eve", "Frank"};
+
+int main(void) {
+    List people;
+    char copy[16];
+    list_REGISTER_TYPE(Person);
+    list_INIT(&people, Person);
+    for (int i = 0; i < 60; i++) {
+        Person person;
+        memset(&person, 0, sizeof(person));
+        person.name = (char *)names[i % 6];
+        person.initial = names[i % 6][0];
+        person.age = i;
+        list_ADD(&people, Person, person);
+    }
+
+    Person probe;
+    memset(&probe, 0xAB, sizeof(probe)); /* garbage in the padding and in initial */
+    strcpy(copy, "Eve");
+    probe.name = copy;
+    probe.age = 40;
+
+    ListView all = listAsView(&people);
+    ListView even = listSliceStep(&people, 0, 30, 2);
+    ListView tail = listViewSlice(&even, 10, 20);
+    TEST_CHECK(list_GET_INDEX_OF(&people, Person, probe) == 40);
+    TEST_CHECK(list_GET_INDEX_OF(&all, Person, probe) == 40);
+    TEST_CHECK(list_GET_INDEX_OF(&even, Person, probe) == 20);
+    TEST_CHECK(list_GET_INDEX_OF(&tail, Person, probe) == 10);
+    TEST_CHECK(list_CONTAINS(&all, Person, probe) && list_CONTAINS(&tail, Person, probe));
+
+    probe.age = 41; /* Eve is never 41 */
+    TEST_CHECK(list_GET_INDEX_OF(&people, Person, probe) == -1);
+    TEST_CHECK(!list_CONTAINS(&all, Person, probe));
+    TEST_CHECK(!list_CONTAINS(&even, Person, probe));
+
+    probe.age = 4;
+    TEST_CHECK(listViewCountEqual(&all, &probe) == 1);
+    ListView bytewise = listSlice(&people, 0, 60);
+    bytewise.equals = NULL; /* bytewise: the padding differs */
+    TEST_CHECK(listViewFindFirst(&bytewise, &probe) == -1);
+
+    listFree(&people);
+    return testReport("test_equals");
+}
@@ -0,0 +1,212 @@
+/**
+ * @file test_growth.c
+ * @brief Growth policies, shrink-to-fit and automatic shrinking.
+ * @author Mark Jayson Lanuzo
+ * @date 2026-10-17
+ *
+ * Adds elements one at a time under each growth policy and checks every
+ * capacity step against the policy, and that listSizeOf and listSizeOfData
+ * follow. Drains lists, wrapped and not, and checks that listShrinkToFit
+ * keeps the contents in a buffer of exactly their size. With auto shrink,
+ * random removals must never leave a large buffer below 1/4 full, and adds
+ * and removals alternating just after a shrink must not reallocate.
+ */
+
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include "test.h"
+#include "../list.h"
+
+#define COUNT 100000
+
+static size_t resizes;
+
+static void *countingAlloc(void *context, size_t size) {
+    (void)context;
+    return malloc(size);
+}
+
+static void *countingRealloc(void *context, void *ptr, size_t oldSize, size_t newSize) {
+    (void)context;
+    (void)oldSize;
+    resizes++;
+    return realloc(ptr, newSize);
+}
+
+static void countingFree(void *context, void *ptr, size_t size) {
+    (void)context;
+    (void)size;
+    free(ptr);
+}
+
+static const ListAllocator countingAllocator = {
+    countingAlloc, countingRealloc, countingFree, NULL
+};
+
+/**
+ * @brief Returns the capacity the policy grows a full buffer of capacity to.
+ */
+static size_t nextCapacity(ListGrowthPolicy policy, size_t step, size_t capacity) {
+    switch (policy) {
+    case LIST_GROW_LINEAR:
+        return capacity + (step > 0 ? step : LIST_DEFAULT_CAPACITY);
+    case LIST_GROW_HALF:
+        return capacity + capacity / 2 + 1;
+    default:
+        return capacity * 2;
+    }
+}
+
+static void testPolicy(ListGrowthPolicy policy, size_t step) {
+    List list;
+    list_INIT_WITH_ALLOCATOR(&list, int, LIST_DEFAULT_CAPACITY, &countingAllocator);
+    listSetGrowthPolicy(&list, policy, step);
+    size_t capacity = (size_t)list.initSize;
+    size_t growths = 0;
+    resizes = 0;
+    for (int i = 0; i < COUNT && !testFailures; i++) {
+        list_ADD(&list, int, i);
+        if ((size_t)list.initSize != capacity) {
+            TEST_CHECK((size_t)list.initSize == nextCapacity(policy, step, capacity));
+            TEST_CHECK((size_t)i == capacity);     /* grown only when full */
+            capacity = (size_t)list.initSize;
+            growths++;
+        }
+        TEST_CHECK(listSizeOf(&list) == capacity * sizeof(int));
+        TEST_CHECK(listSizeOfData(&list) == (size_t)(i + 1) * sizeof(int));
+    }
+    TEST_CHECK(resizes == growths);
+    for (int i = 0; i < COUNT; i++) {
+        TEST_CHECK(*list_GET(&list, int, i) == i);
+    }
+    listFree(&list);
+}
+
+static void testShrinkToFit(bool wrapped) {
+    List list;
+    list_INIT(&list, int);
+    for (int i = 0; i < 10000; i++) {
+        list_ADD(&list, int, i);
+    }
+    int first = 0;
+    for (int i = 0; i < 9000; i++) {
+        if (wrapped && i % 2 == 0) {
+            list_POP_FRONT(&list, int);
+            first++;
+        } else {
+            list_POP_BACK(&list, int);
+        }
+    }
+    if (wrapped) {
+        for (int i = 0; i < 100; i++) {         /* the head is past 0: these wrap */
+            list_PUSH_FRONT(&list, int, --first);
+        }
+    }
+    int count = list.currentCount;
+    TEST_CHECK(listSizeOf(&list) >= 10000 * sizeof(int));
+    listShrinkToFit(&list);
+    TEST_CHECK(list.initSize == count);
+    TEST_CHECK(listSizeOf(&list) == (size_t)count * sizeof(int));
+    TEST_CHECK(listSizeOfData(&list) == (size_t)count * sizeof(int));
+    for (int i = 0; i < count; i++) {
+        TEST_CHECK(*list_GET(&list, int, i) == first + i);
+    }
+    list_ADD(&list, int, 12345);                /* a full buffer still grows */
+    TEST_CHECK(*list_GET(&list, int, count) == 12345);
+
+    while (list.currentCount > 0) {
+        list_POP_BACK(&list, int);
+    }
+    listShrinkToFit(&list);
+    TEST_CHECK(list.initSize == 1 && list.currentCount == 0);
+    list_ADD(&list, int, 7);
+    TEST_CHECK(*list_GET(&list, int, 0) == 7);
+    listFree(&list);
+}
+
+static void testAutoShrink(void) {
+    List list;
+    static int model[COUNT];
+    int modelCount = 0;
+    list_INIT_WITH_ALLOCATOR(&list, int, LIST_DEFAULT_CAPACITY, &countingAllocator);
+    for (int i = 0; i < COUNT; i++) {
+        list_ADD(&list, int, i);
+        model[modelCount++] = i;
+    }
+    listSetAutoShrink(&list, true);
+    while (modelCount > 0 && !testFailures) {
+        int position = (int)(testRandom() % (uint32_t)modelCount);
+        switch (testRandom() % 4) {
+        case 0:
+            list_REMOVE_AT(&list, int, position);
+            memmove(model + position, model + position + 1,
+                    (size_t)(modelCount - position - 1) * sizeof(int));
+            modelCount--;
+            break;
+        case 1:
+            list_SWAP_REMOVE_AT(&list, int, position);
+            model[position] = model[--modelCount];
+            break;
+        case 2: {
+            int divisor = (int)(testRandom() % 50) + 2;
+            int kept = 0;
+            for (int i = 0; i < modelCount; i++) {
+                if (model[i] % divisor != 0) {
+                    model[kept++] = model[i];
+                }
+            }
+            list_REMOVE_IF(&list, int, *element % divisor == 0);
+            modelCount = kept;
+            break;
+        }
+        default:
+            TEST_CHECK(list_POP_BACK(&list, int) == model[modelCount - 1]);
+            modelCount--;
+            break;
+        }
+        TEST_CHECK(list.currentCount == modelCount);
+        TEST_CHECK(list.initSize <= LIST_DEFAULT_CAPACITY || modelCount * 4 >= list.initSize);
+    }
+    TEST_CHECK(list.initSize == LIST_DEFAULT_CAPACITY);
+
+    /* right after a shrink the buffer is half full: no reallocation either way */
+    for (int i = 0; i < 1000; i++) {
+        list_ADD(&list, int, i);
+    }
+    while (list.currentCount * 4 >= list.initSize) {
+        list_POP_BACK(&list, int);
+    }
+    int capacity = list.initSize;
+    resizes = 0;
+    for (int i = 0; i < 10000; i++) {
+        list_ADD(&list, int, i);
+        list_POP_BACK(&list, int);
+    }
+    TEST_CHECK(resizes == 0 && list.initSize == capacity);
+    listFree(&list);
+
+    List drained;
+    list_INIT(&drained, int);
+    for (int i = 0; i < 1000; i++) {
+        list_ADD(&drained, int, i);
+    }
+    while (drained.currentCount > 10) {
+        list_POP_BACK(&drained, int);
+    }
+    listSetAutoShrink(&drained, true);          /* shrinks right away */
+    TEST_CHECK(drained.initSize == 20 && *list_GET(&drained, int, 9) == 9);
+    listFree(&drained);
+}
+
+int main(void) {
+    testPolicy(LIST_GROW_DOUBLE, 0);
+    testPolicy(LIST_GROW_HALF, 0);
+    testPolicy(LIST_GROW_LINEAR, 0);
+    testPolicy(LIST_GROW_LINEAR, 1000);
+    testShrinkToFit(false);
+    testShrinkToFit(true);
+    testAutoShrink();
+    return testReport("test_growth");
+}
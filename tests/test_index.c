@@ -0,0 +1,166 @@
+/**
+ * @file test_index.c
+ * @brief Randomized check of the hash index against a linear scan.
+ * @author Mark Jayson Lanuzo
+ * @date 2026-10-17
+ *
+ * Applies random adds, inserts, removals, sets and front/back pushes and pops
+ * to a list with an index and to a plain array. After every step, lookups of
+ * a few values through the index must return the lowest position a linear
+ * scan of the array finds. Values are drawn from a small range, so the list
+ * holds many duplicates; a second run draws from only three values. Finally a
+ * list of 200000 copies of four values is used as a queue, which stays fast
+ * only if duplicates share one index entry.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "test.h"
+#include "../list.h"
+
+#define STEPS 20000
+#define VALUES 64
+#define MAX_COUNT 4096
+#define QUEUE_COUNT 200000
+
+static int model[MAX_COUNT];
+static int modelCount;
+
+static int modelIndexOf(int value) {
+    for (int i = 0; i < modelCount; i++) {
+        if (model[i] == value) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+static void modelInsert(int position, int value) {
+    memmove(model + position + 1, model + position, (size_t)(modelCount - position) * sizeof(int));
+    model[position] = value;
+    modelCount++;
+}
+
+static void modelRemove(int position) {
+    memmove(model + position, model + position + 1,
+            (size_t)(modelCount - position - 1) * sizeof(int));
+    modelCount--;
+}
+
+/**
+ * @brief Applies one random operation to the list and to the model.
+ */
+static void step(List *list, int values) {
+    int value = (int)(testRandom() % (uint32_t)values);
+    int position = modelCount ? (int)(testRandom() % (uint32_t)modelCount) : 0;
+    int operation = (int)(testRandom() % 12);
+    if (modelCount == 0 || (operation < 4 && modelCount < MAX_COUNT)) {
+        list_ADD(list, int, value);
+        model[modelCount++] = value;
+        return;
+    }
+    if (modelCount == MAX_COUNT && operation < 6) {
+        operation = 6; /* full: remove instead of inserting */
+    }
+    switch (operation) {
+    case 4:
+        list_ADD_AT(list, int, value, position);
+        modelInsert(position, value);
+        break;
+    case 5:
+        list_PUSH_FRONT(list, int, value);
+        modelInsert(0, value);
+        break;
+    case 6:
+        TEST_CHECK(list_POP_FRONT(list, int) == model[0]);
+        modelRemove(0);
+        break;
+    case 7:
+        TEST_CHECK(list_POP_BACK(list, int) == model[modelCount - 1]);
+        modelCount--;
+        break;
+    case 8:
+        list_REMOVE_AT(list, int, position);
+        modelRemove(position);
+        break;
+    case 9:
+        list_SWAP_REMOVE_AT(list, int, position);
+        model[position] = model[modelCount - 1];
+        modelCount--;
+        break;
+    default:
+        if (modelIndexOf(value) != -1) {
+            list_REMOVE(list, int, value);
+            modelRemove(modelIndexOf(value));
+        } else {
+            list_SET(list, int, position, value);
+            model[position] = value;
+        }
+        break;
+    }
+}
+
+static void checkLookups(List *list, int values) {
+    for (int k = 0; k < 4; k++) {
+        int value = (int)(testRandom() % (uint32_t)(values + 8));
+        TEST_CHECK(list_GET_INDEX_OF(list, int, value) == modelIndexOf(value));
+        TEST_CHECK(list_CONTAINS(list, int, value) == (modelIndexOf(value) != -1));
+    }
+}
+
+static void checkContents(List *list) {
+    TEST_CHECK(list->currentCount == modelCount);
+    for (int i = 0; i < modelCount && i < list->currentCount; i++) {
+        TEST_CHECK(*list_GET(list, int, i) == model[i]);
+    }
+}
+
+static void runRandom(int values) {
+    List list;
+    list_INIT(&list, int);
+    listEnableIndex(&list, NULL, NULL);
+    modelCount = 0;
+    for (int i = 0; i < STEPS && !testFailures; i++) {
+        step(&list, values);
+        checkLookups(&list, values);
+        if (i % 500 == 0) {
+            checkContents(&list);
+        }
+        if (i == STEPS / 2) {
+            listEnableIndex(&list, NULL, NULL); /* rebuilt from the current contents */
+        }
+    }
+    checkContents(&list);
+    listFree(&list);
+}
+
+/**
+ * @brief Rotates a queue of many duplicates; each lookup must stay O(1).
+ */
+static void runQueue(void) {
+    List list;
+    list_INIT(&list, int);
+    listEnableIndex(&list, NULL, NULL);
+    for (int i = 0; i < QUEUE_COUNT; i++) {
+        list_ADD(&list, int, i % 4);
+    }
+    for (int i = 0; i < QUEUE_COUNT && !testFailures; i++) {
+        int front = list_POP_FRONT(&list, int);
+        TEST_CHECK(front == i % 4);
+        list_ADD(&list, int, front);
+        TEST_CHECK(list_GET_INDEX_OF(&list, int, (i + 1) % 4) == 0);
+        TEST_CHECK(list_GET_INDEX_OF(&list, int, front) == 3);
+        TEST_CHECK(!list_CONTAINS(&list, int, 4));
+    }
+    list_REMOVE(&list, int, 2);
+    TEST_CHECK(list_GET_INDEX_OF(&list, int, 2) == 5);
+    listFree(&list);
+}
+
+int main(void) {
+    runRandom(VALUES);
+    runRandom(3);
+    runQueue();
+    return testReport("test_index");
+}
@@ -0,0 +1,93 @@
+/**
+ * @file test_inline.c
+ * @brief Lists copied by value by default, and the opt-in inline buffer.
+ * @author Mark Jayson Lanuzo
+ * @date 2026-10-17
+ *
+ * Built twice by the Makefile. With the default LIST_INLINE_BYTES of 0, a List
+ * returned from a function and Lists stored by value in another List must keep
+ * working after the original struct is gone. With -DLIST_INLINE_BYTES=64,
+ * small lists must start inline, spill to the heap as they grow and move back
+ * on listShrinkToFit.
+ */
+
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include "test.h"
+#include "../list.h"
+
+#if LIST_INLINE_BYTES == 0
+/**
+ * @brief Returns a list of count ints by value; its struct dies with the frame.
+ */
+static List makeNumbers(int count) {
+    List numbers;
+    list_INIT(&numbers, int);
+    for (int i = 0; i < count; i++) {
+        list_ADD(&numbers, int, i * 3);
+    }
+    return numbers;
+}
+
+/**
+ * @brief Overwrites the stack the returned list was built in.
+ */
+static void clobberStack(void) {
+    volatile char junk[4096];
+    memset((char *)junk, 0x5A, sizeof(junk));
+}
+
+static void testCopyByValue(void) {
+    List numbers = makeNumbers(5);
+    clobberStack();
+    for (int i = 0; i < 5; i++) {
+        TEST_CHECK(*list_GET(&numbers, int, i) == i * 3);
+    }
+
+    List rows;
+    list_INIT(&rows, List);
+    for (int r = 0; r < 40; r++) { /* the outer list grows and moves its elements */
+        List row = makeNumbers(r % 4 + 1);
+        list_ADD(&rows, List, row);
+    }
+    for (int r = 0; r < 40; r++) {
+        List *row = list_GET(&rows, List, r);
+        TEST_CHECK(row->currentCount == r % 4 + 1);
+        TEST_CHECK(*list_GET(row, int, row->currentCount - 1) == (r % 4) * 3);
+        listFree(row);
+    }
+    listFree(&rows);
+    listFree(&numbers);
+}
+
+#else
+static void testInlineBuffer(void) {
+    List grades;
+    list_INIT(&grades, int);
+    TEST_CHECK(listIsInline(&grades));
+    TEST_CHECK(grades.initSize == LIST_INLINE_BYTES / (int)sizeof(int));
+    for (int i = 0; i < 100; i++) {
+        list_ADD(&grades, int, i);
+    }
+    TEST_CHECK(!listIsInline(&grades));
+    while (grades.currentCount > 3) {
+        list_POP_BACK(&grades, int);
+    }
+    listShrinkToFit(&grades);
+    TEST_CHECK(listIsInline(&grades));
+    TEST_CHECK(*list_GET(&grades, int, 2) == 2);
+    listFree(&grades);
+}
+#endif
+
+int main(void) {
+#if LIST_INLINE_BYTES == 0
+    testCopyByValue();
+    return testReport("test_inline");
+#else
+    testInlineBuffer();
+    return testReport("test_inline (64 B)");
+#endif
+}
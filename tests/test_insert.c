@@ -0,0 +1,371 @@
+/**
+ * @file test_insert.c
+ * @brief Batched inserts and sorted merges checked against plain arrays.
+ * @author Mark Jayson Lanuzo
+ * @date 2026-10-17
+ *
+ * Inserts random batches into lists of random length, some wrapped around
+ * their buffer and some with a hash index, with positions that are sorted or
+ * not and often repeated, and compares the result with an array built from a
+ * stable sort of the positions. A batch with one position past the end must
+ * leave the list untouched. listMergeSorted is compared with a radix sort of
+ * both lists together for every primitive type, negative numbers, -0.0,
+ * infinities and NaNs included, and list_MERGE_SORTED with a stable merge of
+ * structs with equal keys.
+ */
+
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+#include <math.h>
+#include <unistd.h>
+#include <fcntl.h>
+
+#include "test.h"
+#include "../list.h"
+
+#define ROUNDS 400
+#define MAX_COUNT 2000
+#define MAX_BATCH 300
+
+typedef struct {
+    int key;
+    int id;
+    int tag;
+} Entry;
+
+static int original[MAX_COUNT];
+static int expected[MAX_COUNT + MAX_BATCH];
+static size_t indices[MAX_BATCH];
+static int elems[MAX_BATCH];
+
+/**
+ * @brief Runs an insert that should be rejected with its message sent to /dev/null.
+ */
+static void insertQuietly(List *list, const size_t *positions, const void *values, size_t k) {
+    fflush(stdout);
+    int saved = dup(STDOUT_FILENO);
+    int null = open("/dev/null", O_WRONLY);
+    dup2(null, STDOUT_FILENO);
+    close(null);
+    listInsertBatch(list, positions, values, k);
+    fflush(stdout);
+    dup2(saved, STDOUT_FILENO);
+    close(saved);
+}
+
+/**
+ * @brief Builds the expected list: before each original element, the new
+ *        elements aimed at its position, in the order they were given.
+ */
+static int buildExpected(int count, size_t k) {
+    int length = 0;
+    for (int position = 0; position <= count; position++) {
+        for (size_t j = 0; j < k; j++) {
+            if (indices[j] == (size_t)position) {
+                expected[length++] = elems[j];
+            }
+        }
+        if (position < count) {
+            expected[length++] = original[position];
+        }
+    }
+    return length;
+}
+
+static void checkContents(List *list, const int *values, int count) {
+    TEST_CHECK(list->currentCount == count);
+    for (int i = 0; i < count && i < list->currentCount; i++) {
+        if (*(int *)listAt(list, i) != values[i]) {
+            TEST_CHECK(*(int *)listAt(list, i) == values[i]);
+            break;
+        }
+    }
+}
+
+static void testInsertBatch(void) {
+    for (int round = 0; round < ROUNDS && !testFailures; round++) {
+        List list;
+        list_INIT(&list, int);
+        int count = (int)(testRandom() % MAX_COUNT);
+        for (int i = 0; i < count; i++) {
+            original[i] = (int)(testRandom() % 1000);
+            list_ADD(&list, int, original[i]);
+        }
+        if (round % 3 == 1 && count > 0) {      /* wrap the ring */
+            int turns = (int)(testRandom() % (uint32_t)count);
+            for (int i = 0; i < turns; i++) {
+                list_PUSH_FRONT(&list, int, list_POP_BACK(&list, int));
+            }
+            for (int i = 0; i < count; i++) {
+                original[i] = *(int *)listAt(&list, i);
+            }
+        }
+        if (round % 4 == 2) {
+            listEnableIndex(&list, NULL, NULL);
+        }
+
+        size_t k = testRandom() % MAX_BATCH;
+        /* few distinct positions, so many of them repeat */
+        uint32_t spread = round % 2 ? (uint32_t)count + 1 : (uint32_t)(testRandom() % 8) + 1;
+        for (size_t j = 0; j < k; j++) {
+            indices[j] = (testRandom() % spread) * (size_t)(count + 1) / spread;
+            elems[j] = 1000 + (int)j;           /* unique, so order mistakes show */
+        }
+        if (round % 5 == 0) {                   /* already sorted: the path without qsort */
+            for (size_t j = 1; j < k; j++) {
+                for (size_t m = j; m > 0 && indices[m - 1] > indices[m]; m--) {
+                    size_t swap = indices[m];
+                    indices[m] = indices[m - 1];
+                    indices[m - 1] = swap;
+                }
+            }
+        }
+
+        int length = buildExpected(count, k);
+        listInsertBatch(&list, indices, elems, k);
+        checkContents(&list, expected, length);
+        if (k > 0) {
+            size_t j = testRandom() % k;
+            int first = 0;
+            while (expected[first] != elems[j]) {
+                first++;
+            }
+            TEST_CHECK(list_GET_INDEX_OF(&list, int, elems[j]) == first);
+        }
+        if (count > 0) {
+            int value = original[testRandom() % (uint32_t)count];
+            int first = 0;
+            while (expected[first] != value) {
+                first++;
+            }
+            TEST_CHECK(list_GET_INDEX_OF(&list, int, value) == first);
+        }
+        listFree(&list);
+    }
+}
+
+static void testInsertEdges(void) {
+    List list;
+    list_INIT(&list, int);
+    for (int i = 0; i < 10; i++) {
+        list_ADD(&list, int, i);
+        original[i] = i;
+    }
+    void *data = list.data;
+    size_t bad[] = { 3, 11, 0 };                /* 11 is past the end of 10 elements */
+    int values[] = { -1, -2, -3 };
+    insertQuietly(&list, bad, values, 3);
+    checkContents(&list, original, 10);
+    TEST_CHECK(list.data == data);              /* not even grown */
+    size_t huge[] = { (size_t)-1 };
+    insertQuietly(&list, huge, values, 1);
+    checkContents(&list, original, 10);
+    listInsertBatch(&list, NULL, NULL, 0);
+    checkContents(&list, original, 10);
+
+    size_t ends[] = { 10, 0, 10, 0 };           /* both ends, repeated */
+    int batch[] = { -5, -4, -6, -3 };
+    listInsertBatch(&list, ends, batch, 4);
+    int want[] = { -4, -3, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, -5, -6 };
+    checkContents(&list, want, 14);
+    listFree(&list);
+
+    List entries;
+    list_INIT(&entries, Entry);
+    Entry row = { 5, 0, 7 };
+    list_ADD(&entries, Entry, row);
+    Entry rows[] = { { 1, 1, 1 }, { 2, 2, 2 }, { 3, 3, 3 } };
+    size_t at[] = { 1, 0, 1 };
+    listInsertBatch(&entries, at, rows, 3);
+    int ids[] = { 2, 0, 1, 3 };
+    TEST_CHECK(entries.currentCount == 4);
+    for (int i = 0; i < 4 && i < entries.currentCount; i++) {
+        Entry *entry = list_GET(&entries, Entry, i);
+        TEST_CHECK(entry->id == ids[i] && entry->key == (ids[i] ? ids[i] : 5));
+        TEST_CHECK(entry->tag == (ids[i] ? ids[i] : 7));
+    }
+    listFree(&entries);
+}
+
+/**
+ * @brief Draws a value of a primitive type, often negative or special.
+ */
+#define DRAW(dataType, specials) ({                                                 \
+    dataType drawn = (dataType)((int)(testRandom() % 200) - 100);                   \
+    if (testRandom() % 8 == 0) {                                                    \
+        drawn = specials[testRandom() % (sizeof(specials) / sizeof(specials[0]))];  \
+    }                                                                               \
+    drawn;                                                                          \
+})
+
+/**
+ * @brief Defines checkMerge_name: merges two radix-sorted lists of T, one of them
+ *        wrapped, and compares the bits with a radix sort of both together.
+ */
+#define DEFINE_MERGE_CHECK(name, dataType, specials)                                \
+static void checkMerge_##name(void) {                                               \
+    for (int round = 0; round < 50; round++) {                                      \
+        List left, right, all;                                                      \
+        list_INIT(&left, dataType);                                                 \
+        list_INIT(&right, dataType);                                                \
+        list_INIT(&all, dataType);                                                  \
+        int leftCount = (int)(testRandom() % 500);                                  \
+        int rightCount = round % 10 == 0 ? 0 : (int)(testRandom() % 500);           \
+        for (int i = 0; i < leftCount + rightCount; i++) {                          \
+            dataType value = DRAW(dataType, specials);                              \
+            if (i < leftCount) {                                                    \
+                list_ADD(&left, dataType, value);                                   \
+            } else {                                                                \
+                list_ADD(&right, dataType, value);                                  \
+            }                                                                       \
+            list_ADD(&all, dataType, value);                                        \
+        }                                                                           \
+        TEST_CHECK(listSort(&left) && listSort(&right) && listSort(&all));          \
+        /* refill right so that it wraps around its buffer, still in order */       \
+        dataType *sortedRight = list_TO_ARRAY(&right, dataType);                    \
+        while (right.currentCount > 0) {                                            \
+            list_POP_BACK(&right, dataType);                                        \
+        }                                                                           \
+        for (int i = rightCount / 3; i < rightCount; i++) {                         \
+            list_PUSH_BACK(&right, dataType, sortedRight[i]);                       \
+        }                                                                           \
+        for (int i = rightCount / 3 - 1; i >= 0; i--) {                             \
+            list_PUSH_FRONT(&right, dataType, sortedRight[i]);                      \
+        }                                                                           \
+        TEST_CHECK(rightCount < 3 || right.head + rightCount > right.initSize);     \
+        free(sortedRight);                                                          \
+        right.sorted = round % 2 == 0;                                              \
+        TEST_CHECK(listMergeSorted(&left, &right));                                 \
+        TEST_CHECK(left.currentCount == all.currentCount);                          \
+        TEST_CHECK(right.currentCount == rightCount);                               \
+        TEST_CHECK(memcmp(left.data, all.data,                                      \
+                          (size_t)all.currentCount * sizeof(dataType)) == 0);       \
+        TEST_CHECK(left.sorted == (round % 2 == 0));                                \
+        if (leftCount + rightCount > 0) {                                           \
+            int middle = (leftCount + rightCount) / 2;                              \
+            dataType probe = *(dataType *)listAt(&all, middle);                     \
+            int first = 0;                                                          \
+            while (memcmp(listAt(&all, first), &probe, sizeof(dataType)) != 0) {    \
+                first++;                                                            \
+            }                                                                       \
+            /* the first bitwise copy, or an earlier -0.0 equal to 0.0 */           \
+            int found = list_GET_INDEX_OF(&left, dataType, probe);                  \
+            TEST_CHECK(isnan((double)probe) || (found >= 0 && found <= first &&     \
+                       *(dataType *)listAt(&left, found) == probe));                \
+        }                                                                           \
+        listFree(&left);                                                            \
+        listFree(&right);                                                           \
+        listFree(&all);                                                             \
+    }                                                                               \
+}
+
+static const int intSpecials[] = { 2147483647, -2147483647 - 1, 0, -1 };
+static const unsigned int uintSpecials[] = { 0xFFFFFFFFu, 0x80000000u, 0 };
+static const long long llongSpecials[] = { 9223372036854775807LL, -9223372036854775807LL - 1, -1 };
+static const unsigned long long ullongSpecials[] = { ~0ULL, 1ULL << 63, 0 };
+static const float floatSpecials[] = { 0.0f, -0.0f, INFINITY, -INFINITY, NAN, -NAN, 0.5f };
+static const double doubleSpecials[] = { 0.0, -0.0, INFINITY, -INFINITY, NAN, -NAN, -1e300 };
+
+DEFINE_MERGE_CHECK(int, int, intSpecials)
+DEFINE_MERGE_CHECK(uint, unsigned int, uintSpecials)
+DEFINE_MERGE_CHECK(llong, long long, llongSpecials)
+DEFINE_MERGE_CHECK(ullong, unsigned long long, ullongSpecials)
+DEFINE_MERGE_CHECK(float, float, floatSpecials)
+DEFINE_MERGE_CHECK(double, double, doubleSpecials)
+
+static void testMergeSorted(void) {
+    checkMerge_int();
+    checkMerge_uint();
+    checkMerge_llong();
+    checkMerge_ullong();
+    checkMerge_float();
+    checkMerge_double();
+
+    List ints, floats, entries;
+    list_INIT(&ints, int);
+    list_INIT(&floats, float);
+    list_INIT(&entries, Entry);
+    list_ADD(&ints, int, 1);
+    float half = 0.5f;
+    list_ADD(&floats, float, half);
+    TEST_CHECK(!listMergeSorted(&ints, &floats));           /* different types */
+    TEST_CHECK(!listMergeSorted(&entries, &entries));       /* no natural order */
+    TEST_CHECK(ints.currentCount == 1 && floats.currentCount == 1);
+    listFree(&ints);
+    listFree(&floats);
+    listFree(&entries);
+}
+
+static int compareEntries(const void *left, const void *right) {
+    const Entry *a = left;
+    const Entry *b = right;
+    return (a->key > b->key) - (a->key < b->key);
+}
+
+static void testMergeStructs(void) {
+    static Entry merged[2 * MAX_COUNT];
+    for (int round = 0; round < 100 && !testFailures; round++) {
+        List left, right;
+        list_INIT(&left, Entry);
+        list_INIT(&right, Entry);
+        int leftCount = (int)(testRandom() % MAX_COUNT);
+        int rightCount = (int)(testRandom() % MAX_COUNT);
+        Entry *a = malloc(((size_t)leftCount + 1) * sizeof(Entry));
+        Entry *b = malloc(((size_t)rightCount + 1) * sizeof(Entry));
+        for (int i = 0; i < leftCount; i++) {
+            a[i] = (Entry){ (int)(testRandom() % 50) - 25, i, 0 };
+        }
+        for (int i = 0; i < rightCount; i++) {
+            b[i] = (Entry){ (int)(testRandom() % 50) - 25, i, 1 };
+        }
+        qsort(a, (size_t)leftCount, sizeof(Entry), compareEntries);
+        qsort(b, (size_t)rightCount, sizeof(Entry), compareEntries);
+        for (int i = 0; i < leftCount; i++) {
+            list_ADD(&left, Entry, a[i]);
+        }
+        for (int i = 0; i < rightCount; i++) {
+            list_ADD(&right, Entry, b[i]);
+        }
+        if (round % 3 == 0) {
+            listEnableIndex(&left, NULL, NULL);
+        }
+
+        /* equal keys: the elements of left first */
+        int i = 0, j = 0, out = 0;
+        while (i < leftCount || j < rightCount) {
+            merged[out++] = j == rightCount || (i < leftCount && a[i].key <= b[j].key) ? a[i++]
+                                                                                    : b[j++];
+        }
+        list_MERGE_SORTED(&left, &right, Entry, a->key < b->key);
+        TEST_CHECK(left.currentCount == out && right.currentCount == rightCount);
+        for (int m = 0; m < out && m < left.currentCount; m++) {
+            Entry *entry = list_GET(&left, Entry, m);
+            if (entry->key != merged[m].key || entry->id != merged[m].id ||
+                entry->tag != merged[m].tag) {
+                TEST_CHECK(memcmp(entry, &merged[m], sizeof(Entry)) == 0);
+                break;
+            }
+        }
+        if (out > 0) {
+            Entry probe = merged[testRandom() % (uint32_t)out];
+            int first = 0;
+            while (memcmp(&merged[first], &probe, sizeof(Entry)) != 0) {
+                first++;
+            }
+            TEST_CHECK(list_GET_INDEX_OF(&left, Entry, probe) == first);
+        }
+        free(a);
+        free(b);
+        listFree(&left);
+        listFree(&right);
+    }
+}
+
+int main(void) {
+    testInsertBatch();
+    testInsertEdges();
+    testMergeSorted();
+    testMergeStructs();
+    return testReport("test_insert");
+}
@@ -0,0 +1,156 @@
+/**
+ * @file test_mmap.c
+ * @brief listSave / list_OPEN_MAPPED round trips and rejected files.
+ * @author Mark Jayson Lanuzo
+ * @date 2026-10-17
+ *
+ * Saves lists and opens them again, then checks that truncated files, files
+ * of another element size or data type and corrupted payloads are rejected,
+ * and that an empty saved list can grow after opening.
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include "test.h"
+#include "../list.h"
+
+#define PATH "test_mmap.bin"
+
+typedef struct {
+    int id;
+    double score;
+    char tag[8];
+} Record;
+
+typedef struct {
+    char payload[8000];
+} Large;
+
+/**
+ * @brief Keeps the first size bytes of a file.
+ */
+static void truncateFile(const char *path, long size) {
+    FILE *file = fopen(path, "rb");
+    char *bytes = malloc((size_t)size);
+    TEST_CHECK(file && bytes && fread(bytes, 1, (size_t)size, file) == (size_t)size);
+    fclose(file);
+    file = fopen(path, "wb");
+    fwrite(bytes, 1, (size_t)size, file);
+    fclose(file);
+    free(bytes);
+}
+
+/**
+ * @brief Flips the bits of the byte at offset.
+ */
+static void corruptByte(const char *path, long offset) {
+    FILE *file = fopen(path, "r+b");
+    TEST_CHECK(file != NULL);
+    fseek(file, offset, SEEK_SET);
+    int byte = fgetc(file);
+    fseek(file, offset, SEEK_SET);
+    fputc(~byte & 0xFF, file);
+    fclose(file);
+}
+
+static void testRoundTrip(void) {
+    List records;
+    List loaded;
+    list_INIT(&records, Record);
+    for (int i = 0; i < 1000; i++) {
+        Record record = {i, i * 0.5, "rec"};
+        list_ADD(&records, Record, record);
+    }
+    TEST_CHECK(listSave(&records, PATH));
+    TEST_CHECK(list_OPEN_MAPPED(&loaded, Record, PATH));
+    TEST_CHECK(loaded.currentCount == 1000);
+    TEST_CHECK(memcmp(loaded.data, records.data, 1000 * sizeof(Record)) == 0);
+    TEST_CHECK(listVerifyChecksum(&loaded));
+
+    Record extra = {1000, 1.0, "new"};
+    list_ADD(&loaded, Record, extra); /* moves the elements to the heap */
+    TEST_CHECK(loaded.currentCount == 1001);
+    TEST_CHECK(list_GET(&loaded, Record, 999)->id == 999);
+    TEST_CHECK(list_GET(&loaded, Record, 1000)->id == 1000);
+    listFree(&loaded);
+    listFree(&records);
+
+    List numbers;
+    list_INIT(&numbers, int);
+    list_ADD_ALL(&numbers, int, 4, 3, 1, 4, 2);
+    listSort(&numbers);                                      /* the sorted flag is saved */
+    TEST_CHECK(listSave(&numbers, PATH));
+    TEST_CHECK(list_OPEN_MAPPED(&loaded, int, PATH));
+    TEST_CHECK(loaded.sorted && *list_GET(&loaded, int, 3) == 4);
+    listFree(&loaded);
+    listFree(&numbers);
+}
+
+static void testRejected(void) {
+    List numbers;
+    List loaded;
+    list_INIT(&numbers, int);
+    for (int i = 0; i < 100; i++) {
+        list_ADD(&numbers, int, i);
+    }
+    TEST_CHECK(listSave(&numbers, PATH));
+
+    TEST_CHECK(!list_OPEN_MAPPED(&loaded, long long, PATH)); /* element size */
+    TEST_CHECK(loaded.currentCount == 0);
+    listFree(&loaded);
+    TEST_CHECK(!list_OPEN_MAPPED(&loaded, float, PATH));     /* data type, same size */
+    listFree(&loaded);
+
+    corruptByte(PATH, 128 + 10);
+    TEST_CHECK(list_OPEN_MAPPED(&loaded, int, PATH));        /* only the header is checked */
+    TEST_CHECK(!listVerifyChecksum(&loaded));
+    listFree(&loaded);
+
+    corruptByte(PATH, 40);
+    TEST_CHECK(!list_OPEN_MAPPED(&loaded, int, PATH));       /* header checksum */
+    listFree(&loaded);
+
+    TEST_CHECK(listSave(&numbers, PATH));
+    truncateFile(PATH, 128 + 99 * sizeof(int));
+    TEST_CHECK(!list_OPEN_MAPPED(&loaded, int, PATH));
+    listFree(&loaded);
+    truncateFile(PATH, 64);
+    TEST_CHECK(!list_OPEN_MAPPED(&loaded, int, PATH));
+    listFree(&loaded);
+
+    TEST_CHECK(!list_OPEN_MAPPED(&loaded, int, "test_mmap_missing.bin"));
+    list_ADD(&loaded, int, 7);                               /* still usable */
+    TEST_CHECK(*list_GET(&loaded, int, 0) == 7);
+    listFree(&loaded);
+    listFree(&numbers);
+}
+
+static void testEmpty(void) {
+    List empty;
+    List loaded;
+    list_INIT(&empty, Large);
+    TEST_CHECK(listSave(&empty, PATH));
+    TEST_CHECK(list_OPEN_MAPPED(&loaded, Large, PATH));
+    TEST_CHECK(loaded.currentCount == 0);
+    TEST_CHECK(loaded.mapping == NULL && loaded.initSize > 0); /* room for the first add */
+    Large large;
+    for (int i = 0; i < 3; i++) {
+        memset(&large, 'a' + i, sizeof(large));
+        list_ADD(&loaded, Large, large);
+    }
+    TEST_CHECK(loaded.currentCount == 3);
+    TEST_CHECK(list_GET(&loaded, Large, 2)->payload[7999] == 'c');
+    listFree(&loaded);
+    listFree(&empty);
+}
+
+int main(void) {
+    testRoundTrip();
+    testRejected();
+    testEmpty();
+    remove(PATH);
+    return testReport("test_mmap");
+}
@@ -0,0 +1,122 @@
+/**
+ * @file test_parallel.c
+ * @brief Parallel collect and for-each checked against the sequential loops.
+ * @author Mark Jayson Lanuzo
+ * @date 2026-10-17
+ *
+ * For several thread counts and list lengths around the parallel threshold
+ * and the chunk size, list_PAR_COLLECT must select the same elements in the
+ * same order as list_COLLECT_TO_SUBLIST, and list_PAR_FOR_EACH must update
+ * every element exactly once. Lists that wrap around their buffer and lists
+ * with a hash index are covered, as is every task of listParallelFor
+ * running exactly once.
+ */
+
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include "test.h"
+#include "../list.h"
+
+typedef struct {
+    int id;
+    int age;
+    double score;
+} Person;
+
+static const int threadCounts[] = {1, 2, 3, 8};
+static const int lengths[] = {0, 1, 1000, 65535, 65536, 65536 * 3 + 7, 500000};
+
+list_DEFINE_PREDICATE(isOlder, Person, element->age > *(int *)context)
+list_DEFINE_ACTION(birthday, Person, element->age += 1; element->score = element->id * 0.5)
+list_DEFINE_ACTION(negate, int, *element = -*element)
+
+static void fillPeople(List *people, int count, bool wrapped) {
+    list_INIT(people, Person);
+    for (int i = 0; i < count; i++) {
+        Person person = {i, (int)(testRandom() % 100), 0};
+        list_ADD(people, Person, person);
+    }
+    if (wrapped && count > 10) {
+        /* move the head, so the elements wrap around the end of the buffer */
+        for (int i = 0; i < 10; i++) {
+            Person person = list_POP_BACK(people, Person);
+            list_PUSH_FRONT(people, Person, person);
+        }
+    }
+}
+
+static void checkCollect(List *people, int threshold) {
+    List parallel;
+    List sequential;
+    list_PAR_COLLECT(people, Person, isOlder, &threshold, &parallel);
+    list_COLLECT_TO_SUBLIST(people, Person, element->age > threshold, &sequential);
+    TEST_CHECK(parallel.currentCount == sequential.currentCount);
+    TEST_CHECK(parallel.currentCount == 0 ||
+               memcmp(parallel.data, sequential.data, parallel.dataSize) == 0);
+    listFree(&parallel);
+    listFree(&sequential);
+}
+
+static void checkForEach(List *people) {
+    int *ages = malloc(((size_t)people->currentCount + 1) * sizeof(int));
+    for (int i = 0; i < people->currentCount; i++) {
+        ages[i] = list_GET(people, Person, i)->age;
+    }
+    list_PAR_FOR_EACH(people, Person, birthday, NULL);
+    for (int i = 0; i < people->currentCount; i++) {
+        Person *person = list_GET(people, Person, i);
+        if (person->age != ages[i] + 1 || person->score != person->id * 0.5) {
+            TEST_CHECK(person->age == ages[i] + 1 && person->score == person->id * 0.5);
+            break;
+        }
+    }
+    free(ages);
+}
+
+static void checkIndexed(void) {
+    List numbers;
+    list_INIT(&numbers, int);
+    for (int i = 0; i < 100000; i++) {
+        list_ADD(&numbers, int, i);
+    }
+    listSort(&numbers);
+    listEnableIndex(&numbers, NULL, NULL);
+    list_PAR_FOR_EACH(&numbers, int, negate, NULL);
+    TEST_CHECK(!numbers.sorted);
+    TEST_CHECK(list_GET_INDEX_OF(&numbers, int, -70000) == 70000);
+    TEST_CHECK(list_GET_INDEX_OF(&numbers, int, 70000) == -1);
+    listFree(&numbers);
+}
+
+static size_t taskRuns[1000];
+
+static void countTask(void *job, size_t taskIndex) {
+    (void)job;
+    __atomic_fetch_add(&taskRuns[taskIndex], 1, __ATOMIC_RELAXED);
+}
+
+int main(void) {
+    for (size_t t = 0; t < sizeof(threadCounts) / sizeof(threadCounts[0]); t++) {
+        listParallelSetThreads(threadCounts[t]);
+        TEST_CHECK(listParallelThreads() == threadCounts[t]);
+        for (size_t l = 0; l < sizeof(lengths) / sizeof(lengths[0]) && !testFailures; l++) {
+            List people;
+            fillPeople(&people, lengths[l], l % 2 == 1);
+            checkCollect(&people, -1);          /* everything */
+            checkCollect(&people, 49);          /* about half */
+            checkCollect(&people, 99);          /* nothing */
+            checkForEach(&people);
+            listFree(&people);
+        }
+        memset(taskRuns, 0, sizeof(taskRuns));
+        listParallelFor(1000, countTask, NULL);
+        for (int i = 0; i < 1000; i++) {
+            TEST_CHECK(taskRuns[i] == 1);
+        }
+    }
+    checkIndexed();
+    listParallelShutdown();
+    return testReport("test_parallel");
+}
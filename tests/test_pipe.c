@@ -0,0 +1,255 @@
+/**
+ * @file test_pipe.c
+ * @brief Pipelines checked against hand-written loops.
+ * @author Mark Jayson Lanuzo
+ * @date 2026-10-17
+ *
+ * Runs chains of FILTER, MAP and TAKE stages with random parameters, limits of
+ * 0 and 1 included, through every list_PIPE_* terminal on random lists, some
+ * wrapped around their buffer, and on strided views, and compares each result
+ * with a plain loop over an array. Two TAKE stages in one chain count apart,
+ * and a counting MAP at the front shows that TAKE and list_PIPE_FIRST stop
+ * the scan early. list_PIPE_COLLECT must match chained list_COLLECT_TO_SUBLIST
+ * calls and must not grow a sublist created with enough capacity.
+ */
+
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include "test.h"
+#include "../list.h"
+
+#define ROUNDS 300
+#define MAX_COUNT 3000
+
+typedef struct {
+    int age;
+    int year;
+} Member;
+
+static int values[MAX_COUNT];
+static int valueCount;
+
+/**
+ * @brief Fills a list and values[] with the same random numbers, negatives
+ *        included, rotating the list so it often wraps around its buffer.
+ */
+static void fillRandom(List *list, int round) {
+    list_INIT(list, int);
+    valueCount = round % 10 == 0 ? (int)(testRandom() % 3) : (int)(testRandom() % MAX_COUNT);
+    for (int i = 0; i < valueCount; i++) {
+        list_ADD(list, int, (int)(testRandom() % 2001) - 1000);
+    }
+    int turns = round % 2 && valueCount > 0 ? (int)(testRandom() % (uint32_t)valueCount) : 0;
+    for (int i = 0; i < turns; i++) {
+        list_PUSH_FRONT(list, int, list_POP_BACK(list, int));
+    }
+    for (int i = 0; i < valueCount; i++) {
+        values[i] = *(int *)listAt(list, i);
+    }
+}
+
+/**
+ * @brief Draws a TAKE limit: often 0 or 1, otherwise up to a bit past the length.
+ */
+static int drawLimit(void) {
+    switch (testRandom() % 4) {
+    case 0:
+        return (int)(testRandom() % 2);
+    default:
+        return (int)(testRandom() % (uint32_t)(valueCount + 10));
+    }
+}
+
+static void checkTerminals(List *list) {
+    int divisor = (int)(testRandom() % 5) + 1;
+    int low = (int)(testRandom() % 2001) - 1000;
+    int limit = drawLimit();
+    int second = drawLimit();
+
+    /* FILTER, TAKE */
+    size_t count = 0;
+    for (int i = 0; i < valueCount && count < (size_t)limit; i++) {
+        count += values[i] % divisor == 0;
+    }
+    TEST_CHECK(list_PIPE_COUNT(list, int, FILTER(*element % divisor == 0), TAKE(limit)) == count);
+
+    /* FILTER, MAP, TAKE, FILTER: the TAKE limit applies before the last FILTER */
+    long long sum = 0;
+    int taken = 0;
+    for (int i = 0; i < valueCount && taken < limit; i++) {
+        if (values[i] > low) {
+            taken++;
+            long long mapped = (long long)values[i] * 3;
+            sum += mapped % 2 == 0 ? mapped : 0;
+        }
+    }
+    TEST_CHECK(list_PIPE_SUM(list, int, long long, FILTER(*element > low),
+                             MAP(long long, (long long)*element * 3), TAKE(limit),
+                             FILTER(*element % 2 == 0)) == sum);
+
+    /* TAKE, FILTER, TAKE: each TAKE keeps a counter of its own */
+    count = 0;
+    for (int i = 0; i < valueCount && i < limit && count < (size_t)second; i++) {
+        count += values[i] % divisor != 0;
+    }
+    TEST_CHECK(list_PIPE_COUNT(list, int, TAKE(limit), FILTER(*element % divisor != 0),
+                               TAKE(second)) == count);
+
+    /* MAP to another type, then MIN and MAX */
+    bool found = false;
+    double lowest = 0;
+    double highest = 0;
+    for (int i = 0; i < valueCount; i++) {
+        if (values[i] % divisor == 0) {
+            double half = values[i] / 2.0;
+            lowest = !found || half < lowest ? half : lowest;
+            highest = !found || half > highest ? half : highest;
+            found = true;
+        }
+    }
+    double pipeLowest = 12345;
+    double pipeHighest = 12345;
+    TEST_CHECK(list_PIPE_MIN(list, int, &pipeLowest, FILTER(*element % divisor == 0),
+                             MAP(double, *element / 2.0)) == found);
+    TEST_CHECK(list_PIPE_MAX(list, int, &pipeHighest, FILTER(*element % divisor == 0),
+                             MAP(double, *element / 2.0)) == found);
+    TEST_CHECK(found ? pipeLowest == lowest && pipeHighest == highest
+                     : pipeLowest == 12345 && pipeHighest == 12345);
+
+    /* FIRST stops at the first match: the counting MAP sees nothing after it */
+    int scanned = 0;
+    int first = -1;
+    for (int i = 0; i < valueCount; i++) {
+        if (values[i] > low) {
+            first = i;
+            break;
+        }
+    }
+    int result = 0;
+    TEST_CHECK(list_PIPE_FIRST(list, int, &result, MAP(int, (scanned++, *element)),
+                               FILTER(*element > low)) == (first != -1));
+    TEST_CHECK(first == -1 ? scanned == valueCount && result == 0
+                           : scanned == first + 1 && result == values[first]);
+
+    /* TAKE ends the scan once its limit is reached */
+    scanned = 0;
+    int passed = 0;
+    int expectedScan = 0;
+    for (int i = 0; i < valueCount; i++) {
+        expectedScan++;
+        if (values[i] % divisor == 0 && (limit == 0 || ++passed == limit)) {
+            break;
+        }
+    }
+    list_PIPE_COUNT(list, int, MAP(int, (scanned++, *element)), FILTER(*element % divisor == 0),
+                    TAKE(limit));
+    TEST_CHECK(scanned == expectedScan);
+}
+
+static void checkCollect(List *list) {
+    int low = (int)(testRandom() % 2001) - 1000;
+    int limit = drawLimit();
+
+    List chained, mapped;
+    list_COLLECT_TO_SUBLIST(list, int, *element > low, &chained);
+    list_INIT(&mapped, long long);
+    for (int i = 0; i < chained.currentCount; i++) {
+        long long value = *(int *)listAt(&chained, i) * 1000LL;
+        list_ADD(&mapped, long long, value);
+    }
+
+    List piped;
+    list_INIT_WITH_CAPACITY(&piped, long long, mapped.currentCount + 1);
+    void *buffer = piped.data;
+    list_PIPE_COLLECT(list, int, &piped, FILTER(*element > low),
+                      MAP(long long, *element * 1000LL));
+    TEST_CHECK(piped.currentCount == mapped.currentCount && piped.data == buffer);
+    TEST_CHECK(memcmp(piped.data, mapped.data, (size_t)mapped.currentCount *
+                                               sizeof(long long)) == 0);
+
+    List limited;
+    list_INIT(&limited, long long);
+    list_PIPE_COLLECT(list, int, &limited, FILTER(*element > low),
+                      MAP(long long, *element * 1000LL), TAKE(limit));
+    int expected = limit < mapped.currentCount ? limit : mapped.currentCount;
+    TEST_CHECK(limited.currentCount == expected);
+    TEST_CHECK(memcmp(limited.data, mapped.data, (size_t)expected * sizeof(long long)) == 0);
+
+    listFree(&chained);
+    listFree(&mapped);
+    listFree(&piped);
+    listFree(&limited);
+}
+
+static void checkView(List *list) {
+    if (valueCount == 0) {
+        return;
+    }
+    int start = (int)(testRandom() % (uint32_t)valueCount);
+    int step = (int)(testRandom() % 4) + 1;
+    int length = (valueCount - start - 1) / step + 1;
+    ListView view = listSliceStep(list, start, length, step);
+    int limit = drawLimit();
+    long long sum = 0;
+    for (int i = 0; i < length && i < limit; i++) {
+        sum += values[start + i * step] < 0 ? values[start + i * step] : 0;
+    }
+    TEST_CHECK(list_PIPE_SUM(&view, int, long long, TAKE(limit), FILTER(*element < 0)) == sum);
+}
+
+static void testAgainstLoops(void) {
+    for (int round = 0; round < ROUNDS && !testFailures; round++) {
+        List list;
+        fillRandom(&list, round);
+        checkTerminals(&list);
+        checkCollect(&list);
+        checkView(&list);
+        for (int i = 0; i < valueCount; i++) {  /* the pipeline leaves the list as it was */
+            TEST_CHECK(*(int *)listAt(&list, i) == values[i]);
+        }
+        listFree(&list);
+    }
+}
+
+static void testStructs(void) {
+    List members;
+    list_INIT(&members, Member);
+    for (int i = 0; i < 5000; i++) {
+        Member member = { (int)(testRandom() % 80), 1940 + (int)(testRandom() % 70) };
+        list_ADD(&members, Member, member);
+    }
+    size_t count = 0;
+    long long years = 0;
+    for (int i = 0; i < members.currentCount && count < 100; i++) {
+        Member *member = listAt(&members, i);
+        if (member->age > 30 && member->year < 1990) {
+            count++;
+            years += member->year;
+        }
+    }
+    TEST_CHECK(list_PIPE_COUNT(&members, Member, FILTER(element->age > 30),
+                               MAP(int, element->year), FILTER(*element < 1990),
+                               TAKE(100)) == count);
+    TEST_CHECK(list_PIPE_SUM(&members, Member, long long, FILTER(element->age > 30),
+                             MAP(int, element->year), FILTER(*element < 1990),
+                             TAKE(100)) == years);
+
+    List young;
+    list_INIT(&young, Member);
+    list_PIPE_COLLECT(&members, Member, &young, FILTER(element->age < 18));
+    List expected;
+    list_COLLECT_TO_SUBLIST(&members, Member, element->age < 18, &expected);
+    TEST_CHECK(young.currentCount == expected.currentCount);
+    TEST_CHECK(memcmp(young.data, expected.data, expected.dataSize) == 0);
+    listFree(&young);
+    listFree(&expected);
+    listFree(&members);
+}
+
+int main(void) {
+    testAgainstLoops();
+    testStructs();
+    return testReport("test_pipe");
+}
@@ -0,0 +1,163 @@
+/**
+ * @file test_remove.c
+ * @brief Removal modes checked against a plain array.
+ * @author Mark Jayson Lanuzo
+ * @date 2026-10-17
+ *
+ * Applies random list_REMOVE, list_REMOVE_AT, list_SWAP_REMOVE_AT and
+ * list_REMOVE_IF calls, mixed with adds and front pops so the buffer wraps,
+ * to a list and to a plain array. After every step the list must hold the
+ * same elements in the same order: shifted for the ordered removals, with
+ * the last element moved into the hole for the swap removal, and compacted
+ * stably for remove-if. The run is repeated with a hash index, whose lookups
+ * must follow. A last sweep removes 30% of a million elements in one pass.
+ */
+
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include "test.h"
+#include "../list.h"
+
+#define STEPS 20000
+#define VALUES 50
+#define MAX_COUNT 2048
+#define SWEEP_COUNT 1000000
+
+static int model[MAX_COUNT];
+static int modelCount;
+
+static void modelRemove(int position) {
+    memmove(model + position, model + position + 1,
+            (size_t)(modelCount - position - 1) * sizeof(int));
+    modelCount--;
+}
+
+static int modelIndexOf(int value) {
+    for (int i = 0; i < modelCount; i++) {
+        if (model[i] == value) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+static void checkContents(List *list) {
+    TEST_CHECK(list->currentCount == modelCount);
+    for (int i = 0; i < modelCount && i < list->currentCount; i++) {
+        TEST_CHECK(*list_GET(list, int, i) == model[i]);
+    }
+}
+
+/**
+ * @brief Applies one random operation to the list and to the model.
+ */
+static void step(List *list) {
+    int value = (int)(testRandom() % VALUES);
+    int position = modelCount ? (int)(testRandom() % (uint32_t)modelCount) : 0;
+    int operation = (int)(testRandom() % 10);
+    if (modelCount == 0 || (operation < 4 && modelCount < MAX_COUNT)) {
+        list_ADD(list, int, value);
+        model[modelCount++] = value;
+        return;
+    }
+    switch (operation) {
+    case 4:
+        TEST_CHECK(list_POP_FRONT(list, int) == model[0]);
+        modelRemove(0);
+        break;
+    case 5:
+        list_REMOVE_AT(list, int, position);
+        modelRemove(position);
+        break;
+    case 6:
+    case 7:
+        list_SWAP_REMOVE_AT(list, int, position);
+        model[position] = model[modelCount - 1];
+        modelCount--;
+        break;
+    case 8: {
+        int found = modelIndexOf(value);
+        if (found != -1) {
+            list_REMOVE(list, int, value);
+            modelRemove(found);
+        }
+        break;
+    }
+    default: {
+        int divisor = (int)(testRandom() % 7) + 2;
+        int kept = 0;
+        for (int i = 0; i < modelCount; i++) {
+            if (model[i] % divisor != 0) {
+                model[kept++] = model[i];
+            }
+        }
+        int removed = list_REMOVE_IF(list, int, *element % divisor == 0);
+        TEST_CHECK(removed == modelCount - kept);
+        modelCount = kept;
+        break;
+    }
+    }
+}
+
+static void runRandom(bool indexed) {
+    List list;
+    list_INIT(&list, int);
+    modelCount = 0;
+    if (indexed) {
+        listEnableIndex(&list, NULL, NULL);
+    }
+    for (int i = 0; i < STEPS && !testFailures; i++) {
+        step(&list);
+        checkContents(&list);
+        int value = (int)(testRandom() % VALUES);
+        TEST_CHECK(list_GET_INDEX_OF(&list, int, value) == modelIndexOf(value));
+    }
+    listFree(&list);
+}
+
+static void testEdges(void) {
+    List list;
+    list_INIT(&list, int);
+    list_ADD_ALL(&list, int, 3, 1, 2, 3);
+    list_REMOVE_AT(&list, int, 3);                  /* out of range: ignored */
+    list_SWAP_REMOVE_AT(&list, int, -1);
+    TEST_CHECK(list.currentCount == 3);
+    list_SWAP_REMOVE_AT(&list, int, 2);             /* the last element: nothing moves */
+    TEST_CHECK(list.currentCount == 2 && *list_GET(&list, int, 1) == 2);
+    TEST_CHECK(list_REMOVE_IF(&list, int, *element > 10) == 0);
+    TEST_CHECK(list_REMOVE_IF(&list, int, true) == 2 && list.currentCount == 0);
+    TEST_CHECK(list_REMOVE_IF(&list, int, true) == 0);
+    listFree(&list);
+}
+
+static void testSweep(void) {
+    List list;
+    list_INIT_WITH_CAPACITY(&list, int, SWEEP_COUNT);
+    for (int i = 0; i < SWEEP_COUNT; i++) {
+        list_ADD(&list, int, i);
+    }
+    int removed = list_REMOVE_IF(&list, int, *element % 10 < 3);
+    TEST_CHECK(removed == SWEEP_COUNT / 10 * 3);
+    int expected = 0;
+    for (int i = 0; i < list.currentCount; i++) {
+        while (expected % 10 < 3) {
+            expected++;
+        }
+        if (*list_GET(&list, int, i) != expected) {
+            TEST_CHECK(*list_GET(&list, int, i) == expected);
+            break;
+        }
+        expected++;
+    }
+    listFree(&list);
+}
+
+int main(void) {
+    runRandom(false);
+    runRandom(true);
+    testEdges();
+    testSweep();
+    return testReport("test_remove");
+}
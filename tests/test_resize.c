@@ -0,0 +1,177 @@
+/**
+ * @file test_resize.c
+ * @brief Incremental resizing combined with front pushes, pops and lookups.
+ * @author Mark Jayson Lanuzo
+ * @date 2026-10-17
+ *
+ * Pushes to the front of a full list with incremental resizing on, which
+ * starts a migration, and checks that no element is lost. Then looks values
+ * up while a migration is pending, in lists with and without a registered
+ * equality, and checks both the answers and that the lookups left the
+ * migration pending. Elements popped before their migration must not be
+ * found.
+ */
+
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include "test.h"
+#include "../list.h"
+
+typedef struct {
+    int id;
+    char note[12];
+} Tagged;
+
+/**
+ * @brief Compares Tagged elements by id only.
+ */
+static bool taggedEquals(const void *a, const void *b, size_t size) {
+    (void)size;
+    return ((const Tagged *)a)->id == ((const Tagged *)b)->id;
+}
+
+static size_t taggedHash(const void *element, size_t size) {
+    (void)size;
+    return (size_t)((const Tagged *)element)->id * 2654435761u;
+}
+
+static void testPushFront(void) {
+    List list;
+    list_INIT(&list, int);
+    for (int i = 0; i < 128; i++) {
+        list_ADD(&list, int, i);
+    }
+    listSetIncrementalResize(&list, true);
+    while (list.currentCount < list.initSize) {
+        list_ADD(&list, int, list.currentCount);
+    }
+    list_PUSH_FRONT(&list, int, -1); /* full: grows */
+    TEST_CHECK(list.currentCount == (int)(list.dataSize / sizeof(int)));
+    TEST_CHECK(*list_GET(&list, int, 0) == -1);
+    for (int i = 1; i < list.currentCount; i++) {
+        TEST_CHECK(*list_GET(&list, int, i) == i - 1);
+    }
+    TEST_CHECK(list_POP_FRONT(&list, int) == -1);
+    TEST_CHECK(list_POP_FRONT(&list, int) == 0);
+    listFree(&list);
+}
+
+/**
+ * @brief Adds until an add starts a migration that is still pending.
+ */
+static void startMigration(List *list, void (*add)(List *, int)) {
+    int added = 0;
+    while (!list->migrateEnd || list->migrateEnd - list->migrated < 64) {
+        add(list, added++);
+    }
+}
+
+static void addInt(List *list, int value) {
+    list_ADD(list, int, value);
+}
+
+static void addTagged(List *list, int value) {
+    Tagged tagged = {value, "tag"};
+    list_ADD(list, Tagged, tagged);
+}
+
+static void testLookupsInt(void) {
+    List list;
+    list_INIT(&list, int);
+    listSetIncrementalResize(&list, true);
+    startMigration(&list, addInt);
+    int count = list.currentCount;
+    int pending = list.migrateEnd - list.migrated;
+
+    for (int value = -1; value <= count; value += 7) {
+        int expected = value >= 0 && value < count ? value : -1;
+        TEST_CHECK(list_GET_INDEX_OF(&list, int, value) == expected);
+        TEST_CHECK(list_CONTAINS(&list, int, value) == (expected != -1));
+        TEST_CHECK(listCountEqual(&list, &value) == (expected != -1));
+    }
+    int last = count - 1;
+    TEST_CHECK(list_GET_INDEX_OF(&list, int, last) == last);
+    TEST_CHECK(list.migrateEnd - list.migrated == pending); /* nothing was migrated */
+
+    list_REMOVE(&list, int, last);
+    TEST_CHECK(list.currentCount == count - 1 && !list_CONTAINS(&list, int, last));
+    listSetIncrementalResize(&list, false);
+    TEST_CHECK(list.migrateEnd == 0);
+    for (int i = 0; i < list.currentCount; i++) {
+        TEST_CHECK(*list_GET(&list, int, i) == i);
+    }
+    listFree(&list);
+}
+
+static void testPopDuringMigration(void) {
+    List list;
+    list_INIT(&list, int);
+    listSetIncrementalResize(&list, true);
+    startMigration(&list, addInt);
+    int count = list.currentCount;
+    for (int i = 0; i < count - 25; i++) {
+        TEST_CHECK(list_POP_BACK(&list, int) == count - 1 - i);
+    }
+    TEST_CHECK(list.migrateEnd > list.currentCount); /* the removed tail is still pending */
+    TEST_CHECK(list_GET_INDEX_OF(&list, int, 24) == 24);
+    TEST_CHECK(list_GET_INDEX_OF(&list, int, 25) == -1);
+    TEST_CHECK(list_GET_INDEX_OF(&list, int, count - 15) == -1);
+    TEST_CHECK(!list_CONTAINS(&list, int, count - 1));
+    int removed = count - 15;
+    TEST_CHECK(listCountEqual(&list, &removed) == 0);
+
+    list_SWAP_REMOVE_AT(&list, int, 0); /* 24 moves to the front */
+    TEST_CHECK(list_GET_INDEX_OF(&list, int, 24) == 0);
+    TEST_CHECK(list_GET_INDEX_OF(&list, int, 0) == -1);
+    list_ADD(&list, int, 1000);
+    TEST_CHECK(list_GET_INDEX_OF(&list, int, 1000) == 24);
+    listFree(&list);
+}
+
+static void testLookupsEquals(void) {
+    List list;
+    listRegisterType("Tagged", taggedEquals, taggedHash);
+    list_INIT(&list, Tagged);
+    listSetIncrementalResize(&list, true);
+    startMigration(&list, addTagged);
+    int pending = list.migrateEnd - list.migrated;
+
+    Tagged probe = {0, "other"}; /* equal by id only */
+    for (int id = 0; id < list.currentCount; id += 5) {
+        probe.id = id;
+        TEST_CHECK(list_GET_INDEX_OF(&list, Tagged, probe) == id);
+    }
+    probe.id = list.currentCount;
+    TEST_CHECK(!list_CONTAINS(&list, Tagged, probe));
+    TEST_CHECK(list.migrateEnd - list.migrated == pending);
+    listFree(&list);
+}
+
+static void testLookupsRing(void) {
+    List list;
+    list_INIT(&list, int);
+    for (int i = 0; i < 100; i++) {
+        list_ADD(&list, int, i);
+    }
+    for (int i = 0; i < 20; i++) {
+        list_PUSH_FRONT(&list, int, -1 - i); /* wraps around the buffer end */
+    }
+    int head = list.head;
+    TEST_CHECK(list_GET_INDEX_OF(&list, int, -20) == 0);
+    TEST_CHECK(list_GET_INDEX_OF(&list, int, -1) == 19);
+    TEST_CHECK(list_GET_INDEX_OF(&list, int, 99) == 119);
+    TEST_CHECK(list_GET_INDEX_OF(&list, int, 100) == -1);
+    TEST_CHECK(list.head == head); /* read in place */
+    listFree(&list);
+}
+
+int main(void) {
+    testPushFront();
+    testLookupsInt();
+    testPopDuringMigration();
+    testLookupsEquals();
+    testLookupsRing();
+    return testReport("test_resize");
+}
@@ -0,0 +1,169 @@
+/**
+ * @file test_segmented.c
+ * @brief Segmented lists checked against a plain array.
+ * @author Mark Jayson Lanuzo
+ * @date 2026-10-17
+ *
+ * Checks the index-to-segment math on every segment boundary, then applies
+ * random adds, sets and removals, many of them right at a boundary so the
+ * shifted tail crosses from one segment into the previous one, and compares
+ * the list with an array through list_SEG_GET, list_SEG_FOR_EACH,
+ * list_SEG_TO_ARRAY, lookups and list_SEG_COLLECT_TO_SUBLIST. Pointers taken
+ * before a long run of adds must still point to the same elements.
+ */
+
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+#include <limits.h>
+
+#include "test.h"
+#include "../list.h"
+
+#define STEPS 20000
+#define MAX_COUNT 5000
+#define VALUES 1000
+
+static int model[MAX_COUNT];
+static int modelCount;
+
+static void testSegmentMath(void) {
+    long long first = 0;
+    for (int segment = 0; segment < LIST_SEGMENT_COUNT; segment++) {
+        long long capacity = (long long)listSegmentCapacity(segment);
+        long long probes[] = {first, first + 1, first + capacity / 2, first + capacity - 1};
+        for (int p = 0; p < 4 && probes[p] <= INT_MAX; p++) {
+            size_t offset;
+            TEST_CHECK(listSegmentOf((int)probes[p], &offset) == segment);
+            TEST_CHECK(offset == (size_t)(probes[p] - first));
+        }
+        first += capacity;
+    }
+    TEST_CHECK(first > INT_MAX);                /* every int index has a segment */
+}
+
+/**
+ * @brief Picks a position, often right before, at or after a segment boundary.
+ */
+static int pickPosition(void) {
+    if (testRandom() % 2) {
+        return (int)(testRandom() % (uint32_t)modelCount);
+    }
+    int boundary = (64 << (testRandom() % 6)) - 64;     /* 0, 64, 192, 448, 960, 1984 */
+    int position = boundary + (int)(testRandom() % 3) - 1;
+    if (position < 0 || position >= modelCount) {
+        position = modelCount - 1;
+    }
+    return position;
+}
+
+static void checkContents(ListSegmented *list) {
+    TEST_CHECK(listSegLength(list) == modelCount);
+    for (int i = 0; i < modelCount; i++) {
+        if (*list_SEG_GET(list, int, i) != model[i]) {
+            TEST_CHECK(*list_SEG_GET(list, int, i) == model[i]);
+            break;
+        }
+    }
+    int visited = 0;
+    bool inOrder = true;
+    list_SEG_FOR_EACH(list, int, inOrder = inOrder && *element == model[visited]; visited++);
+    TEST_CHECK(inOrder && visited == modelCount);
+    int *array = list_SEG_TO_ARRAY(list, int);
+    TEST_CHECK(memcmp(array, model, (size_t)modelCount * sizeof(int)) == 0);
+    free(array);
+}
+
+static void testAgainstArray(void) {
+    ListSegmented list;
+    list_SEG_INIT(&list, int);
+    modelCount = 0;
+    for (int s = 0; s < STEPS && !testFailures; s++) {
+        int value = (int)(testRandom() % VALUES);
+        int operation = (int)(testRandom() % 8);
+        if (modelCount == 0 || (operation < 4 && modelCount < MAX_COUNT)) {
+            list_SEG_ADD(&list, int, value);
+            model[modelCount++] = value;
+            continue;
+        }
+        int position = pickPosition();
+        switch (operation) {
+        case 4:
+            list_SEG_SET(&list, int, position, value);
+            model[position] = value;
+            break;
+        case 5:
+        case 6:
+            list_SEG_REMOVE_AT(&list, position);
+            memmove(model + position, model + position + 1,
+                    (size_t)(modelCount - position - 1) * sizeof(int));
+            modelCount--;
+            break;
+        default: {
+            value = model[position];
+            int found = 0;
+            while (model[found] != value) {
+                found++;
+            }
+            TEST_CHECK(list_SEG_GET_INDEX_OF(&list, int, value) == found);
+            list_SEG_REMOVE(&list, int, value);
+            memmove(model + found, model + found + 1,
+                    (size_t)(modelCount - found - 1) * sizeof(int));
+            modelCount--;
+            break;
+        }
+        }
+        if (s % 100 == 0) {
+            checkContents(&list);
+        }
+    }
+    checkContents(&list);
+    TEST_CHECK(!list_SEG_CONTAINS(&list, int, VALUES));
+
+    ListSegmented even;
+    list_SEG_COLLECT_TO_SUBLIST(&list, int, *element % 2 == 0, &even);
+    int kept = 0;
+    for (int i = 0; i < modelCount; i++) {
+        if (model[i] % 2 == 0) {
+            model[kept++] = model[i];
+        }
+    }
+    modelCount = kept;
+    checkContents(&even);
+    listSegFree(&even);
+    listSegFree(&list);
+}
+
+static void testStableAddresses(void) {
+    ListSegmented list;
+    int *pointers[200];
+    list_SEG_INIT(&list, int);
+    for (int i = 0; i < 200; i++) {
+        list_SEG_ADD(&list, int, i);
+        pointers[i] = list_SEG_GET(&list, int, i);
+    }
+    for (int i = 200; i < 1000000; i++) {
+        list_SEG_ADD(&list, int, i);
+    }
+    for (int i = 0; i < 200; i++) {
+        TEST_CHECK(pointers[i] == list_SEG_GET(&list, int, i) && *pointers[i] == i);
+    }
+
+    int capacity = list.initSize;
+    while (listSegLength(&list) > 10) {
+        list_SEG_REMOVE_AT(&list, listSegLength(&list) - 1);
+    }
+    for (int i = 10; i < 1000000; i++) {      /* segments are kept: no new allocation */
+        list_SEG_ADD(&list, int, i);
+    }
+    TEST_CHECK(list.initSize == capacity && *list_SEG_GET(&list, int, 999999) == 999999);
+    TEST_CHECK(list_SEG_GET(&list, int, 1000000) == NULL);
+    listSegFree(&list);
+}
+
+int main(void) {
+    testSegmentMath();
+    testAgainstArray();
+    testStableAddresses();
+    return testReport("test_segmented");
+}
@@ -0,0 +1,204 @@
+/**
+ * @file test_simd.c
+ * @brief Search and reduction kernels checked against plain loops.
+ * @author Mark Jayson Lanuzo
+ * @date 2026-10-17
+ *
+ * For every ListKind, every kernel level the CPU supports, lengths 0 to 70
+ * (so every tail length of the vector loops) and a few larger ones, contiguous
+ * and strided views: find, count, min, max, sums and range selection must give
+ * the results of a simple loop over the same elements. The list functions are
+ * checked the same way on the contiguous case.
+ */
+
+#include <stdlib.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "test.h"
+#include "../list.h"
+
+#define MAX_COUNT 4099
+
+static const size_t lengths[] = {1000, 1023, 4099};
+
+/**
+ * @brief Draws a small value, or now and then plus or minus extreme; only
+ *        non-negative values when isSigned is false.
+ */
+static int64_t drawValue(int64_t extreme, bool isSigned) {
+    uint32_t r = testRandom();
+    int64_t value = r % 53 == 0 ? (r & 64 ? extreme : -extreme) : (int64_t)(r % 41) - 20;
+    return isSigned || value >= 0 ? value : -value;
+}
+
+/**
+ * @brief Defines checkName(list, stride), comparing the kernels on every
+ *        stride-th element of a list of T with a loop over those elements.
+ */
+#define DEFINE_KIND_CHECK(Name, T, isSigned, isInteger)                             \
+static void check##Name(List *list, int stride) {                                   \
+    static T reference[MAX_COUNT];                                                  \
+    int count = (list->currentCount + stride - 1) / stride;                         \
+    ListView view = listSliceStep(list, 0, count, stride);                          \
+    for (int i = 0; i < count; i++) {                                               \
+        reference[i] = *list_GET(list, T, i * stride);                              \
+    }                                                                               \
+                                                                                    \
+    for (int k = 0; k < 4; k++) {                                                   \
+        T probe = count > 0 && k < 3 ? reference[testRandom() % (uint32_t)count]    \
+                                     : (T)1000;                                     \
+        int first = -1;                                                             \
+        size_t equal = 0;                                                           \
+        for (int i = 0; i < count; i++) {                                           \
+            if (reference[i] == probe) {                                            \
+                first = first == -1 ? i : first;                                    \
+                equal++;                                                            \
+            }                                                                       \
+        }                                                                           \
+        TEST_CHECK(listViewFindFirst(&view, &probe) == first);                      \
+        TEST_CHECK(listViewCountEqual(&view, &probe) == equal);                     \
+        if (stride == 1) {                                                          \
+            TEST_CHECK(listFindFirst(list, &probe) == first);                       \
+            TEST_CHECK(listCountEqual(list, &probe) == equal);                      \
+        }                                                                           \
+    }                                                                               \
+                                                                                    \
+    T low = 0;                                                                      \
+    T high = 0;                                                                     \
+    T result;                                                                       \
+    double sum = 0;                                                                 \
+    uint64_t exact = 0;                                                             \
+    for (int i = 0; i < count; i++) {                                               \
+        low = i == 0 || reference[i] < low ? reference[i] : low;                    \
+        high = i == 0 || reference[i] > high ? reference[i] : high;                 \
+        sum += (double)reference[i];                                                \
+        exact += isInteger ? (uint64_t)reference[i] : 0;                            \
+    }                                                                               \
+    TEST_CHECK(listViewMin(&view, &result) == (count > 0));                         \
+    TEST_CHECK(count == 0 || result == low);                                        \
+    TEST_CHECK(listViewMax(&view, &result) == (count > 0));                         \
+    TEST_CHECK(count == 0 || result == high);                                       \
+    TEST_CHECK(listViewSum(&view) == sum);                                          \
+    if (stride == 1) {                                                              \
+        TEST_CHECK(!listMin(list, &result) || result == low);                       \
+        TEST_CHECK(!listMax(list, &result) || result == high);                      \
+        TEST_CHECK(listSum(list) == sum);                                           \
+    }                                                                               \
+    int64_t signedTotal = 0;                                                        \
+    uint64_t unsignedTotal = 0;                                                     \
+    TEST_CHECK(listViewSumI64(&view, &signedTotal) == (isInteger && isSigned));     \
+    TEST_CHECK(listViewSumU64(&view, &unsignedTotal) == (isInteger && !isSigned));  \
+    TEST_CHECK(!(isInteger && isSigned) || (uint64_t)signedTotal == exact);         \
+    TEST_CHECK(!(isInteger && !isSigned) || unsignedTotal == exact);                \
+                                                                                    \
+    T from = (T)-5;                                                                 \
+    T to = (T)7;                                                                    \
+    if (!isSigned) {                                                                \
+        from = 3;                                                                   \
+    }                                                                               \
+    ListSelection selection;                                                        \
+    listSelectionInit(&selection);                                                  \
+    TEST_CHECK(listViewSelectRange(&view, &from, &to, &selection));                 \
+    int selected = 0;                                                               \
+    for (int i = 0; i < count; i++) {                                               \
+        if (from <= reference[i] && reference[i] <= to) {                           \
+            TEST_CHECK(selected < selection.currentCount &&                         \
+                       selection.positions[selected] == (uint32_t)i);               \
+            selected++;                                                             \
+        }                                                                           \
+    }                                                                               \
+    TEST_CHECK(selection.currentCount == selected);                                 \
+    listSelectionFree(&selection);                                                  \
+}
+
+DEFINE_KIND_CHECK(I32, int, true, true)
+DEFINE_KIND_CHECK(U32, unsigned int, false, true)
+DEFINE_KIND_CHECK(I64, long long, true, true)
+DEFINE_KIND_CHECK(U64, unsigned long long, false, true)
+DEFINE_KIND_CHECK(F32, float, true, false)
+DEFINE_KIND_CHECK(F64, double, true, false)
+
+/**
+ * @brief Builds a list of T with count elements and runs checkName on it.
+ */
+#define RUN_KIND(Name, T, isSigned, extreme, count) do {                            \
+    List list;                                                                      \
+    list_INIT(&list, T);                                                            \
+    TEST_CHECK(list.elementKind == LIST_KIND_##Name);                               \
+    for (size_t i = 0; i < (count); i++) {                                          \
+        list_ADD(&list, T, (T)drawValue(extreme, isSigned));                        \
+    }                                                                               \
+    for (int stride = 1; stride <= 3; stride++) {                                   \
+        check##Name(&list, stride);                                                 \
+    }                                                                               \
+    listFree(&list);                                                                \
+} while (0)
+
+static void checkAllKinds(size_t count) {
+    /* 64-bit extremes stay far enough from the limits that sums do not wrap */
+    RUN_KIND(I32, int, true, INT32_MAX, count);
+    RUN_KIND(U32, unsigned int, false, UINT32_MAX, count);
+    RUN_KIND(I64, long long, true, (int64_t)1 << 36, count);
+    RUN_KIND(U64, unsigned long long, false, (int64_t)1 << 36, count);
+    RUN_KIND(F32, float, true, 0, count);
+    RUN_KIND(F64, double, true, 0, count);
+}
+
+static void checkPointers(size_t count) {
+    static char targets[8];
+    List list;
+    list_INIT(&list, char *);
+    TEST_CHECK(list.elementKind == LIST_KIND_PTR);
+    for (size_t i = 0; i < count; i++) {
+        list_ADD(&list, char *, &targets[testRandom() % 8]);
+    }
+    char *probe = &targets[testRandom() % 8];
+    int first = -1;
+    size_t equal = 0;
+    char *low = NULL;
+    for (int i = 0; i < list.currentCount; i++) {
+        char *element = *list_GET(&list, char *, i);
+        if (element == probe) {
+            first = first == -1 ? i : first;
+            equal++;
+        }
+        low = i == 0 || (uintptr_t)element < (uintptr_t)low ? element : low;
+    }
+    char *result;
+    TEST_CHECK(listFindFirst(&list, &probe) == first);
+    TEST_CHECK(listCountEqual(&list, &probe) == equal);
+    TEST_CHECK(listMin(&list, &result) == (count > 0));
+    TEST_CHECK(count == 0 || result == low);
+    listFree(&list);
+}
+
+static void checkWrapAround(void) {
+    List list;
+    list_INIT(&list, long long);
+    list_ADD_ALL(&list, long long, 3, INT64_MAX, 1LL, 1LL);
+    int64_t total;
+    TEST_CHECK(listSumI64(&list, &total) && total == INT64_MIN + 1);
+    TEST_CHECK(listSum(&list) == (double)(INT64_MIN + 1));
+    listFree(&list);
+}
+
+int main(void) {
+    static const ListSimdLevel levels[] = {LIST_SIMD_SCALAR, LIST_SIMD_SSE2, LIST_SIMD_AVX2};
+    for (int l = 0; l < 3 && !testFailures; l++) {
+        listSimdSetLevel(levels[l]);
+        if (listSimdLevel() != levels[l]) {
+            continue; /* not supported by this CPU */
+        }
+        for (size_t count = 0; count <= 70 && !testFailures; count++) {
+            checkAllKinds(count);
+            checkPointers(count);
+        }
+        for (size_t i = 0; i < sizeof(lengths) / sizeof(lengths[0]); i++) {
+            checkAllKinds(lengths[i]);
+        }
+    }
+    checkWrapAround();
+    return testReport("test_simd");
+}
@@ -0,0 +1,191 @@
+/**
+ * @file test_soa.c
+ * @brief Columnar lists checked against a List of the same rows.
+ * @author Mark Jayson Lanuzo
+ * @date 2026-10-17
+ *
+ * Applies random adds, sets and removals to a ListSoA and to a List of rows
+ * whose unstored field is zero. Gathered rows, lookups, typed columns, column
+ * views, single-column selections, copied selections and collected sublists
+ * must all match the List. Nested members and a field left out of the schema
+ * are covered.
+ */
+
+#include <stdlib.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <string.h>
+
+#include "test.h"
+#include "../list.h"
+
+#define STEPS 5000
+#define MAX_COUNT 3000
+
+typedef struct {
+    int YYYY;
+    int MM;
+    int DD;
+} Date;
+
+typedef struct {
+    char tag;
+    long long id;
+    Date date;
+    int age;
+    double score;
+    int unstored;
+} Row;
+
+static const ListField rowFields[] = {
+    list_FIELD(Row, tag),
+    list_FIELD(Row, id),
+    list_FIELD(Row, date.YYYY),
+    list_FIELD(Row, date.MM),
+    list_FIELD(Row, date.DD),
+    list_FIELD(Row, age),
+    list_FIELD(Row, score),
+};
+static const ListSchema rowSchema = list_SCHEMA(Row, rowFields);
+
+/**
+ * @brief Draws a row with zero padding and a zero unstored field.
+ */
+static Row drawRow(void) {
+    Row row;
+    memset(&row, 0, sizeof(row));
+    row.tag = (char)('a' + testRandom() % 26);
+    row.id = (long long)testRandom() << 8;
+    row.date.YYYY = 1950 + (int)(testRandom() % 70);
+    row.date.MM = 1 + (int)(testRandom() % 12);
+    row.date.DD = 1 + (int)(testRandom() % 28);
+    row.age = (int)(testRandom() % 100);
+    row.score = (double)(testRandom() % 1000) / 8.0;
+    return row;
+}
+
+static void checkRows(ListSoA *soa, List *rows) {
+    TEST_CHECK(listSoALength(soa) == rows->currentCount);
+    const int *ages = list_SOA_COLUMN(soa, Row, age);
+    const int *years = list_SOA_COLUMN(soa, Row, date.YYYY);
+    for (int i = 0; i < rows->currentCount; i++) {
+        Row row = list_SOA_GET(soa, Row, i);
+        Row *expected = list_GET(rows, Row, i);
+        TEST_CHECK(memcmp(&row, expected, sizeof(Row)) == 0);
+        TEST_CHECK(ages[i] == expected->age && years[i] == expected->date.YYYY);
+    }
+}
+
+static void checkQueries(ListSoA *soa, List *rows) {
+    ListSelection selection;
+    listSelectionInit(&selection);
+    int threshold = (int)(testRandom() % 100);
+    list_SOA_SELECT(soa, Row, age, value > threshold, &selection);
+    int selected = 0;
+    for (int i = 0; i < rows->currentCount; i++) {
+        if (list_GET(rows, Row, i)->age > threshold) {
+            TEST_CHECK(selected < selection.currentCount &&
+                       selection.positions[selected] == (uint32_t)i);
+            selected++;
+        }
+    }
+    TEST_CHECK(selection.currentCount == selected);
+
+    ListSoA copied;
+    listSoACopySelection(soa, &selection, &copied);
+    TEST_CHECK(listSoALength(&copied) == selected);
+    for (int k = 0; k < selected && k < selection.currentCount; k++) {
+        Row row = list_SOA_GET(&copied, Row, k);
+        Row *expected = list_GET(rows, Row, (int)selection.positions[k]);
+        TEST_CHECK(memcmp(&row, expected, sizeof(Row)) == 0);
+    }
+    listSoAFree(&copied);
+
+    int year = 1950 + (int)(testRandom() % 70);
+    ListSoA collected;
+    List expected;
+    list_SOA_COLLECT(soa, Row, element->date.YYYY >= year && element->date.MM <= 6, &collected);
+    list_COLLECT_TO_SUBLIST(rows, Row, element->date.YYYY >= year && element->date.MM <= 6,
+                            &expected);
+    checkRows(&collected, &expected);
+    listSoAFree(&collected);
+    listFree(&expected);
+
+    ListView ages = list_SOA_COLUMN_VIEW(soa, Row, age);
+    int low = 0;
+    bool found = listViewMin(&ages, &low);
+    TEST_CHECK(found == (rows->currentCount > 0));
+    for (int i = 0; i < rows->currentCount; i++) {
+        TEST_CHECK(list_GET(rows, Row, i)->age >= low);
+    }
+    listSelectionFree(&selection);
+}
+
+static void testAgainstList(void) {
+    ListSoA soa;
+    List rows;
+    list_SOA_INIT(&soa, Row, rowSchema);
+    list_INIT(&rows, Row);
+    for (int s = 0; s < STEPS && !testFailures; s++) {
+        int count = rows.currentCount;
+        int position = count ? (int)(testRandom() % (uint32_t)count) : 0;
+        Row row = drawRow();
+        switch (count == 0 ? 0 : testRandom() % 6) {
+        case 0:
+        case 1:
+        case 2:
+            if (count < MAX_COUNT) {
+                list_SOA_ADD(&soa, Row, row);
+                list_ADD(&rows, Row, row);
+            }
+            break;
+        case 3:
+            list_SOA_SET(&soa, Row, position, row);
+            list_SET(&rows, Row, position, row);
+            break;
+        case 4:
+            list_SOA_REMOVE_AT(&soa, position);
+            list_REMOVE_AT(&rows, Row, position);
+            break;
+        default: {
+            Row victim = *list_GET(&rows, Row, position);
+            int expected = list_GET_INDEX_OF(&rows, Row, victim);
+            victim.unstored = 99;               /* not stored, so not compared */
+            TEST_CHECK(listSoAIndexOf(&soa, &victim) == expected);
+            list_SOA_REMOVE(&soa, Row, victim);
+            list_REMOVE_AT(&rows, Row, expected);
+            break;
+        }
+        }
+        if (s % 50 == 0) {
+            checkRows(&soa, &rows);
+            checkQueries(&soa, &rows);
+        }
+    }
+    checkRows(&soa, &rows);
+    listSoAFree(&soa);
+    listFree(&rows);
+}
+
+static void testEdges(void) {
+    ListSoA soa;
+    list_SOA_INIT(&soa, Row, rowSchema);
+    Row row = list_SOA_GET(&soa, Row, 0);       /* out of range: all zero */
+    Row zero;
+    memset(&zero, 0, sizeof(zero));
+    TEST_CHECK(memcmp(&row, &zero, sizeof(Row)) == 0);
+    list_SOA_REMOVE_AT(&soa, 0);
+    TEST_CHECK(listSoALength(&soa) == 0);
+    TEST_CHECK(list_SOA_COLUMN(&soa, Row, unstored) == NULL);
+    listSoAFree(&soa);
+
+    ListSoA wrong;
+    TEST_CHECK(!listSoAInit(&wrong, &rowSchema, sizeof(Date)));
+    listSoAFree(&wrong);
+}
+
+int main(void) {
+    testAgainstList();
+    testEdges();
+    return testReport("test_soa");
+}
@@ -0,0 +1,266 @@
+/**
+ * @file test_sort.c
+ * @brief Sorting, binary search and the sorted flag, checked against qsort.
+ * @author Mark Jayson Lanuzo
+ * @date 2026-10-17
+ *
+ * listSort runs on every primitive kind with negatives, extremes, -0.0, 0.0,
+ * infinities and NaNs of both signs, and must give the order of a qsort with
+ * a plain comparison; every element must then be found at its first position
+ * by the binary-search lookup. list_SORT and list_SORT_STABLE sort structs of
+ * many lengths and shapes, the stable sort keeping equal elements in order,
+ * and list_LOWER_BOUND and list_BINARY_SEARCH are compared with linear scans.
+ * Elements edited in place through list_GET, list_FOR_EACH or
+ * listGetMemoryAddress after listSort must still be found.
+ */
+
+#include <stdlib.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+#include <math.h>
+
+#include "test.h"
+#include "../list.h"
+
+#define MAX_COUNT 5000
+
+typedef struct {
+    int age;
+    int id;
+} Person;
+
+static const int lengths[] = {0, 1, 2, 3, 15, 16, 17, 100, 1000, MAX_COUNT};
+
+/**
+ * @brief Orders -NaN first, then numbers with -0.0 before 0.0, then +NaN.
+ */
+static int compareDouble(double x, double y) {
+    int rankX = isnan(x) ? (signbit(x) ? 0 : 2) : 1;
+    int rankY = isnan(y) ? (signbit(y) ? 0 : 2) : 1;
+    if (rankX != rankY || rankX != 1) {
+        return (rankX > rankY) - (rankX < rankY);
+    }
+    if (x == y) {
+        return (signbit(y) != 0) - (signbit(x) != 0);
+    }
+    return x < y ? -1 : 1;
+}
+
+static int compareF32(const void *a, const void *b) {
+    return compareDouble(*(const float *)a, *(const float *)b);
+}
+
+static int compareF64(const void *a, const void *b) {
+    return compareDouble(*(const double *)a, *(const double *)b);
+}
+
+#define DEFINE_COMPARE(Name, T)                                                     \
+static int compare##Name(const void *a, const void *b) {                            \
+    T x = *(const T *)a;                                                            \
+    T y = *(const T *)b;                                                            \
+    return (x > y) - (x < y);                                                       \
+}
+
+DEFINE_COMPARE(I32, int32_t)
+DEFINE_COMPARE(U32, uint32_t)
+DEFINE_COMPARE(I64, int64_t)
+DEFINE_COMPARE(U64, uint64_t)
+
+/**
+ * @brief Sorts a list of T with listSort and a copy with qsort, compares them,
+ *        and looks up every element and a few absent values.
+ */
+#define CHECK_RADIX(T, compare, count, draw) do {                                   \
+    static T expected[MAX_COUNT];                                                   \
+    List numbers;                                                                   \
+    list_INIT(&numbers, T);                                                         \
+    for (int i = 0; i < (count); i++) {                                             \
+        expected[i] = (draw);                                                       \
+        list_ADD(&numbers, T, expected[i]);                                         \
+    }                                                                               \
+    qsort(expected, (size_t)(count), sizeof(T), compare);                           \
+    TEST_CHECK(listSort(&numbers) && numbers.sorted);                               \
+    TEST_CHECK((count) == 0 ||                                                      \
+               memcmp(numbers.data, expected, (size_t)(count) * sizeof(T)) == 0);   \
+    for (int i = 0; i < (count); i++) {                                             \
+        int first = i;                                                              \
+        while (first > 0 && memcmp(&expected[first - 1], &expected[i], sizeof(T)) == 0) {\
+            first--;                                                                \
+        }                                                                           \
+        if (list_GET_INDEX_OF(&numbers, T, expected[i]) != first) {                 \
+            TEST_CHECK(list_GET_INDEX_OF(&numbers, T, expected[i]) == first);       \
+            break;                                                                  \
+        }                                                                           \
+    }                                                                               \
+    TEST_CHECK(!list_CONTAINS(&numbers, T, (T)12345));                              \
+    listFree(&numbers);                                                             \
+} while (0)
+
+/**
+ * @brief Draws a value from a small range, a large one, or one of the specials.
+ */
+static double drawDouble(void) {
+    static const double specials[] = {0.0, -0.0, INFINITY, -INFINITY, NAN, -NAN, 1e-310, -1e300};
+    uint32_t r = testRandom();
+    switch (r % 4) {
+    case 0:
+        return specials[(r >> 8) % 8];
+    case 1:
+        return (double)(int)((r >> 8) % 41) - 20.0;
+    default:
+        return ((double)(int32_t)testRandom()) / 1024.0;
+    }
+}
+
+static int64_t drawInteger(int64_t low, int64_t high) {
+    uint32_t r = testRandom();
+    switch (r % 5) {
+    case 0:
+        return r & 256 ? low : high;
+    case 1:
+        return (int64_t)((r >> 8) % 41) - 20;
+    default:
+        return (int64_t)(((uint64_t)testRandom() << 32) | testRandom());
+    }
+}
+
+static void testRadix(void) {
+    for (size_t l = 0; l < sizeof(lengths) / sizeof(lengths[0]) && !testFailures; l++) {
+        int count = lengths[l];
+        CHECK_RADIX(int32_t, compareI32, count, (int32_t)drawInteger(INT32_MIN, INT32_MAX));
+        CHECK_RADIX(uint32_t, compareU32, count, (uint32_t)drawInteger(0, UINT32_MAX));
+        CHECK_RADIX(int64_t, compareI64, count, drawInteger(INT64_MIN, INT64_MAX));
+        CHECK_RADIX(uint64_t, compareU64, count, (uint64_t)drawInteger(0, -1));
+        CHECK_RADIX(float, compareF32, count, (float)drawDouble());
+        CHECK_RADIX(double, compareF64, count, drawDouble());
+    }
+
+    List people;
+    list_INIT(&people, Person);
+    TEST_CHECK(!listSort(&people));             /* no natural order */
+    listFree(&people);
+}
+
+/**
+ * @brief Fills people with count persons of a given shape; ids are 0, 1, 2...
+ */
+static void fillPeople(Person *people, int count, int shape) {
+    for (int i = 0; i < count; i++) {
+        people[i].id = i;
+        switch (shape) {
+        case 0:
+            people[i].age = (int)(testRandom() % 1000);
+            break;
+        case 1:
+            people[i].age = (int)(testRandom() % 4);  /* many ties */
+            break;
+        case 2:
+            people[i].age = i;
+            break;
+        case 3:
+            people[i].age = count - i;
+            break;
+        case 4:
+            people[i].age = 7;
+            break;
+        default:
+            people[i].age = i < count / 2 ? i : count - i;  /* organ pipe */
+            break;
+        }
+    }
+}
+
+static int compareAgeThenId(const void *a, const void *b) {
+    const Person *x = a;
+    const Person *y = b;
+    if (x->age != y->age) {
+        return x->age < y->age ? -1 : 1;
+    }
+    return (x->id > y->id) - (x->id < y->id);
+}
+
+static void testExpressionSorts(void) {
+    static Person expected[MAX_COUNT];
+    for (size_t l = 0; l < sizeof(lengths) / sizeof(lengths[0]) && !testFailures; l++) {
+        int count = lengths[l];
+        for (int shape = 0; shape < 6; shape++) {
+            List people;
+            List stable;
+            list_INIT(&people, Person);
+            list_INIT(&stable, Person);
+            fillPeople(expected, count, shape);
+            for (int i = 0; i < count; i++) {
+                list_ADD(&people, Person, expected[i]);
+                list_ADD(&stable, Person, expected[i]);
+            }
+            qsort(expected, (size_t)count, sizeof(Person), compareAgeThenId);
+
+            list_SORT(&people, Person, a->age < b->age);
+            list_SORT_STABLE(&stable, Person, a->age < b->age);
+            TEST_CHECK(count == 0 ||
+                       memcmp(stable.data, expected, (size_t)count * sizeof(Person)) == 0);
+            bool sameAges = true;
+            for (int i = 0; i < count; i++) {
+                sameAges = sameAges && list_GET(&people, Person, i)->age == expected[i].age;
+            }
+            TEST_CHECK(sameAges);
+            list_SORT(&people, Person, a->age < b->age || (a->age == b->age && a->id < b->id));
+            TEST_CHECK(count == 0 ||
+                       memcmp(people.data, expected, (size_t)count * sizeof(Person)) == 0);
+
+            for (int age = -1; age <= 1001; age += 1 + (int)(testRandom() % 50)) {
+                int lower = 0;
+                while (lower < count && expected[lower].age < age) {
+                    lower++;
+                }
+                Person key = {age, 0};
+                TEST_CHECK(list_LOWER_BOUND(&stable, Person, key, a->age < b->age) == lower);
+                int found = lower < count && expected[lower].age == age ? lower : -1;
+                TEST_CHECK(list_BINARY_SEARCH(&stable, Person, key, a->age < b->age) == found);
+            }
+            listFree(&people);
+            listFree(&stable);
+        }
+    }
+}
+
+static void fillSorted(List *numbers) {
+    list_INIT(numbers, int);
+    for (int i = 0; i < 1000; i++) {
+        list_ADD(numbers, int, 999 - i);
+    }
+    TEST_CHECK(listSort(numbers) && numbers->sorted);
+}
+
+static void testSortedFlag(void) {
+    List numbers;
+    fillSorted(&numbers);
+    TEST_CHECK(list_GET_INDEX_OF(&numbers, int, 500) == 500);
+
+    *list_GET(&numbers, int, 10) = 5000; /* breaks the order */
+    TEST_CHECK(!numbers.sorted);
+    TEST_CHECK(list_GET_INDEX_OF(&numbers, int, 5000) == 10);
+    TEST_CHECK(listSort(&numbers) && list_GET_INDEX_OF(&numbers, int, 5000) == 999);
+
+    list_FOR_EACH(&numbers, int, *element = -*element);
+    TEST_CHECK(list_CONTAINS(&numbers, int, -5000));
+    TEST_CHECK(list_GET_INDEX_OF(&numbers, int, -1) == 1);
+
+    TEST_CHECK(listSort(&numbers));
+    *(int *)listGetMemoryAddress(&numbers, 0) = 7777;
+    TEST_CHECK(list_CONTAINS(&numbers, int, 7777));
+
+    TEST_CHECK(listSort(&numbers));
+    ListView view = listAsView(&numbers);
+    list_FOR_EACH(&view, int, (void)element); /* views do not touch the list */
+    TEST_CHECK(numbers.sorted);
+    listFree(&numbers);
+}
+
+int main(void) {
+    testRadix();
+    testExpressionSorts();
+    testSortedFlag();
+    return testReport("test_sort");
+}
@@ -0,0 +1,109 @@
+/**
+ * @file test_stats.c
+ * @brief Operation counters of -DLIST_STATS builds.
+ * @author Mark Jayson Lanuzo
+ * @date 2026-10-17
+ *
+ * Built with -DLIST_STATS by the Makefile. Runs a known sequence of adds,
+ * inserts, removals and lookups and checks each counter against the value
+ * worked out by hand: calls per macro, reallocations, bytes copied while
+ * growing, bytes shifted, elements compared and the peak buffer size. Lists
+ * initialized under the same name share one registry entry that outlives
+ * them, views are not counted, and the dumps print the counters by name.
+ */
+
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include "test.h"
+#include "../list.h"
+
+#ifndef LIST_STATS
+#error "test_stats must be built with -DLIST_STATS"
+#endif
+
+/**
+ * @brief Reads back what a dump function wrote to a temporary file.
+ */
+static void readDump(FILE *out, char *buffer, size_t size) {
+    rewind(out);
+    size_t length = fread(buffer, 1, size - 1, out);
+    buffer[length] = '\0';
+    fclose(out);
+}
+
+static void testCounters(void) {
+    List numbers;
+    list_INIT(&numbers, int);
+    ListStats *stats = numbers.stats;
+    TEST_CHECK(stats && strcmp(stats->name, "&numbers") == 0 && stats->calls[LIST_OP_INIT] == 1);
+
+    for (int i = 0; i < 100; i++) {             /* 8 -> 16 -> 32 -> 64 -> 128 */
+        list_ADD(&numbers, int, i);
+    }
+    TEST_CHECK(stats->calls[LIST_OP_ADD] == 100);
+    TEST_CHECK(stats->reallocs == 4);
+    TEST_CHECK(stats->bytesCopied == (8 + 16 + 32 + 64) * sizeof(int));
+    TEST_CHECK(stats->peakListSize == 128 * sizeof(int));
+
+    int first = -1;
+    list_ADD_AT(&numbers, int, first, 0);       /* shifts 100 elements */
+    list_REMOVE_AT(&numbers, int, 0);           /* and back */
+    TEST_CHECK(stats->bytesMoved == 200 * sizeof(int));
+    TEST_CHECK(stats->calls[LIST_OP_ADD_AT] == 1 && stats->calls[LIST_OP_REMOVE_AT] == 1);
+
+    TEST_CHECK(list_GET_INDEX_OF(&numbers, int, 41) == 41);    /* 42 compared */
+    TEST_CHECK(list_GET_INDEX_OF(&numbers, int, 1000) == -1);  /* all 100 */
+    TEST_CHECK(list_CONTAINS(&numbers, int, 5));               /* 6 */
+    TEST_CHECK(stats->comparisons == 42 + 100 + 6);
+    TEST_CHECK(stats->calls[LIST_OP_GET_INDEX_OF] == 2 && stats->calls[LIST_OP_CONTAINS] == 1);
+
+    ListView view = listAsView(&numbers);
+    TEST_CHECK(list_GET_INDEX_OF(&view, int, 3) == 3 && *list_GET(&view, int, 7) == 7);
+    TEST_CHECK(stats->calls[LIST_OP_GET_INDEX_OF] == 2 && stats->calls[LIST_OP_GET] == 0);
+
+    char buffer[4096];
+    FILE *out = tmpfile();
+    listStatsDump(&numbers, out);
+    readDump(out, buffer, sizeof(buffer));
+    TEST_CHECK(strstr(buffer, "&numbers (int): 1 live") != NULL);
+    TEST_CHECK(strstr(buffer, "list_ADD             100") != NULL);
+    TEST_CHECK(strstr(buffer, "reallocs 4, bytes copied 480, bytes moved 800, "
+                              "comparisons 148, peak listSize 512") != NULL);
+    listFree(&numbers);
+    TEST_CHECK(numbers.stats == NULL && stats->liveLists == 0);
+}
+
+static ListStats *useScratch(int count) {
+    List scratch;
+    list_INIT(&scratch, double);
+    for (int i = 0; i < count; i++) {
+        list_ADD(&scratch, double, i * 0.5);
+    }
+    ListStats *stats = scratch.stats;
+    TEST_CHECK(stats->liveLists == 1);
+    listFree(&scratch);
+    return stats;
+}
+
+static void testRegistry(void) {
+    ListStats *first = useScratch(3);
+    ListStats *second = useScratch(4);
+    TEST_CHECK(first == second);                /* one entry per name */
+    TEST_CHECK(first->calls[LIST_OP_INIT] == 2 && first->calls[LIST_OP_ADD] == 7);
+    TEST_CHECK(strcmp(first->dataTypeOf, "double") == 0 && first->liveLists == 0);
+
+    char buffer[8192];
+    FILE *out = tmpfile();
+    listStatsDumpAll(out);
+    readDump(out, buffer, sizeof(buffer));
+    TEST_CHECK(strstr(buffer, "&numbers (int): 0 live") != NULL);
+    TEST_CHECK(strstr(buffer, "&scratch (double): 0 live") != NULL);
+}
+
+int main(void) {
+    testCounters();
+    testRegistry();
+    return testReport("test_stats");
+}
@@ -0,0 +1,172 @@
+/**
+ * @file test_stream.c
+ * @brief listStreamWrite / list_STREAM_READ round trips and rejected streams.
+ * @author Mark Jayson Lanuzo
+ * @date 2026-10-17
+ *
+ * Round-trips a list of Persons with strings, reads two streams and the bytes
+ * after them from one file descriptor, and checks that truncated streams and
+ * a header announcing more elements than the stream holds are rejected
+ * without allocating for the announced count.
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <stdbool.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+#include "test.h"
+#include "../list.h"
+
+#define PATH "test_stream.bin"
+
+typedef struct {
+    char *address1;
+    char *address2;
+} Address;
+
+typedef struct {
+    char *name;
+    int age;
+    Address homeAddress;
+} Person;
+
+static const ListField addressFields[] = {
+    list_FIELD_STRING(Address, address1),
+    list_FIELD_STRING(Address, address2),
+};
+static const ListSchema addressSchema = list_SCHEMA(Address, addressFields);
+
+static const ListField personFields[] = {
+    list_FIELD_STRING(Person, name),
+    list_FIELD(Person, age),
+    list_FIELD_STRUCT(Person, homeAddress, addressSchema),
+};
+static const ListSchema personSchema = list_SCHEMA(Person, personFields);
+
+static const char *const names[] = {"Alice", "Bob", "Charlie", "Dana"};
+
+static void fillPeople(List *people, int count) {
+    list_INIT(people, Person);
+    for (int i = 0; i < count; i++) {
+        Person person = {(char *)names[i % 4], i, {(char *)names[(i + 1) % 4], NULL}};
+        list_ADD(people, Person, person);
+    }
+}
+
+static bool samePeople(List *people, List *loaded) {
+    if (people->currentCount != loaded->currentCount) {
+        return false;
+    }
+    for (int i = 0; i < people->currentCount; i++) {
+        Person *a = list_GET(people, Person, i);
+        Person *b = list_GET(loaded, Person, i);
+        if (strcmp(a->name, b->name) != 0 || a->age != b->age ||
+            strcmp(a->homeAddress.address1, b->homeAddress.address1) != 0 ||
+            b->homeAddress.address2 != NULL) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static void testRoundTrip(void) {
+    List people;
+    List loaded;
+    ListArena arena;
+    fillPeople(&people, 10000);
+    FILE *file = fopen(PATH, "w+b");
+    TEST_CHECK(file && listStreamWrite(&people, file));
+    rewind(file);
+    listArenaInit(&arena, 0);
+    TEST_CHECK(list_STREAM_READ(&loaded, Person, file, &arena));
+    TEST_CHECK(samePeople(&people, &loaded));
+    listArenaDestroy(&arena);
+    fclose(file);
+    listFree(&people);
+}
+
+static void testSharedDescriptor(void) {
+    List first;
+    List second;
+    List loaded;
+    ListArena arena;
+    char tail[8] = {0};
+    fillPeople(&first, 5000);
+    fillPeople(&second, 3);
+    int fd = open(PATH, O_RDWR | O_CREAT | O_TRUNC, 0600);
+    TEST_CHECK(fd >= 0);
+    TEST_CHECK(listStreamWriteFd(&first, fd) && listStreamWriteFd(&second, fd));
+    TEST_CHECK(write(fd, "TAIL", 4) == 4);
+    lseek(fd, 0, SEEK_SET);
+
+    listArenaInit(&arena, 0);
+    TEST_CHECK(list_STREAM_READ_FD(&loaded, Person, fd, &arena));
+    TEST_CHECK(samePeople(&first, &loaded));
+    TEST_CHECK(list_STREAM_READ_FD(&loaded, Person, fd, &arena));
+    TEST_CHECK(samePeople(&second, &loaded));
+    TEST_CHECK(read(fd, tail, sizeof(tail)) == 4 && strcmp(tail, "TAIL") == 0);
+    listArenaDestroy(&arena);
+    close(fd);
+    listFree(&first);
+    listFree(&second);
+}
+
+/**
+ * @brief Writes a stream of count Persons and returns its bytes.
+ */
+static unsigned char *encode(int count, long *size) {
+    List people;
+    fillPeople(&people, count);
+    FILE *file = fopen(PATH, "w+b");
+    TEST_CHECK(file && listStreamWrite(&people, file));
+    *size = ftell(file);
+    unsigned char *bytes = malloc((size_t)*size);
+    rewind(file);
+    TEST_CHECK(bytes && fread(bytes, 1, (size_t)*size, file) == (size_t)*size);
+    fclose(file);
+    listFree(&people);
+    return bytes;
+}
+
+static bool decode(const unsigned char *bytes, long size) {
+    List loaded;
+    ListArena arena;
+    FILE *file = fopen(PATH, "w+b");
+    fwrite(bytes, 1, (size_t)size, file);
+    rewind(file);
+    listArenaInit(&arena, 0);
+    bool valid = list_STREAM_READ(&loaded, Person, file, &arena);
+    listArenaDestroy(&arena);
+    fclose(file);
+    return valid;
+}
+
+static void testRejected(void) {
+    long size;
+    unsigned char *bytes = encode(100, &size);
+    TEST_CHECK(decode(bytes, size));
+    TEST_CHECK(!decode(bytes, size - 1));
+    TEST_CHECK(!decode(bytes, size / 2));
+    TEST_CHECK(!decode(bytes, 12));
+
+    /* The header count is at offset 16; INT_MAX Persons would need ~70 GB */
+    uint64_t count = 0x7FFFFFFF;
+    memcpy(bytes + 16, &count, sizeof(count));
+    TEST_CHECK(!decode(bytes, size));
+    count = 99;
+    memcpy(bytes + 16, &count, sizeof(count));
+    TEST_CHECK(!decode(bytes, size));
+    free(bytes);
+}
+
+int main(void) {
+    listRegisterSchema(&personSchema);
+    testRoundTrip();
+    testSharedDescriptor();
+    testRejected();
+    remove(PATH);
+    return testReport("test_stream");
+}
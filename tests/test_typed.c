@@ -0,0 +1,153 @@
+/**
+ * @file test_typed.c
+ * @brief Generated typed lists checked against the generic List.
+ * @author Mark Jayson Lanuzo
+ * @date 2026-10-17
+ *
+ * Applies the same random adds, inserts, sets and removals to an IntList and
+ * to a generic List of int, then compares the contents, lookups, a collected
+ * sublist and an array round trip. A PersonList covers struct elements.
+ */
+
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include "test.h"
+#include "../list.h"
+#include "../list_typed.h"
+
+#define STEPS 20000
+#define VALUES 100
+
+typedef struct {
+    char name[16];
+    int age;
+} Person;
+
+LIST_DECLARE(IntList, int)
+LIST_DEFINE(IntList, int)
+LIST_DECLARE(PersonList, Person)
+LIST_DEFINE(PersonList, Person)
+
+static bool sameContents(const IntList *typed, List *generic) {
+    if ((int)IntListLength(typed) != generic->currentCount) {
+        return false;
+    }
+    for (size_t i = 0; i < typed->count; i++) {
+        if (typed->data[i] != *list_GET(generic, int, (int)i)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static void testAgainstGeneric(void) {
+    IntList typed;
+    List generic;
+    IntListInit(&typed);
+    list_INIT(&generic, int);
+    TEST_CHECK(IntListIsEmpty(&typed));
+
+    for (int i = 0; i < STEPS && !testFailures; i++) {
+        int value = (int)(testRandom() % VALUES);
+        size_t count = IntListLength(&typed);
+        int position = count ? (int)(testRandom() % count) : 0;
+        switch (count < 8 ? 0 : testRandom() % 6) {
+        case 0:
+        case 1:
+            IntListAdd(&typed, value);
+            list_ADD(&generic, int, value);
+            break;
+        case 2:
+            IntListAddAt(&typed, value, (size_t)position);
+            list_ADD_AT(&generic, int, value, position);
+            break;
+        case 3:
+            IntListSet(&typed, (size_t)position, value);
+            list_SET(&generic, int, position, value);
+            break;
+        case 4:
+            IntListRemoveAt(&typed, (size_t)position);
+            list_REMOVE_AT(&generic, int, position);
+            break;
+        default:
+            if (IntListContains(&typed, value)) {
+                IntListRemove(&typed, value);
+                list_REMOVE(&generic, int, value);
+            }
+            break;
+        }
+        TEST_CHECK(IntListIndexOf(&typed, value) == list_GET_INDEX_OF(&generic, int, value));
+        TEST_CHECK(*IntListGet(&typed, 0) == *list_GET(&generic, int, 0));
+    }
+    TEST_CHECK(sameContents(&typed, &generic));
+
+    IntList even;
+    List evenGeneric;
+    LIST_TYPED_COLLECT(IntList, &typed, *element % 2 == 0, &even);
+    list_COLLECT_TO_SUBLIST(&generic, int, *element % 2 == 0, &evenGeneric);
+    TEST_CHECK(sameContents(&even, &evenGeneric));
+
+    int *array = IntListToArray(&typed);
+    IntList copy;
+    IntListInit(&copy);
+    IntListFromArray(&copy, array, typed.count);
+    TEST_CHECK(copy.count == typed.count &&
+               memcmp(copy.data, typed.data, typed.count * sizeof(int)) == 0);
+    free(array);
+
+    IntListFree(&copy);
+    IntListFree(&even);
+    IntListFree(&typed);
+    listFree(&evenGeneric);
+    listFree(&generic);
+}
+
+static void testEdges(void) {
+    IntList numbers;
+    IntListInit(&numbers);
+    int *empty = IntListToArray(&numbers); /* never NULL, even for no elements */
+    TEST_CHECK(empty != NULL);
+    free(empty);
+    IntListFromArray(&numbers, NULL, 0);
+    TEST_CHECK(IntListIsEmpty(&numbers));
+    TEST_CHECK(IntListGet(&numbers, 0) == NULL);
+    IntListAddAt(&numbers, 1, 5);                   /* out of range: ignored */
+    TEST_CHECK(IntListLength(&numbers) == 0);
+
+    const int values[] = {5, 7, 9};
+    IntListFromArray(&numbers, values, 3);
+    IntListFromArray(&numbers, values, 3);          /* appends */
+    TEST_CHECK(IntListLength(&numbers) == 6 && *IntListGet(&numbers, 4) == 7);
+    TEST_CHECK(IntListGet(&numbers, 6) == NULL);
+    IntListReserve(&numbers, 1000);
+    TEST_CHECK(numbers.capacity >= 1000 && *IntListGet(&numbers, 5) == 9);
+    IntListFree(&numbers);
+
+    PersonList people;
+    PersonListInit(&people);
+    for (int i = 0; i < 50; i++) {
+        Person person;
+        memset(&person, 0, sizeof(person));
+        snprintf(person.name, sizeof(person.name), "person%d", i);
+        person.age = i;
+        PersonListAdd(&people, person);
+    }
+    Person probe;
+    memset(&probe, 0, sizeof(probe));
+    strcpy(probe.name, "person30");
+    probe.age = 30;
+    TEST_CHECK(PersonListIndexOf(&people, probe) == 30);
+    PersonList adults;
+    LIST_TYPED_COLLECT(PersonList, &people, element->age >= 18, &adults);
+    TEST_CHECK(adults.count == 32 && PersonListGet(&adults, 0)->age == 18);
+    PersonListFree(&adults);
+    PersonListFree(&people);
+}
+
+int main(void) {
+    testAgainstGeneric();
+    testEdges();
+    return testReport("test_typed");
+}
@@ -0,0 +1,147 @@
+/**
+ * @file test_view.c
+ * @brief Views, slices and selections checked against index arithmetic.
+ * @author Mark Jayson Lanuzo
+ * @date 2026-10-17
+ *
+ * Takes random slices, strided slices and slices of slices of a list that
+ * wraps around its buffer, and keeps for each view the list positions it
+ * should cover. list_GET, list_GET_INDEX_OF, list_CONTAINS, list_FOR_EACH and
+ * list_SELECT on the view must agree with a loop over those positions, and
+ * the view must point into the buffer of the list instead of a copy. Ranges
+ * outside the list give empty views.
+ */
+
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include "test.h"
+#include "../list.h"
+
+#define COUNT 3000
+#define VALUES 200
+#define ROUNDS 2000
+
+static int positions[COUNT];
+static int positionCount;
+
+/**
+ * @brief Compares a view with the list elements at positions[0..positionCount).
+ */
+static void checkView(List *list, ListView *view, ListSelection *selection) {
+    TEST_CHECK(view->currentCount == positionCount);
+    for (int i = 0; i < positionCount; i++) {
+        TEST_CHECK(list_GET(view, int, i) == (int *)listAt(list, positions[i]));
+    }
+
+    int probe = (int)(testRandom() % VALUES);
+    int first = -1;
+    long long sum = 0;
+    for (int i = 0; i < positionCount; i++) {
+        int value = *(int *)listAt(list, positions[i]);
+        first = first == -1 && value == probe ? i : first;
+        sum += value;
+    }
+    TEST_CHECK(list_GET_INDEX_OF(view, int, probe) == first);
+    TEST_CHECK(list_CONTAINS(view, int, probe) == (first != -1));
+
+    long long viewSum = 0;
+    int visited = 0;
+    list_FOR_EACH(view, int, viewSum += *element; visited++);
+    TEST_CHECK(viewSum == sum && visited == positionCount);
+
+    int divisor = (int)(testRandom() % 5) + 2;
+    list_SELECT(view, int, *element % divisor == 0, selection);
+    int selected = 0;
+    for (int i = 0; i < positionCount; i++) {
+        if (*(int *)listAt(list, positions[i]) % divisor == 0) {
+            TEST_CHECK(selected < selection->currentCount &&
+                       selection->positions[selected] == (uint32_t)i);
+            selected++;
+        }
+    }
+    TEST_CHECK(selection->currentCount == selected);
+}
+
+static void testRandomSlices(void) {
+    List list;
+    ListSelection selection;
+    list_INIT(&list, int);
+    listSelectionInit(&selection);
+    for (int i = 0; i < COUNT; i++) {
+        list_ADD(&list, int, (int)(testRandom() % VALUES));
+    }
+    for (int i = 0; i < 100; i++) {             /* wrap the ring; views linearize it */
+        list_PUSH_FRONT(&list, int, list_POP_BACK(&list, int));
+    }
+    ListView all = listAsView(&list);
+    TEST_CHECK(all.data == list.data && list.head == 0);
+
+    for (int round = 0; round < ROUNDS && !testFailures; round++) {
+        int start = (int)(testRandom() % COUNT);
+        int step = (int)(testRandom() % 4) + 1;
+        int length = (int)(testRandom() % ((COUNT - start - 1) / step + 2));
+        ListView view = round % 3 == 0 ? listSlice(&list, start, length)
+                                        : listSliceStep(&list, start, length, step);
+        if (round % 3 == 0) {
+            step = 1;
+        }
+        positionCount = length;
+        for (int i = 0; i < length; i++) {
+            positions[i] = start + i * step;
+        }
+        checkView(&list, &view, &selection);
+
+        /* narrow it a few times more */
+        for (int depth = 0; depth < 3 && positionCount > 0; depth++) {
+            int subStart = (int)(testRandom() % (uint32_t)positionCount);
+            int subLength = (int)(testRandom() % (uint32_t)(positionCount - subStart + 1));
+            ListView narrower = listViewSlice(&view, subStart, subLength);
+            memmove(positions, positions + subStart, (size_t)subLength * sizeof(int));
+            positionCount = subLength;
+            checkView(&list, &narrower, &selection);
+            ListView copy = list_AS_VIEW(&narrower);
+            TEST_CHECK(copy.data == narrower.data && copy.stride == narrower.stride);
+            view = narrower;
+        }
+    }
+    listSelectionFree(&selection);
+    listFree(&list);
+}
+
+static void testEdges(void) {
+    List list;
+    list_INIT(&list, int);
+    for (int i = 0; i < 10; i++) {
+        list_ADD(&list, int, i);
+    }
+    TEST_CHECK(listSlice(&list, 10, 0).currentCount == 0);          /* empty at the end */
+    TEST_CHECK(listSlice(&list, 11, 0).currentCount == 0);
+    TEST_CHECK(listSlice(&list, 5, 6).currentCount == 0);           /* past the end */
+    TEST_CHECK(listSlice(&list, -1, 2).currentCount == 0);
+    TEST_CHECK(listSliceStep(&list, 0, 4, 3).currentCount == 4);    /* 0, 3, 6, 9 */
+    TEST_CHECK(listSliceStep(&list, 0, 5, 3).currentCount == 0);
+    TEST_CHECK(listSliceStep(&list, 0, 2, 0).currentCount == 0);
+
+    ListView odd = listSliceStep(&list, 1, 5, 2);
+    TEST_CHECK(*list_GET(&odd, int, 4) == 9);
+    TEST_CHECK(listViewGet(&odd, 5) == NULL && listViewGet(&odd, -1) == NULL);
+    TEST_CHECK(list_GET_INDEX_OF(&odd, int, 4) == -1);              /* skipped by the step */
+
+    ListSelection selection;
+    listSelectionInit(&selection);
+    listSelectionReserve(&selection, 10);
+    uint32_t *buffer = selection.positions;
+    list_SELECT(&list, int, *element > 2, &selection);
+    list_SELECT(&odd, int, *element >= 0, &selection);              /* reused, not grown */
+    TEST_CHECK(selection.positions == buffer && selection.currentCount == 5);
+    listSelectionFree(&selection);
+    listFree(&list);
+}
+
+int main(void) {
+    testRandomSlices();
+    testEdges();
+    return testReport("test_view");
+}